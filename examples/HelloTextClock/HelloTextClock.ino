@@ -29,7 +29,8 @@ void setup() {
 #endif
 
   atc_processor_init(&losAngelesProcessor);
-  AtcTimeZone tz = {&kAtcZoneAmerica_Los_Angeles, &losAngelesProcessor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcZoneAmerica_Los_Angeles, &losAngelesProcessor);
 
   // Create a ZoneDateTime of 2019-03-10T03:00:00, just after DST shift
   struct AtcPlainDateTime localTime = {2019, 3, 10, 3, 0, 0};
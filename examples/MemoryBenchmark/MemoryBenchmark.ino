@@ -48,14 +48,17 @@ volatile int16_t year = 2019;
 #elif FEATURE == FEATURE_TIME_ZONE
   AtcPlainDateTime pdt = {year, 6, 17, 9, 18, 0};
   AtcZoneProcessor processor;
-  AtcTimeZone tz = {&kAtcZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcZoneAmerica_Los_Angeles, &processor);
   AtcZonedDateTime zdt;
 #elif FEATURE == FEATURE_TIME_ZONE2
   AtcPlainDateTime pdt = {year, 6, 17, 9, 18, 0};
   AtcZoneProcessor processor1;
   AtcZoneProcessor processor2;
-  AtcTimeZone tz1 = {&kAtcZoneAmerica_Los_Angeles, &processor1};
-  AtcTimeZone tz2 = {&kAtcZoneAmerica_New_York, &processor2};
+  AtcTimeZone tz1 = atc_time_zone_for_zone_info(
+      &kAtcZoneAmerica_Los_Angeles, &processor1);
+  AtcTimeZone tz2 = atc_time_zone_for_zone_info(
+      &kAtcZoneAmerica_New_York, &processor2);
   AtcZonedDateTime zdt1;
   AtcZonedDateTime zdt2;
 #elif FEATURE == FEATURE_ZONE_REGISTRY \
@@ -136,7 +139,7 @@ void setup() {
   atc_registrar_init(&registrar, kAtcZoneRegistry, kAtcZoneRegistrySize);
   const AtcZoneInfo *zone_info = atc_registrar_find_by_name(
     &registrar, "America/Los_Angeles");
-  AtcTimeZone tz = {zone_info, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(zone_info, &processor);
   atc_zoned_date_time_from_plain_date_time(
       &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
   if (atc_zoned_date_time_is_error(&zdt)) return;
@@ -149,7 +152,7 @@ void setup() {
       kAtcZoneAndLinkRegistry, kAtcZoneAndLinkRegistrySize);
   const AtcZoneInfo *zone_info = atc_registrar_find_by_name(
     &registrar, "America/Los_Angeles");
-  AtcTimeZone tz = {zone_info, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(zone_info, &processor);
   atc_zoned_date_time_from_plain_date_time(
       &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
   if (atc_zoned_date_time_is_error(&zdt)) return;
@@ -161,7 +164,7 @@ void setup() {
   atc_registrar_init(&registrar, kAtcAllZoneRegistry, kAtcAllZoneRegistrySize);
   const AtcZoneInfo *zone_info = atc_registrar_find_by_name(
     &registrar, "America/Los_Angeles");
-  AtcTimeZone tz = {zone_info, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(zone_info, &processor);
   atc_zoned_date_time_from_plain_date_time(
       &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
   if (atc_zoned_date_time_is_error(&zdt)) return;
@@ -174,7 +177,7 @@ void setup() {
       kAtcAllZoneAndLinkRegistry, kAtcAllZoneAndLinkRegistrySize);
   const AtcZoneInfo *zone_info = atc_registrar_find_by_name(
     &registrar, "America/Los_Angeles");
-  AtcTimeZone tz = {zone_info, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(zone_info, &processor);
   atc_zoned_date_time_from_plain_date_time(
       &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
   if (atc_zoned_date_time_is_error(&zdt)) return;
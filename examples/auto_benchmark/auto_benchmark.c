@@ -0,0 +1,495 @@
+/*
+Host-side benchmark of the public API of acetimec, the native counterpart of
+the AutoBenchmark of the AceTime library. The MemoryBenchmark measures the
+flash and static RAM on Arduino boards; this program measures the speed on
+Linux or macOS.
+
+Each benchmark is run over the zones of zonedbtesting, zonedb2025 and
+zonedball, and prints one CSV line with the nanoseconds per operation. On
+Linux, the CPU cycles and cache misses per operation are also read through
+perf_event_open(2). These columns are empty if the counters are not available
+(e.g. kernel.perf_event_paranoid is too high, or inside a container).
+
+The 'warm' mode gives each zone its own AtcZoneProcessor, already initialized
+for the year, so that the conversions use the cached transitions. The 'cold'
+mode uses a single AtcZoneProcessor and changes the zone on every call, so that
+every conversion regenerates the transitions of the zone. The
+'warm_transitions' mode is the same as 'warm', but with the AtcSteadyState of
+each processor disabled, so that the conversions always search the cached
+transitions. It is the baseline of the steady state, which should be no
+slower for lookups within the same year. The registrar
+lookups and the formatting do not use a processor, so they are only warm.
+
+Usage:
+$ make
+$ ./auto_benchmark.out
+# acetimec 0.15.0
+benchmark,zonedb,mode,ops,ns_per_op,cycles_per_op,cache_misses_per_op
+...
+*/
+
+#define _GNU_SOURCE
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h> // clock_gettime()
+#include <acetimec.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HAS_PERF_EVENT 1
+#else
+#define HAS_PERF_EVENT 0
+#endif
+
+enum {
+  /** Number of instants per zone, on the 15th of each month. */
+  kNumMonths = 12,
+
+  /** Maximum number of zones in a database, for the warm processors. */
+  kMaxZones = 400,
+
+  /** Maximum number of zones and links in a database, for the index. */
+  kMaxZonesAndLinks = 600,
+
+  /** Approximate number of operations of a warm benchmark. */
+  kWarmOps = 1000000,
+
+  /** Approximate number of operations of a cold benchmark. */
+  kColdOps = 100000,
+
+  /** Year of the conversions, within the range of all the databases. */
+  kYear = 2030,
+};
+
+typedef struct Database {
+  const char *name;
+  const AtcZoneInfo * const *zones;
+  uint16_t num_zones;
+  const AtcZoneInfo * const *zones_and_links;
+  uint16_t num_zones_and_links;
+  const AtcZoneHash *zones_and_links_hash;
+} Database;
+
+static const Database kDatabases[] = {
+  {
+    "zonedbtesting",
+    kAtcTestingZoneRegistry, kAtcTestingZoneRegistrySize,
+    kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+    &kAtcTestingZoneAndLinkHash,
+  },
+  {
+    "zonedb2025",
+    kAtcZonedb2025ZoneRegistry, kAtcZonedb2025ZoneRegistrySize,
+    kAtcZonedb2025ZoneAndLinkRegistry, kAtcZonedb2025ZoneAndLinkRegistrySize,
+    &kAtcZonedb2025ZoneAndLinkHash,
+  },
+  {
+    "zonedball",
+    kAtcZonedballZoneRegistry, kAtcZonedballZoneRegistrySize,
+    kAtcZonedballZoneAndLinkRegistry, kAtcZonedballZoneAndLinkRegistrySize,
+    &kAtcZonedballZoneAndLinkHash,
+  },
+};
+
+enum { kNumDatabases = sizeof(kDatabases) / sizeof(kDatabases[0]) };
+
+static AtcZoneProcessor warm_processors[kMaxZones];
+static AtcTimeZone warm_zones[kMaxZones];
+static AtcZoneProcessor cold_processor;
+
+static atc_time_t epoch_seconds[kNumMonths];
+static AtcPlainDateTime plain_date_times[kNumMonths];
+
+/** Sink for the results, to prevent the compiler from removing the loops. */
+static volatile int64_t sink;
+
+//---------------------------------------------------------------------------
+// Timer and hardware counters.
+//---------------------------------------------------------------------------
+
+typedef struct Counters {
+  int cycles_fd;
+  int misses_fd;
+  struct timespec start;
+} Counters;
+
+typedef struct Measurement {
+  uint64_t nanos;
+  bool has_counters;
+  uint64_t cycles;
+  uint64_t cache_misses;
+} Measurement;
+
+#if HAS_PERF_EVENT
+static int open_counter(uint32_t type, uint64_t config)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static uint64_t read_counter(int fd)
+{
+  uint64_t value = 0;
+  if (read(fd, &value, sizeof(value)) != sizeof(value)) return 0;
+  return value;
+}
+#endif
+
+static void counters_init(Counters *counters)
+{
+#if HAS_PERF_EVENT
+  counters->cycles_fd = open_counter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  counters->misses_fd = open_counter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  if (counters->cycles_fd < 0 || counters->misses_fd < 0) {
+    if (counters->cycles_fd >= 0) close(counters->cycles_fd);
+    if (counters->misses_fd >= 0) close(counters->misses_fd);
+    counters->cycles_fd = -1;
+    counters->misses_fd = -1;
+  }
+#else
+  counters->cycles_fd = -1;
+  counters->misses_fd = -1;
+#endif
+}
+
+static void counters_start(Counters *counters)
+{
+#if HAS_PERF_EVENT
+  if (counters->cycles_fd >= 0) {
+    ioctl(counters->cycles_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counters->misses_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counters->cycles_fd, PERF_EVENT_IOC_ENABLE, 0);
+    ioctl(counters->misses_fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+  clock_gettime(CLOCK_MONOTONIC, &counters->start);
+}
+
+static Measurement counters_stop(Counters *counters)
+{
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  Measurement m;
+  m.nanos = (uint64_t) (end.tv_sec - counters->start.tv_sec) * 1000000000u
+      + (uint64_t) end.tv_nsec - (uint64_t) counters->start.tv_nsec;
+  m.has_counters = false;
+  m.cycles = 0;
+  m.cache_misses = 0;
+#if HAS_PERF_EVENT
+  if (counters->cycles_fd >= 0) {
+    ioctl(counters->cycles_fd, PERF_EVENT_IOC_DISABLE, 0);
+    ioctl(counters->misses_fd, PERF_EVENT_IOC_DISABLE, 0);
+    m.has_counters = true;
+    m.cycles = read_counter(counters->cycles_fd);
+    m.cache_misses = read_counter(counters->misses_fd);
+  }
+#endif
+  return m;
+}
+
+static void print_result(
+    const char *benchmark,
+    const Database *db,
+    const char *mode,
+    uint32_t ops,
+    const Measurement *m)
+{
+  printf("%s,%s,%s,%u,%.1f,", benchmark, db->name, mode, (unsigned) ops,
+      (double) m->nanos / ops);
+  if (m->has_counters) {
+    printf("%.1f,%.2f\n",
+        (double) m->cycles / ops, (double) m->cache_misses / ops);
+  } else {
+    printf(",\n");
+  }
+}
+
+//---------------------------------------------------------------------------
+// Setup.
+//---------------------------------------------------------------------------
+
+static void setup_instants(void)
+{
+  for (uint8_t i = 0; i < kNumMonths; i++) {
+    AtcPlainDateTime *pdt = &plain_date_times[i];
+    pdt->year = kYear;
+    pdt->month = i + 1;
+    pdt->day = 15;
+    pdt->hour = 12;
+    pdt->minute = 0;
+    pdt->second = 0;
+    epoch_seconds[i] = atc_plain_date_time_to_epoch_seconds(pdt);
+  }
+}
+
+/**
+ * Bind a processor to each zone, and initialize it for kYear. If
+ * `steady_state` is false, the AtcSteadyState of each processor is disabled.
+ */
+static void setup_warm(const Database *db, bool steady_state)
+{
+  for (uint16_t z = 0; z < db->num_zones; z++) {
+    atc_processor_init(&warm_processors[z]);
+    atc_processor_init_for_zone_info(&warm_processors[z], db->zones[z]);
+    if (! steady_state) {
+      atc_processor_disable_steady_state(&warm_processors[z]);
+    }
+    warm_zones[z] = atc_time_zone_for_zone_info(
+        db->zones[z], &warm_processors[z]);
+    AtcZonedDateTime zdt;
+    atc_zoned_date_time_from_epoch_seconds(&zdt, epoch_seconds[0],
+        &warm_zones[z]);
+  }
+}
+
+/** Number of loops over the zones and months to perform about `ops`. */
+static uint32_t num_loops(const Database *db, uint32_t ops)
+{
+  uint32_t per_loop = (uint32_t) db->num_zones * kNumMonths;
+  return (ops + per_loop - 1) / per_loop;
+}
+
+//---------------------------------------------------------------------------
+// Benchmarks of the conversions, warm and cold.
+//---------------------------------------------------------------------------
+
+enum {
+  kOpFromEpochSeconds,
+  kOpFromPlainDateTime,
+  kOpZonedExtra,
+};
+
+static int64_t run_op(uint8_t op, uint8_t month, const AtcTimeZone *tz)
+{
+  switch (op) {
+    case kOpFromEpochSeconds: {
+      AtcZonedDateTime zdt;
+      atc_zoned_date_time_from_epoch_seconds(&zdt, epoch_seconds[month], tz);
+      return zdt.hour + zdt.offset_seconds;
+    }
+    case kOpFromPlainDateTime: {
+      AtcZonedDateTime zdt;
+      atc_zoned_date_time_from_plain_date_time(
+          &zdt, &plain_date_times[month], tz, kAtcDisambiguateCompatible);
+      return zdt.hour + zdt.offset_seconds;
+    }
+    default: {
+      AtcZonedExtra extra;
+      atc_zoned_extra_from_epoch_seconds(&extra, epoch_seconds[month], tz);
+      return extra.std_offset_seconds + extra.dst_offset_seconds;
+    }
+  }
+}
+
+static void benchmark_warm(
+    Counters *counters,
+    const Database *db,
+    uint8_t op,
+    const char *name,
+    const char *mode)
+{
+  uint32_t loops = num_loops(db, kWarmOps);
+  int64_t sum = 0;
+
+  // Untimed pass, to load the code and the data into the CPU caches.
+  for (uint16_t z = 0; z < db->num_zones; z++) {
+    for (uint8_t month = 0; month < kNumMonths; month++) {
+      sum += run_op(op, month, &warm_zones[z]);
+    }
+  }
+
+  counters_start(counters);
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    for (uint16_t z = 0; z < db->num_zones; z++) {
+      for (uint8_t month = 0; month < kNumMonths; month++) {
+        sum += run_op(op, month, &warm_zones[z]);
+      }
+    }
+  }
+  Measurement m = counters_stop(counters);
+  sink = sum;
+  print_result(name, db, mode, loops * db->num_zones * kNumMonths, &m);
+}
+
+static void benchmark_cold(
+    Counters *counters, const Database *db, uint8_t op, const char *name)
+{
+  uint32_t loops = num_loops(db, kColdOps);
+  atc_processor_init(&cold_processor);
+  int64_t sum = 0;
+  counters_start(counters);
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    for (uint8_t month = 0; month < kNumMonths; month++) {
+      for (uint16_t z = 0; z < db->num_zones; z++) {
+        // Changing the zone of the processor invalidates its transitions.
+        AtcTimeZone tz = atc_time_zone_for_zone_info(
+            db->zones[z], &cold_processor);
+        sum += run_op(op, month, &tz);
+      }
+    }
+  }
+  Measurement m = counters_stop(counters);
+  sink = sum;
+  print_result(name, db, "cold", loops * db->num_zones * kNumMonths, &m);
+}
+
+//---------------------------------------------------------------------------
+// Benchmarks of the registrar and the formatting, warm only.
+//---------------------------------------------------------------------------
+
+/** Look up every zone and link by name, then by id. */
+static void benchmark_registrar_lookups(
+    Counters *counters,
+    const Database *db,
+    const AtcZoneRegistrar *registrar,
+    const char *name_benchmark,
+    const char *id_benchmark)
+{
+  uint32_t loops = kWarmOps / db->num_zones_and_links / 4 + 1;
+  uint32_t ops = loops * db->num_zones_and_links;
+
+  int64_t sum = 0;
+  counters_start(counters);
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    for (uint16_t i = 0; i < db->num_zones_and_links; i++) {
+      const AtcZoneInfo *info = atc_registrar_find_by_name(
+          registrar, db->zones_and_links[i]->name);
+      sum += (info != NULL);
+    }
+  }
+  Measurement m = counters_stop(counters);
+  print_result(name_benchmark, db, "warm", ops, &m);
+
+  counters_start(counters);
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    for (uint16_t i = 0; i < db->num_zones_and_links; i++) {
+      const AtcZoneInfo *info = atc_registrar_find_by_id(
+          registrar, db->zones_and_links[i]->zone_id);
+      sum += (info != NULL);
+    }
+  }
+  m = counters_stop(counters);
+  sink = sum;
+  print_result(id_benchmark, db, "warm", ops, &m);
+}
+
+static void benchmark_registrar(Counters *counters, const Database *db)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(&registrar, db->zones_and_links, db->num_zones_and_links);
+  benchmark_registrar_lookups(counters, db, &registrar,
+      "registrar_find_by_name", "registrar_find_by_id");
+
+  // The same lookups through the Eytzinger index of the zone_ids. main()
+  // checked that the database fits in kMaxZonesAndLinks.
+  static uint32_t keys[kMaxZonesAndLinks];
+  static uint16_t positions[kMaxZonesAndLinks];
+  atc_registrar_build_index(&registrar, keys, positions);
+  benchmark_registrar_lookups(counters, db, &registrar,
+      "registrar_index_find_by_name", "registrar_index_find_by_id");
+
+  // The same lookups through the precomputed perfect hash.
+  atc_registrar_set_hash(&registrar, db->zones_and_links_hash);
+  benchmark_registrar_lookups(counters, db, &registrar,
+      "registrar_hash_find_by_name", "registrar_hash_find_by_id");
+}
+
+/**
+ * Print the AtcZonedDateTime of each zone and month, converted before the
+ * timer starts, so that one operation is exactly one print.
+ */
+static void benchmark_print(Counters *counters, const Database *db)
+{
+  static AtcZonedDateTime zdts[kMaxZones][kNumMonths];
+  for (uint16_t z = 0; z < db->num_zones; z++) {
+    for (uint8_t month = 0; month < kNumMonths; month++) {
+      atc_zoned_date_time_from_epoch_seconds(
+          &zdts[z][month], epoch_seconds[month], &warm_zones[z]);
+    }
+  }
+
+  uint32_t loops = num_loops(db, kWarmOps);
+  char buf[64];
+  AtcStringBuffer sb;
+  atc_buf_init(&sb, buf, sizeof(buf));
+
+  int64_t sum = 0;
+  counters_start(counters);
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    for (uint16_t z = 0; z < db->num_zones; z++) {
+      for (uint8_t month = 0; month < kNumMonths; month++) {
+        atc_buf_reset(&sb);
+        atc_zoned_date_time_print(&sb, &zdts[z][month]);
+        atc_buf_close(&sb);
+        sum += sb.size;
+      }
+    }
+  }
+  Measurement m = counters_stop(counters);
+  sink = sum;
+  print_result("zoned_date_time_print", db, "warm",
+      loops * db->num_zones * kNumMonths, &m);
+}
+
+//---------------------------------------------------------------------------
+
+int main()
+{
+  Counters counters;
+  counters_init(&counters);
+  setup_instants();
+
+  printf("# acetimec %s\n", ACE_TIME_C_VERSION_STRING);
+  printf("benchmark,zonedb,mode,ops,ns_per_op,cycles_per_op,"
+      "cache_misses_per_op\n");
+
+  static const struct {
+    uint8_t op;
+    const char *name;
+  } kConversions[] = {
+    { kOpFromEpochSeconds, "zoned_date_time_from_epoch_seconds" },
+    { kOpFromPlainDateTime, "zoned_date_time_from_plain_date_time" },
+    { kOpZonedExtra, "zoned_extra_from_epoch_seconds" },
+  };
+  enum { kNumConversions = sizeof(kConversions) / sizeof(kConversions[0]) };
+
+  for (uint8_t d = 0; d < kNumDatabases; d++) {
+    const Database *db = &kDatabases[d];
+    if (db->num_zones > kMaxZones) {
+      fprintf(stderr, "Too many zones in %s\n", db->name);
+      return 1;
+    }
+    if (db->num_zones_and_links > kMaxZonesAndLinks) {
+      fprintf(stderr, "Too many zones and links in %s\n", db->name);
+      return 1;
+    }
+    setup_warm(db, true);
+    for (uint8_t c = 0; c < kNumConversions; c++) {
+      benchmark_warm(&counters, db, kConversions[c].op, kConversions[c].name,
+          "warm");
+      benchmark_cold(&counters, db, kConversions[c].op, kConversions[c].name);
+    }
+    benchmark_print(&counters, db);
+    setup_warm(db, false);
+    for (uint8_t c = 0; c < kNumConversions; c++) {
+      benchmark_warm(&counters, db, kConversions[c].op, kConversions[c].name,
+          "warm_transitions");
+    }
+    benchmark_registrar(&counters, db);
+  }
+  return 0;
+}
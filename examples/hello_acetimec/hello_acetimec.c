@@ -43,7 +43,8 @@ void print_dates()
   printf("Epoch seconds: %ld\n", (long) seconds);
 
   // Convert epoch seconds to date/time components for given time zone.
-  AtcTimeZone tzla = {&kAtcZonedb2000ZoneAmerica_Los_Angeles, &processor_la};
+  AtcTimeZone tzla = atc_time_zone_for_zone_info(
+      &kAtcZonedb2000ZoneAmerica_Los_Angeles, &processor_la);
   AtcZonedDateTime zdtla;
   atc_zoned_date_time_from_epoch_seconds(&zdtla, seconds, &tzla);
   if (atc_zoned_date_time_is_error(&zdtla)) { /*error*/ }
@@ -104,7 +105,8 @@ void print_dates()
   printf("==== Convert ZonedDateTime to different time zone\n");
 
   // convert America/Los_Angeles to America/New_York
-  AtcTimeZone tzny = {&kAtcZonedb2000ZoneAmerica_New_York, &processor_ny};
+  AtcTimeZone tzny = atc_time_zone_for_zone_info(
+      &kAtcZonedb2000ZoneAmerica_New_York, &processor_ny);
   AtcZonedDateTime zdtny;
   atc_zoned_date_time_convert(&zdtla, &tzny, &zdtny);
   if (atc_zoned_date_time_is_error(&zdtla)) { /*error*/ }
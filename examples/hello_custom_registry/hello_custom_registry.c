@@ -34,6 +34,12 @@ const uint16_t kCustomRegistrySize = sizeof(kCustomRegistry) /
 // Registrar can be configured with the custom registry.
 AtcZoneRegistrar registrar;
 
+// The custom registry is not sorted by zone id, so the registrar builds an
+// index of the zone ids to avoid a linear search.
+#define NUM_CUSTOM_ZONES (sizeof(kCustomRegistry) / sizeof(const AtcZoneInfo *))
+uint32_t registrar_keys[NUM_CUSTOM_ZONES];
+uint16_t registrar_positions[NUM_CUSTOM_ZONES];
+
 // Two zones are used concurrently in this program.
 AtcZoneProcessor processor1;
 AtcZoneProcessor processor2;
@@ -42,6 +48,11 @@ AtcZoneProcessor processor2;
 void setup()
 {
   atc_registrar_init(&registrar, kCustomRegistry, kCustomRegistrySize);
+  if (atc_registrar_build_index(
+      &registrar, registrar_keys, registrar_positions)) {
+    printf("ERROR: Duplicate zones in the custom registry\n");
+    exit(1);
+  }
   atc_processor_init(&processor1);
   atc_processor_init(&processor2);
 }
@@ -53,7 +64,7 @@ void print_dates()
   // Retrieve America/Los_Angeles.
   const AtcZoneInfo *info = atc_registrar_find_by_name(
       &registrar, "America/Los_Angeles");
-  AtcTimeZone tz1 = {info, &processor1};
+  AtcTimeZone tz1 = atc_time_zone_for_zone_info(info, &processor1);
   AtcZonedDateTime zdt1;
 
   // Convert 2019-03-10 03:00:00 to Los Angeles time zone.
@@ -95,7 +106,7 @@ void print_dates()
 
   // convert America/Los_Angeles to America/New_York
   info = atc_registrar_find_by_name(&registrar, "America/New_York");
-  AtcTimeZone tz2 = {info, &processor2};
+  AtcTimeZone tz2 = atc_time_zone_for_zone_info(info, &processor2);
   AtcZonedDateTime zdt2;
 
   atc_zoned_date_time_convert(&zdt1, &tz2, &zdt2);
@@ -54,7 +54,7 @@ void print_dates()
   // Find America/Los_Angeles by its string name.
   const AtcZoneInfo *info = atc_registrar_find_by_name(
       &registrar, "America/Los_Angeles");
-  AtcTimeZone tz1 = {info, &processor1};
+  AtcTimeZone tz1 = atc_time_zone_for_zone_info(info, &processor1);
   AtcZonedDateTime zdt1;
 
   // Convert 2019-03-10 03:00:00 to Los Angeles time zone.
@@ -98,7 +98,7 @@ void print_dates()
   // Find America/New_York by its 32-bit ZoneId.
   info = atc_registrar_find_by_id(
       &registrar, kAtcZonedb2025ZoneIdAmerica_New_York);
-  AtcTimeZone tz2 = {info, &processor2};
+  AtcTimeZone tz2 = atc_time_zone_for_zone_info(info, &processor2);
   AtcZonedDateTime zdt2;
 
   // Convert America/Los_Angeles to America/New_York
@@ -82,7 +82,8 @@ void print_info(const char *label, AtcPlainDateTime *pdt, AtcTimeZone *tz)
 
 void print_dates()
 {
-  AtcTimeZone tz = {&kAtcZonedb2000ZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcZonedb2000ZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2022, 3, 13, 0, 30, 0};
   print_info("Before gap at 2022-03-13 00:30:00", &pdt, &tz);
@@ -0,0 +1,288 @@
+/*
+Host-side memory footprint of acetimec. The MemoryBenchmark measures the flash
+and static RAM of a whole program on Arduino boards, and the headers of the
+zonedb files contain "Memory (8-bits)" estimates written by the code generator.
+This program reports the actual sizes on the host, for budgeting the memory of
+applications which hold many processors:
+
+1) The sizeof() of the data structures of the library. The structs which point
+to caller-supplied arrays (e.g. AtcZoneManager, AtcPolicyCache) are listed
+together with the element of those arrays.
+
+2) The size of each zone database linked into the program, obtained by walking
+its registries. Eras, policies and strings shared by several zones or links are
+counted once, like the linker does.
+
+The program is compiled twice, against the highres acetimec.a and the midres
+acetimecm.a, since the zonedb structs have a different layout in each flavour.
+The 'make run' target also prints the section sizes of the zonedb object files
+with size(1), which includes the alignment padding between the arrays.
+
+Usage:
+$ make
+$ ./memory_report.out
+# acetimec 0.15.0 highres
+type,sizeof
+AtcZoneProcessor,...
+...
+zonedb,item,count,bytes
+zonedb2025,infos,597,...
+...
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <acetimec.h>
+
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_MID
+  #define FLAVOUR "midres"
+#else
+  #define FLAVOUR "highres"
+#endif
+
+enum {
+  /** Maximum number of distinct pointers of one kind in a zone database. */
+  kMaxUnique = 4096,
+};
+
+typedef struct Database {
+  const char *name;
+  const AtcZoneInfo * const *zones;
+  uint16_t num_zones;
+  const AtcZoneInfo * const *zones_and_links;
+  uint16_t num_zones_and_links;
+} Database;
+
+static const Database kDatabases[] = {
+  {
+    "zonedbtesting",
+    kAtcTestingZoneRegistry, kAtcTestingZoneRegistrySize,
+    kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+  },
+  {
+    "zonedb2000",
+    kAtcZonedb2000ZoneRegistry, kAtcZonedb2000ZoneRegistrySize,
+    kAtcZonedb2000ZoneAndLinkRegistry, kAtcZonedb2000ZoneAndLinkRegistrySize,
+  },
+  {
+    "zonedb2025",
+    kAtcZonedb2025ZoneRegistry, kAtcZonedb2025ZoneRegistrySize,
+    kAtcZonedb2025ZoneAndLinkRegistry, kAtcZonedb2025ZoneAndLinkRegistrySize,
+  },
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+  {
+    "zonedball",
+    kAtcZonedballZoneRegistry, kAtcZonedballZoneRegistrySize,
+    kAtcZonedballZoneAndLinkRegistry, kAtcZonedballZoneAndLinkRegistrySize,
+  },
+#endif
+};
+
+enum {
+  kNumDatabases = sizeof(kDatabases) / sizeof(kDatabases[0]),
+};
+
+//-----------------------------------------------------------------------------
+
+/** A set of distinct pointers, using a linear search. Fast enough here. */
+typedef struct PointerSet {
+  const void *items[kMaxUnique];
+  uint16_t size;
+} PointerSet;
+
+/** Add the pointer, return 1 if it was not already in the set, 0 otherwise. */
+static int pointer_set_add(PointerSet *set, const void *p)
+{
+  if (p == NULL) return 0;
+  for (uint16_t i = 0; i < set->size; i++) {
+    if (set->items[i] == p) return 0;
+  }
+  if (set->size >= kMaxUnique) {
+    fprintf(stderr, "ERROR: kMaxUnique=%d too small\n", kMaxUnique);
+    return 0;
+  }
+  set->items[set->size++] = p;
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+
+#define PRINT_SIZEOF(type) printf("%s,%u\n", #type, (unsigned) sizeof(type))
+
+static void print_sizeofs(void)
+{
+  printf("type,sizeof\n");
+
+  // Zone processing
+  PRINT_SIZEOF(AtcZoneProcessor);
+  PRINT_SIZEOF(AtcTransitionStorage);
+  PRINT_SIZEOF(AtcTransition);
+  PRINT_SIZEOF(AtcMatchingEra);
+  PRINT_SIZEOF(AtcTransitionKeys);
+  PRINT_SIZEOF(AtcSteadyState);
+  PRINT_SIZEOF(AtcProcessorStats);
+  PRINT_SIZEOF(AtcTimeZone);
+
+  // Caches and pools. The arrays of slots and entries are supplied by the
+  // caller, so their elements are listed too.
+  PRINT_SIZEOF(AtcZoneProcessorCache);
+  PRINT_SIZEOF(AtcSharedProcessorCache);
+  PRINT_SIZEOF(AtcSharedProcessorSlot);
+  PRINT_SIZEOF(AtcZoneManager);
+  PRINT_SIZEOF(AtcZoneManagerSlot);
+  PRINT_SIZEOF(AtcPolicyCache);
+  PRINT_SIZEOF(AtcPolicyCacheEntry);
+  PRINT_SIZEOF(AtcTransitionTable);
+  PRINT_SIZEOF(AtcTransitionTableEntry);
+  PRINT_SIZEOF(AtcZoneRegistrar);
+
+  // Date-time types
+  PRINT_SIZEOF(AtcPlainDateTime);
+  PRINT_SIZEOF(AtcOffsetDateTime);
+  PRINT_SIZEOF(AtcZonedDateTime);
+  PRINT_SIZEOF(AtcZonedExtra);
+  PRINT_SIZEOF(AtcDateTuple);
+  PRINT_SIZEOF(AtcEpoch);
+
+  // Zone database records
+  PRINT_SIZEOF(AtcZoneContext);
+  PRINT_SIZEOF(AtcZoneInfo);
+  PRINT_SIZEOF(AtcZoneEra);
+  PRINT_SIZEOF(AtcZonePolicy);
+  PRINT_SIZEOF(AtcZoneRule);
+}
+
+//-----------------------------------------------------------------------------
+
+/** Counts and bytes of each kind of record of a zone database. */
+typedef struct Footprint {
+  size_t num_contexts, context_bytes;
+  size_t num_infos, info_bytes;
+  size_t num_eras, era_bytes;
+  size_t num_policies, policy_bytes;
+  size_t num_rules, rule_bytes;
+  size_t num_registry, registry_bytes;
+  size_t num_names, name_bytes;
+  size_t num_formats, format_bytes;
+  size_t num_letters, letter_bytes;
+  size_t num_fragments, fragment_bytes;
+} Footprint;
+
+static PointerSet contexts;
+static PointerSet eras;
+static PointerSet policies;
+static PointerSet formats;
+
+static void add_context(Footprint *fp, const AtcZoneContext *context)
+{
+  if (!pointer_set_add(&contexts, context)) return;
+
+  fp->num_contexts++;
+  fp->context_bytes += sizeof(AtcZoneContext);
+
+  fp->num_letters += context->num_letters;
+  fp->letter_bytes += context->num_letters * sizeof(const char *);
+  for (uint8_t i = 0; i < context->num_letters; i++) {
+    fp->letter_bytes += strlen(context->letters[i]) + 1;
+  }
+
+  fp->num_fragments += context->num_fragments;
+  fp->fragment_bytes += context->num_fragments * sizeof(const char *);
+  for (uint8_t i = 0; i < context->num_fragments; i++) {
+    if (context->fragments[i] == NULL) continue;
+    fp->fragment_bytes += strlen(context->fragments[i]) + 1;
+  }
+}
+
+static void add_policy(Footprint *fp, const AtcZonePolicy *policy)
+{
+  if (!pointer_set_add(&policies, policy)) return;
+
+  fp->num_policies++;
+  fp->policy_bytes += sizeof(AtcZonePolicy);
+  fp->num_rules += policy->num_rules;
+  fp->rule_bytes += policy->num_rules * sizeof(AtcZoneRule);
+}
+
+static void add_eras(Footprint *fp, const AtcZoneInfo *info)
+{
+  if (!pointer_set_add(&eras, info->eras)) return;
+
+  fp->num_eras += info->num_eras;
+  fp->era_bytes += info->num_eras * sizeof(AtcZoneEra);
+  for (uint8_t i = 0; i < info->num_eras; i++) {
+    const AtcZoneEra *era = &info->eras[i];
+    if (era->zone_policy) add_policy(fp, era->zone_policy);
+    if (pointer_set_add(&formats, era->format)) {
+      fp->num_formats++;
+      fp->format_bytes += strlen(era->format) + 1;
+    }
+  }
+}
+
+static void compute_footprint(const Database *db, Footprint *fp)
+{
+  memset(fp, 0, sizeof(*fp));
+  contexts.size = 0;
+  eras.size = 0;
+  policies.size = 0;
+  formats.size = 0;
+
+  // Both registries are linked in, each an array of pointers.
+  fp->num_registry = db->num_zones + db->num_zones_and_links;
+  fp->registry_bytes = fp->num_registry * sizeof(const AtcZoneInfo *);
+
+  for (uint16_t i = 0; i < db->num_zones_and_links; i++) {
+    const AtcZoneInfo *info = db->zones_and_links[i];
+    fp->num_infos++;
+    fp->info_bytes += sizeof(AtcZoneInfo);
+    fp->num_names++;
+    fp->name_bytes += strlen(info->name) + 1;
+    add_context(fp, info->zone_context);
+    add_eras(fp, info);
+  }
+}
+
+static void print_item(
+    const char *db, const char *item, size_t count, size_t bytes)
+{
+  printf("%s,%s,%u,%u\n", db, item, (unsigned) count, (unsigned) bytes);
+}
+
+static void print_footprints(void)
+{
+  printf("zonedb,item,count,bytes\n");
+  for (int i = 0; i < kNumDatabases; i++) {
+    const Database *db = &kDatabases[i];
+    Footprint fp;
+    compute_footprint(db, &fp);
+
+    print_item(db->name, "contexts", fp.num_contexts, fp.context_bytes);
+    print_item(db->name, "infos", fp.num_infos, fp.info_bytes);
+    print_item(db->name, "eras", fp.num_eras, fp.era_bytes);
+    print_item(db->name, "policies", fp.num_policies, fp.policy_bytes);
+    print_item(db->name, "rules", fp.num_rules, fp.rule_bytes);
+    print_item(db->name, "registry", fp.num_registry, fp.registry_bytes);
+    print_item(db->name, "names", fp.num_names, fp.name_bytes);
+    print_item(db->name, "formats", fp.num_formats, fp.format_bytes);
+    print_item(db->name, "letters", fp.num_letters, fp.letter_bytes);
+    print_item(db->name, "fragments", fp.num_fragments, fp.fragment_bytes);
+
+    size_t total = fp.context_bytes + fp.info_bytes + fp.era_bytes
+        + fp.policy_bytes + fp.rule_bytes + fp.registry_bytes
+        + fp.name_bytes + fp.format_bytes + fp.letter_bytes
+        + fp.fragment_bytes;
+    print_item(db->name, "total", 0, total);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void)
+{
+  printf("# acetimec %s %s\n", ACE_TIME_C_VERSION_STRING, FLAVOUR);
+  print_sizeofs();
+  printf("\n");
+  print_footprints();
+  return 0;
+}
@@ -0,0 +1,109 @@
+/*
+Multiple threads converting timestamps in the same time zones through a single
+AtcSharedProcessorCache. Each thread owns only a scratch AtcZoneProcessor,
+which is used when the cache cannot provide the year. The results of every
+thread are verified against a private AtcZoneProcessor.
+
+Usage:
+$ make
+$ ./shared_cache_threads.out
+4 threads, 600000 lookups, 0 mismatches
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <acetimec.h>
+
+enum {
+  kNumThreads = 4,
+  kNumSlots = 64,
+  kNumLookups = 150000,
+};
+
+static const AtcZoneInfo * const kZones[] = {
+  &kAtcZonedb2025ZoneAmerica_Los_Angeles,
+  &kAtcZonedb2025ZoneAmerica_New_York,
+  &kAtcZonedb2025ZoneEurope_London,
+  &kAtcZonedb2025ZoneAustralia_Sydney,
+};
+
+enum { kNumZones = sizeof(kZones) / sizeof(kZones[0]) };
+
+static AtcSharedProcessorSlot slots[kNumSlots];
+static AtcSharedProcessorCache cache;
+
+typedef struct Worker {
+  pthread_t thread;
+  uint32_t seed;
+  uint32_t mismatches;
+} Worker;
+
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed;
+}
+
+static void *run_worker(void *arg)
+{
+  Worker *worker = (Worker *) arg;
+  AtcZoneProcessor scratch;
+  atc_processor_init(&scratch);
+  AtcZoneProcessor check;
+  atc_processor_init(&check);
+
+  // Random timestamps within [2000, 2040).
+  AtcPlainDateTime pdt = {2000, 1, 1, 0, 0, 0};
+  atc_time_t start = atc_plain_date_time_to_epoch_seconds(&pdt);
+  pdt.year = 2040;
+  atc_time_t until = atc_plain_date_time_to_epoch_seconds(&pdt);
+  uint32_t range = (uint32_t) (until - start);
+
+  for (uint32_t i = 0; i < kNumLookups; i++) {
+    const AtcZoneInfo *info = kZones[next_random(&worker->seed) % kNumZones];
+    atc_time_t t = start + (atc_time_t) (next_random(&worker->seed) % range);
+
+    AtcFindResult actual;
+    char abbrev[kAtcAbbrevSize];
+    atc_shared_cache_find_by_epoch_seconds(
+        &cache, &scratch, info, t, &actual, abbrev);
+
+    AtcFindResult expected;
+    atc_processor_init_for_zone_info(&check, info);
+    atc_processor_find_by_epoch_seconds(&check, t, &expected);
+    if (expected.type != actual.type
+        || expected.std_offset_seconds != actual.std_offset_seconds
+        || expected.dst_offset_seconds != actual.dst_offset_seconds
+        || strcmp(expected.abbrev, actual.abbrev) != 0) {
+      worker->mismatches++;
+    }
+  }
+  return NULL;
+}
+
+int main(void)
+{
+  atc_shared_cache_init(&cache, slots, kNumSlots);
+
+  Worker workers[kNumThreads];
+  for (int i = 0; i < kNumThreads; i++) {
+    workers[i].seed = 12345u * (uint32_t) (i + 1);
+    workers[i].mismatches = 0;
+    pthread_create(&workers[i].thread, NULL, run_worker, &workers[i]);
+  }
+
+  uint32_t mismatches = 0;
+  for (int i = 0; i < kNumThreads; i++) {
+    pthread_join(workers[i].thread, NULL);
+    mismatches += workers[i].mismatches;
+  }
+
+  printf("%d threads, %lu lookups, %lu mismatches\n",
+      kNumThreads,
+      (unsigned long) kNumThreads * kNumLookups,
+      (unsigned long) mismatches);
+  return (mismatches == 0) ? 0 : 1;
+}
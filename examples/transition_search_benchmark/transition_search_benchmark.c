@@ -0,0 +1,251 @@
+/*
+Microbenchmark of the linear finders of AtcTransitionStorage
+(atc_transition_storage_find_for_seconds() and
+atc_transition_storage_find_for_date_time()) versus the key-based finders of
+AtcTransitionKeys (atc_transition_keys_find_for_unix_seconds() and
+atc_transition_keys_find_for_date_time()). The 'direct' column is
+atc_transition_storage_find_for_unix_seconds(), used by the processor instead of
+the keys when ACE_TIME_C_TRANSITION_KEYS is 0.
+
+The benchmark selects the (zone, year) pairs of kAtcZonedballZoneRegistry
+which use the largest part of the buffer of kAtcTransitionStorageSize
+transitions, because these are the zones with the most active transitions,
+where the linear scan is the most expensive. Each finder is then called
+repeatedly with probes around the start time and the wall time of every
+active transition.
+
+Usage:
+$ make
+$ ./transition_search_benchmark.out
+Selected 64 (zone, year) pairs using 7 of 8 transitions (5 active)
+find_for_seconds: linear 86.0 ns; direct 79.5 ns; keys 19.0 ns
+find_for_date_time: linear 66.4 ns; keys 27.0 ns
+*/
+
+#include <stdio.h>
+#include <time.h> // clock()
+#include <acetimec.h>
+
+enum {
+  kMaxCases = 64,
+  kNumProbes = 4,
+  kNumLoops = 20000,
+};
+
+typedef struct Case {
+  const AtcZoneInfo *zone_info;
+  int16_t year;
+} Case;
+
+static Case cases[kMaxCases];
+static uint8_t num_cases;
+
+static AtcZoneProcessor processors[kMaxCases];
+
+/**
+ * Search keys of the processors, built here so that the benchmark does not
+ * depend on ACE_TIME_C_TRANSITION_KEYS.
+ */
+static AtcTransitionKeys keys[kMaxCases];
+
+/**
+ * Probes in epoch seconds, unix seconds and wall time around each active
+ * transition.
+ */
+static atc_time_t seconds_probes[kMaxCases][kAtcTransitionStorageSize]
+    [kNumProbes];
+static int64_t unix_probes[kMaxCases][kAtcTransitionStorageSize]
+    [kNumProbes];
+static AtcPlainDateTime pdt_probes[kMaxCases][kAtcTransitionStorageSize]
+    [kNumProbes];
+
+/** Sink for the results, to prevent the compiler from removing the loops. */
+static volatile uintptr_t sink;
+
+/**
+ * Find the (zone, year) pairs which allocate the most transitions in the
+ * AtcTransitionStorage, and among those, the ones with the most active
+ * transitions. Returns the number of allocated transitions.
+ */
+static uint8_t select_cases(uint8_t *max_active_out)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  uint8_t max_alloc = 0;
+  uint8_t max_active = 0;
+  num_cases = 0;
+  for (uint16_t i = 0; i < kAtcZonedballZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcZonedballZoneRegistry[i];
+    atc_processor_init_for_zone_info(&processor, info);
+    for (int16_t year = 1990; year < 2110; year++) {
+      atc_processor_init_for_year(&processor, year);
+      uint8_t num_alloc = processor.transition_storage.alloc_size;
+      uint8_t num_active = processor.transition_storage.index_free;
+      if (num_alloc > max_alloc
+          || (num_alloc == max_alloc && num_active > max_active)) {
+        max_alloc = num_alloc;
+        max_active = num_active;
+        num_cases = 0;
+      }
+      if (num_alloc == max_alloc && num_active == max_active
+          && num_cases < kMaxCases) {
+        cases[num_cases].zone_info = info;
+        cases[num_cases].year = year;
+        num_cases++;
+      }
+    }
+  }
+  *max_active_out = max_active;
+  return max_alloc;
+}
+
+/** Initialize the processors of the selected cases, and their probes. */
+static void setup_probes(void)
+{
+  static const int32_t deltas[kNumProbes] = {-3600, -1, 0, 3600};
+
+  for (uint8_t i = 0; i < num_cases; i++) {
+    atc_processor_init(&processors[i]);
+    atc_processor_init_for_zone_info(&processors[i], cases[i].zone_info);
+    atc_processor_init_for_year(&processors[i], cases[i].year);
+
+    const AtcTransitionStorage *ts = &processors[i].transition_storage;
+    atc_transition_keys_init(&keys[i], ts);
+    for (uint8_t j = 0; j < ts->index_free; j++) {
+      const AtcTransition *t = ts->transitions[j];
+      const AtcDateTuple *st = &t->start_dt;
+      atc_time_t wall_seconds = (atc_time_t) 86400
+          * atc_plain_date_to_epoch_days(st->year, st->month, st->day)
+          + st->seconds;
+      for (uint8_t d = 0; d < kNumProbes; d++) {
+        seconds_probes[i][j][d] = t->start_epoch_seconds + deltas[d];
+        unix_probes[i][j][d] = t->start_unix_seconds + deltas[d];
+        atc_plain_date_time_from_epoch_seconds(
+            &pdt_probes[i][j][d], wall_seconds + deltas[d]);
+      }
+    }
+  }
+}
+
+/** Return the elapsed nanos per call. */
+static double elapsed_nanos(clock_t start, clock_t end, uint32_t num_calls)
+{
+  return (double) (end - start) / CLOCKS_PER_SEC * 1e9 / num_calls;
+}
+
+static void benchmark_find_for_seconds(void)
+{
+  uint32_t num_calls = 0;
+  uintptr_t sum = 0;
+
+  clock_t start = clock();
+  for (uint16_t loop = 0; loop < kNumLoops; loop++) {
+    for (uint8_t i = 0; i < num_cases; i++) {
+      const AtcTransitionStorage *ts = &processors[i].transition_storage;
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        for (uint8_t d = 0; d < kNumProbes; d++) {
+          AtcTransitionForSeconds r = atc_transition_storage_find_for_seconds(
+              ts, seconds_probes[i][j][d]);
+          sum += (uintptr_t) r.curr + r.fold;
+          num_calls++;
+        }
+      }
+    }
+  }
+  clock_t end = clock();
+  double linear = elapsed_nanos(start, end, num_calls);
+
+  start = clock();
+  for (uint16_t loop = 0; loop < kNumLoops; loop++) {
+    for (uint8_t i = 0; i < num_cases; i++) {
+      const AtcTransitionStorage *ts = &processors[i].transition_storage;
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        for (uint8_t d = 0; d < kNumProbes; d++) {
+          AtcTransitionForSeconds r =
+              atc_transition_keys_find_for_unix_seconds(
+                  &keys[i], ts, unix_probes[i][j][d]);
+          sum += (uintptr_t) r.curr + r.fold;
+        }
+      }
+    }
+  }
+  end = clock();
+  double keyed = elapsed_nanos(start, end, num_calls);
+
+  start = clock();
+  for (uint16_t loop = 0; loop < kNumLoops; loop++) {
+    for (uint8_t i = 0; i < num_cases; i++) {
+      const AtcTransitionStorage *ts = &processors[i].transition_storage;
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        for (uint8_t d = 0; d < kNumProbes; d++) {
+          AtcTransitionForSeconds r =
+              atc_transition_storage_find_for_unix_seconds(
+                  ts, unix_probes[i][j][d]);
+          sum += (uintptr_t) r.curr + r.fold;
+        }
+      }
+    }
+  }
+  end = clock();
+  double direct = elapsed_nanos(start, end, num_calls);
+  sink = sum;
+
+  printf("find_for_seconds: linear %.1f ns; direct %.1f ns; keys %.1f ns\n",
+      linear, direct, keyed);
+}
+
+static void benchmark_find_for_date_time(void)
+{
+  uint32_t num_calls = 0;
+  uintptr_t sum = 0;
+
+  clock_t start = clock();
+  for (uint16_t loop = 0; loop < kNumLoops; loop++) {
+    for (uint8_t i = 0; i < num_cases; i++) {
+      const AtcTransitionStorage *ts = &processors[i].transition_storage;
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        for (uint8_t d = 0; d < kNumProbes; d++) {
+          AtcTransitionForDateTime r =
+              atc_transition_storage_find_for_date_time(
+                  ts, &pdt_probes[i][j][d]);
+          sum += (uintptr_t) r.curr + r.num;
+          num_calls++;
+        }
+      }
+    }
+  }
+  clock_t end = clock();
+  double linear = elapsed_nanos(start, end, num_calls);
+
+  start = clock();
+  for (uint16_t loop = 0; loop < kNumLoops; loop++) {
+    for (uint8_t i = 0; i < num_cases; i++) {
+      const AtcTransitionStorage *ts = &processors[i].transition_storage;
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        for (uint8_t d = 0; d < kNumProbes; d++) {
+          AtcTransitionForDateTime r = atc_transition_keys_find_for_date_time(
+              &keys[i], ts, &pdt_probes[i][j][d]);
+          sum += (uintptr_t) r.curr + r.num;
+        }
+      }
+    }
+  }
+  end = clock();
+  double keyed = elapsed_nanos(start, end, num_calls);
+  sink = sum;
+
+  printf("find_for_date_time: linear %.1f ns; keys %.1f ns\n", linear, keyed);
+}
+
+int main()
+{
+  uint8_t max_active;
+  uint8_t max_alloc = select_cases(&max_active);
+  setup_probes();
+  printf("Selected %d (zone, year) pairs using %d of %d transitions "
+      "(%d active)\n",
+      num_cases, max_alloc, kAtcTransitionStorageSize, max_active);
+  benchmark_find_for_seconds();
+  benchmark_find_for_date_time();
+  return 0;
+}
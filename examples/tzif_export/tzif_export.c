@@ -0,0 +1,148 @@
+/*
+Exports every zone and link of a compiled zone database as TZif files under a
+directory, like the /usr/share/zoneinfo tree created by zic, then opens each
+file with mmap() and verifies that it gives the same UTC offsets and
+abbreviations as the compiled zone, from the start year until 2100, using the
+POSIX TZ string of the footer after the last transition. The highres version
+exports zonedball, the midres version exports zonedb2025.
+
+Usage:
+$ make
+$ ./tzif_export.out write zoneinfo 1800 2100
+Wrote 597 zones and links, 683618 bytes in 591.3 ms
+$ ./tzif_export.out check zoneinfo 1800
+Checked 597 zones and links: 0 errors
+*/
+
+// Required by mkdir() with -std=c11.
+#if ! defined(_POSIX_C_SOURCE) && ! defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h> // atoi()
+#include <string.h>
+#include <sys/stat.h> // mkdir()
+#include <time.h> // clock()
+#include <acetimec.h>
+
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_MID
+  #define REGISTRY kAtcZonedb2025ZoneAndLinkRegistry
+  #define REGISTRY_SIZE kAtcZonedb2025ZoneAndLinkRegistrySize
+#else
+  #define REGISTRY kAtcZonedballZoneAndLinkRegistry
+  #define REGISTRY_SIZE kAtcZonedballZoneAndLinkRegistrySize
+#endif
+
+/** AtcTzifWriteCallback into a FILE. */
+static int8_t write_to_file(void *context, const uint8_t *data, size_t size)
+{
+  FILE *file = (FILE *) context;
+  return (fwrite(data, 1, size, file) == size) ? kAtcErrOk : kAtcErrGeneric;
+}
+
+/** Create the directories of the path, e.g. "zoneinfo/America". */
+static void make_parent_dirs(char *path)
+{
+  for (char *p = strchr(path, '/'); p != NULL; p = strchr(p + 1, '/')) {
+    *p = '\0';
+    mkdir(path, 0755);
+    *p = '/';
+  }
+}
+
+static int write_dir(const char *dir, int16_t start_year, int16_t until_year)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  long total_size = 0;
+  int errors = 0;
+
+  clock_t start = clock();
+  for (uint16_t i = 0; i < REGISTRY_SIZE; i++) {
+    const AtcZoneInfo *info = REGISTRY[i];
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", dir, atc_zone_info_zone_name(info));
+    make_parent_dirs(path);
+    FILE *file = fopen(path, "wb");
+    if (file == NULL || atc_tzif_write(info, &processor, start_year,
+        until_year, write_to_file, file)) {
+      printf("ERROR: cannot write '%s'\n", path);
+      errors++;
+    } else {
+      total_size += ftell(file);
+    }
+    if (file) fclose(file);
+  }
+  clock_t end = clock();
+
+  printf("Wrote %d zones and links, %ld bytes in %.1f ms\n",
+      REGISTRY_SIZE, total_size, (end - start) * 1000.0 / CLOCKS_PER_SEC);
+  return errors ? 1 : 0;
+}
+
+/** Return the number of instants with a different result in the 2 zones. */
+static int check_zone(
+    const AtcTzif *tzif,
+    const AtcZoneInfo *info,
+    AtcZoneProcessor *processor,
+    int16_t start_year)
+{
+  AtcTimeZone tza = atc_time_zone_for_tzif(tzif);
+  AtcTimeZone tzb = atc_time_zone_for_zone_info(info, processor);
+  int64_t start = (int64_t) 86400
+      * atc_plain_date_to_unix_days(start_year, 1, 1);
+  int errors = 0;
+  // Every 7 days and 1 hour until 2100.
+  for (int64_t t = start; t < 4102444800; t += 7 * 86400 + 3600) {
+    AtcZonedExtra a;
+    AtcZonedExtra b;
+    atc_zoned_extra_from_unix_seconds(&a, t, &tza);
+    atc_zoned_extra_from_unix_seconds(&b, t, &tzb);
+    if (a.std_offset_seconds + a.dst_offset_seconds
+            != b.std_offset_seconds + b.dst_offset_seconds
+        || strcmp(a.abbrev, b.abbrev) != 0) {
+      errors++;
+    }
+  }
+  return errors;
+}
+
+static int check_dir(const char *dir, int16_t start_year)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  int errors = 0;
+  for (uint16_t i = 0; i < REGISTRY_SIZE; i++) {
+    const AtcZoneInfo *info = REGISTRY[i];
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", dir, atc_zone_info_zone_name(info));
+    AtcTzif tzif;
+    if (atc_tzif_open_file(&tzif, path)) {
+      printf("ERROR: cannot open '%s'\n", path);
+      errors++;
+      continue;
+    }
+    int n = check_zone(&tzif, info, &processor, start_year);
+    if (n > 0) {
+      printf("ERROR: %s: %d differences\n", atc_zone_info_zone_name(info), n);
+      errors++;
+    }
+    atc_tzif_close_file(&tzif);
+  }
+  printf("Checked %d zones and links: %d errors\n", REGISTRY_SIZE, errors);
+  return errors ? 1 : 0;
+}
+
+int main(int argc, const char * const *argv)
+{
+  if (argc == 5 && strcmp(argv[1], "write") == 0) {
+    return write_dir(argv[2], atoi(argv[3]), atoi(argv[4]));
+  } else if (argc == 4 && strcmp(argv[1], "check") == 0) {
+    return check_dir(argv[2], atoi(argv[3]));
+  }
+  fprintf(stderr,
+      "Usage: tzif_export.out write dir start_year until_year\n"
+      "       tzif_export.out check dir start_year\n");
+  return 1;
+}
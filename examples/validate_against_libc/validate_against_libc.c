@@ -1,6 +1,9 @@
 /*
  * A program to compare the DST transitions calculated by acetimec with the
  * standard C library.
+ *
+ * With the `--tzif` flag, the zones are read from the TZif files of the host
+ * using atc_tzif_open_zone(), instead of the compiled zonedball database.
  */
 #include <stdio.h> // printf()
 #include <stdlib.h> // setenv()
@@ -67,6 +70,7 @@ void print_time(time_t epoch_seconds) {
 const int16_t start_year = 1800;
 const int16_t until_year = 2100;
 AtcZoneProcessor processor;
+bool use_tzif = false;
 
 void setup()
 {
@@ -113,22 +117,31 @@ int check_zone_names()
 
 //-----------------------------------------------------------------------------
 
-int check_epoch_seconds(const AtcTimeZone *tz, atc_time_t epoch_seconds)
+const char *zone_name(const AtcTimeZone *tz)
 {
-  // Convert epoch seconds to ZonedDateTime using acetimec
+  return (tz->type == kAtcTimeZoneTypeTzif)
+      ? tz->tzif->name
+      : tz->zone_info->name;
+}
+
+int check_unix_seconds(const AtcTimeZone *tz, int64_t unix_seconds)
+{
+  // Convert unix seconds to ZonedDateTime using acetimec. Unix seconds cover
+  // the entire [start_year, until_year) range without changing the epoch.
   struct AtcZonedDateTime zdt;
-  atc_zoned_date_time_from_epoch_seconds(&zdt, epoch_seconds, tz);
+  atc_zoned_date_time_from_unix_seconds(&zdt, unix_seconds, tz);
+  long long seconds = unix_seconds;
   if (atc_zoned_date_time_is_error(&zdt)) {
-    printf("ERROR: Zone %s: epoch seconds=%d: "
+    printf("ERROR: Zone %s: unix_seconds=%lld: "
         "unable to create AtcZoneDateTime\n",
-        tz->zone_info->name, epoch_seconds);
+        zone_name(tz), seconds);
     return kAtcErrGeneric;
   }
 
-  // Convert epoch seconds to date-time components using C libc.
+  // Convert unix seconds to date-time components using C libc.
   struct tm tms;
-  time_t unix_seconds = atc_unix_seconds_from_epoch_seconds(epoch_seconds);
-  localtime_r(&unix_seconds, &tms);
+  time_t libc_seconds = unix_seconds;
+  localtime_r(&libc_seconds, &tms);
   int year = tms.tm_year + 1900;
   int month = tms.tm_mon + 1;
   int day = tms.tm_mday;
@@ -139,40 +152,40 @@ int check_epoch_seconds(const AtcTimeZone *tz, atc_time_t epoch_seconds)
 
   // Verify that they are same.
   if (year != zdt.year) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched year (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, year, zdt.year);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched year (%d != %d)\n",
+        zone_name(tz), seconds, year, zdt.year);
     return kAtcErrGeneric;
   }
   if (month != zdt.month) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched month (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, month, zdt.month);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched month (%d != %d)\n",
+        zone_name(tz), seconds, month, zdt.month);
     return kAtcErrGeneric;
   }
   if (day != zdt.day) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched day (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, day, zdt.day);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched day (%d != %d)\n",
+        zone_name(tz), seconds, day, zdt.day);
     return kAtcErrGeneric;
   }
   if (hour != zdt.hour) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched hour (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, hour, zdt.hour);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched hour (%d != %d)\n",
+        zone_name(tz), seconds, hour, zdt.hour);
     return kAtcErrGeneric;
   }
   if (minute != zdt.minute) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched minute (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, minute, zdt.minute);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched minute (%d != %d)\n",
+        zone_name(tz), seconds, minute, zdt.minute);
     return kAtcErrGeneric;
   }
   if (second != zdt.second) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; mismatched second (%d != %d)\n",
-        tz->zone_info->name, epoch_seconds, second, zdt.second);
+    printf("ERROR: Zone %s: unix_seconds=%lld; mismatched second (%d != %d)\n",
+        zone_name(tz), seconds, second, zdt.second);
     return kAtcErrGeneric;
   }
   if (offset != (long) zdt.offset_seconds) {
-    printf("ERROR: Zone %s: epoch_seconds=%d; "
+    printf("ERROR: Zone %s: unix_seconds=%lld; "
         "mismatched UTC offset (%ld != %ld)\n",
-        tz->zone_info->name,
-        epoch_seconds,
+        zone_name(tz),
+        seconds,
         offset,
         (long) zdt.offset_seconds);
     return kAtcErrGeneric;
@@ -182,47 +195,36 @@ int check_epoch_seconds(const AtcTimeZone *tz, atc_time_t epoch_seconds)
 
 int check_transitions(const AtcTimeZone *tz)
 {
-  set_time_zone(tz->zone_info->name);
+  set_time_zone(zone_name(tz));
 
   int err = 0;
   int num_transitions = 0;
-  for (int16_t base = start_year; base < until_year; base += 100) {
-    int16_t epoch = base + 50;
-    atc_set_current_epoch_year(epoch);
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
-
-    for (int16_t year = base; year < base + 100 && year < until_year; ++year) {
-      atc_processor_init_for_year(tz->zone_processor, year);
-
-      struct AtcTransitionStorage *ts = &tz->zone_processor->transition_storage;
-      struct AtcTransition **begin =
-          atc_transition_storage_get_active_pool_begin(ts);
-      struct AtcTransition **end =
-          atc_transition_storage_get_active_pool_end(ts);
-      for (struct AtcTransition **t = begin; t != end; ++t) {
-        // Skip if start year of transition does not match the current. This can
-        // happen because we generate transitions over a 14-month interval
-        // spanning the current year.
-        struct AtcDateTuple *start = &((*t)->start_dt);
-        if (start->year != year) continue;
-
-        // Skip if the UTC year bleeds under or over the boundaries.
-        if ((*t)->transition_time_u.year < start_year) continue;
-        if ((*t)->transition_time_u.year >= until_year) continue;
-
-        num_transitions++;
-        atc_time_t epoch_seconds = (*t)->start_epoch_seconds;
-
-        // Add a test data just before the transition
-        err |= check_epoch_seconds(tz, epoch_seconds - 1);
-        if (err) continue;
-
-        // Add a test data at the transition itself (which will
-        // normally be shifted forward or backwards).
-        err |= check_epoch_seconds(tz, epoch_seconds);
-        if (err) continue;
-      }
-    }
+  int64_t start = (int64_t) 86400
+      * atc_plain_date_to_unix_days(start_year, 1, 1);
+  int64_t until = (int64_t) 86400
+      * atc_plain_date_to_unix_days(until_year, 1, 1);
+  AtcTransitionIterator it;
+  if (tz->type != kAtcTimeZoneTypeTzif) {
+    atc_transition_iterator_init(
+        &it, tz->zone_processor, tz->zone_info, start, until);
+  }
+  AtcZoneTransition t;
+  int64_t prev = start - 1;
+  while ((tz->type == kAtcTimeZoneTypeTzif)
+      ? (atc_time_zone_next_transition(tz, prev, &t)
+          && t.start_unix_seconds < until)
+      : atc_transition_iterator_next(&it, &t)) {
+    num_transitions++;
+    prev = t.start_unix_seconds;
+
+    // Add a test data just before the transition
+    err |= check_unix_seconds(tz, t.start_unix_seconds - 1);
+    if (err) continue;
+
+    // Add a test data at the transition itself (which will
+    // normally be shifted forward or backwards).
+    err |= check_unix_seconds(tz, t.start_unix_seconds);
+    if (err) continue;
   }
   printf("Transitions: %d; ", num_transitions);
 
@@ -233,33 +235,28 @@ int check_transitions(const AtcTimeZone *tz)
 int check_samples(const AtcTimeZone *tz)
 {
   int num_samples = 0;
-  for (int16_t base = start_year; base < until_year; base += 100) {
-    int16_t epoch = base + 50;
-    atc_set_current_epoch_year(epoch);
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
-    for (int16_t year = base; year < base + 100 && year < until_year; year++) {
-      for (uint8_t month = 1; month <= 12; month++) {
-        for (uint8_t day = 1; day <= 28; day += 3) { // every 3rd, for speed
-          AtcZonedDateTime zdt;
-          AtcPlainDateTime pdt = {year, month, day, 2, 0, 0};
-
-          atc_zoned_date_time_from_plain_date_time(
-              &zdt, &pdt, tz, kAtcDisambiguateCompatible);
-          if (atc_zoned_date_time_is_error(&zdt)) {
-            char s[64];
-            AtcStringBuffer sb;
-            atc_buf_init(&sb, s, sizeof(s));
-            atc_plain_date_time_print(&sb, &pdt);
-            atc_buf_close(&sb);
-            printf("ERROR: Zone %s: unable to create AtcZoneDateTime for %s\n",
-                tz->zone_info->name, sb.p);
-            return kAtcErrGeneric;
-          }
-
-          num_samples++;
-          atc_time_t epoch_seconds = atc_zoned_date_time_to_epoch_seconds(&zdt);
-          check_epoch_seconds(tz, epoch_seconds);
+  for (int16_t year = start_year; year < until_year; year++) {
+    for (uint8_t month = 1; month <= 12; month++) {
+      for (uint8_t day = 1; day <= 28; day += 3) { // every 3rd, for speed
+        AtcZonedDateTime zdt;
+        AtcPlainDateTime pdt = {year, month, day, 2, 0, 0};
+
+        atc_zoned_date_time_from_plain_date_time(
+            &zdt, &pdt, tz, kAtcDisambiguateCompatible);
+        if (atc_zoned_date_time_is_error(&zdt)) {
+          char s[64];
+          AtcStringBuffer sb;
+          atc_buf_init(&sb, s, sizeof(s));
+          atc_plain_date_time_print(&sb, &pdt);
+          atc_buf_close(&sb);
+          printf("ERROR: Zone %s: unable to create AtcZoneDateTime for %s\n",
+              zone_name(tz), sb.p);
+          return kAtcErrGeneric;
         }
+
+        num_samples++;
+        int64_t unix_seconds = atc_zoned_date_time_to_unix_seconds(&zdt);
+        check_unix_seconds(tz, unix_seconds);
       }
     }
   }
@@ -276,16 +273,27 @@ int check_date_components()
   for (int i = 0; i < kAtcZonedballZoneRegistrySize; i++) {
     const AtcZoneInfo *info = kAtcZonedballZoneRegistry[i];
     printf("%d: Zone %s: ", i, info->name);
-    AtcTimeZone tz = {info, &processor};
+    AtcTimeZone tz = atc_time_zone_for_zone_info(info, &processor);
+    AtcTzif tzif;
+    if (use_tzif) {
+      if (atc_tzif_open_zone(&tzif, info->name)) {
+        printf("ERROR: unable to open the TZif file\n");
+        err |= 1;
+        continue;
+      }
+      tz = atc_time_zone_for_tzif(&tzif);
+    }
 
     err |= check_transitions(&tz);
     err |= check_samples(&tz);
+    if (use_tzif) atc_tzif_close_file(&tzif);
   }
   return err;
 }
 
-int main()
+int main(int argc, const char * const *argv)
 {
+  use_tzif = (argc > 1 && strcmp(argv[1], "--tzif") == 0);
   setup();
   int err = check_zone_names();
   err |= check_date_components();
@@ -0,0 +1,133 @@
+/*
+Writes a compiled zone database into the binary format of zone_db.h, then
+loads the file with mmap() and verifies that every zone and link of the file
+gives the same UTC offsets and abbreviations as the compiled zone, from 1800 to
+2100. The highres version writes zonedball, the midres version writes
+zonedb2025, since the rules are stored in the layout of each resolution.
+
+Usage:
+$ make
+$ ./zone_db_file.out write zonedball.atzd
+Wrote 597 zones and links, 91256 bytes
+$ ./zone_db_file.out check zonedball.atzd
+Loaded 597 zones and links in 0.158 ms
+Checked 597 zones and links: 0 errors
+*/
+
+#include <stdio.h>
+#include <stdlib.h> // aligned_alloc(), free()
+#include <string.h>
+#include <time.h> // clock()
+#include <acetimec.h>
+
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_MID
+  #define REGISTRY kAtcZonedb2025ZoneAndLinkRegistry
+  #define REGISTRY_SIZE kAtcZonedb2025ZoneAndLinkRegistrySize
+#else
+  #define REGISTRY kAtcZonedballZoneAndLinkRegistry
+  #define REGISTRY_SIZE kAtcZonedballZoneAndLinkRegistrySize
+#endif
+
+static int write_file(const char *path)
+{
+  size_t size = atc_zone_db_write_size(REGISTRY, REGISTRY_SIZE);
+  if (size == 0) {
+    fprintf(stderr, "ERROR: cannot write the registry\n");
+    return 1;
+  }
+  void *buffer = aligned_alloc(kAtcZoneDbAlign, size);
+  size = atc_zone_db_write(REGISTRY, REGISTRY_SIZE, buffer, size);
+
+  FILE *file = fopen(path, "wb");
+  if (file == NULL || fwrite(buffer, 1, size, file) != size) {
+    fprintf(stderr, "ERROR: cannot write '%s'\n", path);
+    if (file) fclose(file);
+    free(buffer);
+    return 1;
+  }
+  fclose(file);
+  free(buffer);
+  printf("Wrote %d zones and links, %u bytes\n",
+      REGISTRY_SIZE, (unsigned) size);
+  return 0;
+}
+
+/** Return the number of instants with a different result in the 2 zones. */
+static int check_zone(
+    const AtcZoneInfo *loaded,
+    const AtcZoneInfo *compiled,
+    AtcZoneProcessor *loaded_processor,
+    AtcZoneProcessor *compiled_processor)
+{
+  AtcTimeZone tza = atc_time_zone_for_zone_info(loaded, loaded_processor);
+  AtcTimeZone tzb = atc_time_zone_for_zone_info(compiled, compiled_processor);
+  int errors = 0;
+  // Every 97 days and 1 hour from 1800 to 2100.
+  for (int64_t t = -5364662400; t < 4102444800; t += 97 * 86400 + 3600) {
+    AtcZonedExtra a;
+    AtcZonedExtra b;
+    atc_zoned_extra_from_unix_seconds(&a, t, &tza);
+    atc_zoned_extra_from_unix_seconds(&b, t, &tzb);
+    if (a.resolved != b.resolved
+        || a.std_offset_seconds != b.std_offset_seconds
+        || a.dst_offset_seconds != b.dst_offset_seconds
+        || strcmp(a.abbrev, b.abbrev) != 0) {
+      errors++;
+    }
+  }
+  return errors;
+}
+
+static int check_file(const char *path)
+{
+  AtcZoneDb db;
+  clock_t start = clock();
+  int8_t err = atc_zone_db_open_file(&db, path);
+  clock_t end = clock();
+  if (err) {
+    fprintf(stderr, "ERROR: cannot load '%s'\n", path);
+    return 1;
+  }
+  printf("Loaded %d zones and links in %.3f ms\n",
+      db.registry_size, (end - start) * 1000.0 / CLOCKS_PER_SEC);
+
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(&registrar, REGISTRY, REGISTRY_SIZE);
+  AtcZoneProcessor loaded_processor;
+  atc_processor_init(&loaded_processor);
+  AtcZoneProcessor compiled_processor;
+  atc_processor_init(&compiled_processor);
+
+  int errors = 0;
+  for (uint16_t i = 0; i < db.registry_size; i++) {
+    const AtcZoneInfo *loaded = db.registry[i];
+    const AtcZoneInfo *compiled =
+        atc_registrar_find_by_id(&registrar, loaded->zone_id);
+    if (compiled == NULL) {
+      printf("ERROR: %s not compiled\n", atc_zone_info_zone_name(loaded));
+      errors++;
+      continue;
+    }
+    int n = check_zone(
+        loaded, compiled, &loaded_processor, &compiled_processor);
+    if (n > 0) {
+      printf("ERROR: %s: %d differences\n",
+          atc_zone_info_zone_name(loaded), n);
+      errors++;
+    }
+  }
+  printf("Checked %d zones and links: %d errors\n", db.registry_size, errors);
+  atc_zone_db_close_file(&db);
+  return errors ? 1 : 0;
+}
+
+int main(int argc, const char * const *argv)
+{
+  if (argc == 3 && strcmp(argv[1], "write") == 0) {
+    return write_file(argv[2]);
+  } else if (argc == 3 && strcmp(argv[1], "check") == 0) {
+    return check_file(argv[2]);
+  }
+  fprintf(stderr, "Usage: zone_db_file.out (write | check) file\n");
+  return 1;
+}
@@ -18,36 +18,57 @@
 #include "acetimec/plain_time.h"
 #include "acetimec/plain_date_time.h"
 #include "acetimec/offset_date_time.h"
+#include "acetimec/policy_cache.h"
 #include "acetimec/transition.h"
+#include "acetimec/steady_state.h"
 #include "acetimec/zone_processor.h"
+#include "acetimec/zone_processor_cache.h"
+#include "acetimec/shared_processor_cache.h"
+#include "acetimec/transition_table.h"
+#include "acetimec/transition_iterator.h"
 #include "acetimec/time_zone.h"
 #include "acetimec/zoned_date_time.h"
+#include "acetimec/zone_hash.h"
 #include "acetimec/zone_registrar.h"
+#include "acetimec/zone_name_index.h"
+#include "acetimec/zone_db.h"
+#include "acetimec/tzif.h"
+#include "acetimec/tzif_writer.h"
+#include "acetimec/zone_manager.h"
 #include "acetimec/zoned_extra.h"
+#include "acetimec/date_time_columns.h"
+#include "acetimec/world_clock.h"
 
 #if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
   #include "zonedball/zone_infos.h"
   #include "zonedball/zone_policies.h"
   #include "zonedball/zone_registry.h"
+  #include "zonedball/zone_hash.h"
   #include "zonedb2000/zone_infos.h"
   #include "zonedb2000/zone_policies.h"
   #include "zonedb2000/zone_registry.h"
+  #include "zonedb2000/zone_hash.h"
   #include "zonedb2025/zone_infos.h"
   #include "zonedb2025/zone_policies.h"
   #include "zonedb2025/zone_registry.h"
+  #include "zonedb2025/zone_hash.h"
   #include "zonedbtesting/zone_infos.h"
   #include "zonedbtesting/zone_policies.h"
   #include "zonedbtesting/zone_registry.h"
+  #include "zonedbtesting/zone_hash.h"
 #elif ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_MID
   #include "zonedb2000/zone_infos.h"
   #include "zonedb2000/zone_policies.h"
   #include "zonedb2000/zone_registry.h"
+  #include "zonedb2000/zone_hash.h"
   #include "zonedb2025/zone_infos.h"
   #include "zonedb2025/zone_policies.h"
   #include "zonedb2025/zone_registry.h"
+  #include "zonedb2025/zone_hash.h"
   #include "zonedbtesting/zone_infos.h"
   #include "zonedbtesting/zone_policies.h"
   #include "zonedbtesting/zone_registry.h"
+  #include "zonedbtesting/zone_hash.h"
 #else
   #error "Unknown ACE_TIME_C_ZONEDB_RES"
 #endif
@@ -15,6 +15,16 @@
 #include <stddef.h> // size_t
 #include <stdint.h> // INT32_MIN
 
+/**
+ * Set to 1 on hosts which provide mmap() for the files of zone_db.h and
+ * tzif.h. Microcontrollers (ARDUINO) load the data from memory instead.
+ */
+#if (defined(__unix__) || defined(__APPLE__)) && ! defined(ARDUINO)
+#define ACE_TIME_C_HAS_MMAP 1
+#else
+#define ACE_TIME_C_HAS_MMAP 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
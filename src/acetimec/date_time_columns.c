@@ -0,0 +1,294 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include "epoch.h" // atc_epoch_to_unix_seconds()
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "plain_date_time.h" // atc_plain_date_time_is_valid()
+#include "transition.h" // AtcTransitionStorage
+#include "tzif.h" // atc_tzif_find_by_unix_seconds()
+#include "zone_processor.h"
+#include "date_time_columns.h"
+
+/**
+ * An interval of unix seconds (or local seconds) in which the UTC offset is
+ * constant, and every value maps to a unique UTC offset.
+ */
+typedef struct AtcColumnsInterval {
+  int64_t start; // inclusive
+  int64_t until; // exclusive
+  int32_t offset_seconds;
+} AtcColumnsInterval;
+
+/**
+ * Return the time zone with a resolved type, so that the rows do not need to
+ * classify it again.
+ */
+static AtcTimeZone atc_columns_classify(const AtcTimeZone *tz)
+{
+  if (tz->type != kAtcTimeZoneTypeUnclassified) return *tz;
+  return atc_time_zone_for_zone_info(tz->zone_info, tz->zone_processor);
+}
+
+/**
+ * Return the seconds from 1970-01-01 00:00:00 to the start of the year, using
+ * the same time scale for UTC and for local times.
+ */
+static int64_t atc_columns_year_start(int16_t year)
+{
+  int32_t unix_days = atc_plain_date_to_unix_days(year, 1, 1);
+  if (unix_days == kAtcInvalidUnixDays) {
+    return (year <= kAtcMinYear) ? INT64_MIN : INT64_MAX;
+  }
+  return (int64_t) 86400 * unix_days;
+}
+
+/** Return the index of the transition which contains `unix_seconds`, or -1. */
+static int8_t atc_columns_find_transition(
+    const AtcTransitionStorage *ts,
+    int64_t unix_seconds)
+{
+  uint8_t k = 0;
+  for (uint8_t i = 0; i < ts->index_free; i++) {
+    k += (ts->transitions[i]->start_unix_seconds <= unix_seconds);
+  }
+  return (int8_t) k - 1;
+}
+
+static int64_t atc_columns_transition_start(
+    const AtcTransitionStorage *ts,
+    uint8_t i)
+{
+  return ts->transitions[i]->start_unix_seconds;
+}
+
+static int32_t atc_columns_transition_offset(
+    const AtcTransitionStorage *ts,
+    uint8_t i)
+{
+  const AtcTransition *t = ts->transitions[i];
+  return t->offset_seconds + t->delta_seconds;
+}
+
+/**
+ * Find the interval of unix seconds around `unix_seconds` which shares the
+ * same transition and the same UTC year. Returns false if not found.
+ */
+static bool atc_columns_find_interval_for_unix_seconds(
+    const AtcTimeZone *tz,
+    int64_t unix_seconds,
+    AtcColumnsInterval *interval)
+{
+  if (tz->type == kAtcTimeZoneTypeFixed) {
+    interval->start = INT64_MIN;
+    interval->until = INT64_MAX;
+    interval->offset_seconds = tz->std_offset_seconds + tz->dst_offset_seconds;
+    return true;
+  } else if (tz->type == kAtcTimeZoneTypeTzif) {
+    AtcFindResult result;
+    atc_tzif_find_by_unix_seconds(tz->tzif, unix_seconds, &result);
+    if (result.type == kAtcFindResultNotFound) return false;
+    interval->start = result.valid_from_unix_seconds;
+    interval->until = result.valid_until_unix_seconds;
+    interval->offset_seconds =
+        result.std_offset_seconds + result.dst_offset_seconds;
+    return true;
+  }
+
+  AtcZoneProcessor *processor = tz->zone_processor;
+  AtcPlainDateTime pdt;
+  atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds);
+  if (atc_plain_date_time_is_error(&pdt)) return false;
+  if (atc_processor_init_for_year(processor, pdt.year)) return false;
+
+  const AtcTransitionStorage *ts = &processor->transition_storage;
+  int8_t i = atc_columns_find_transition(ts, unix_seconds);
+  if (i < 0) return false;
+
+  interval->offset_seconds = atc_columns_transition_offset(ts, i);
+  interval->start = atc_columns_year_start(pdt.year);
+  int64_t start = atc_columns_transition_start(ts, i);
+  if (start > interval->start) interval->start = start;
+  interval->until = atc_columns_year_start(pdt.year + 1);
+  if (i + 1 < ts->index_free) {
+    int64_t until = atc_columns_transition_start(ts, i + 1);
+    if (until < interval->until) interval->until = until;
+  }
+  return true;
+}
+
+int8_t atc_date_time_columns_from_epoch_seconds(
+    AtcDateTimeColumns *columns,
+    const atc_time_t *epoch_seconds,
+    uint32_t num,
+    const AtcTimeZone *tz)
+{
+  AtcTimeZone ctz = atc_columns_classify(tz);
+  if (ctz.type == kAtcTimeZoneTypeProcessor) {
+    atc_processor_init_for_zone_info(ctz.zone_processor, ctz.zone_info);
+  }
+  int64_t epoch_unix_seconds =
+      atc_epoch_to_unix_seconds(atc_time_zone_get_epoch(tz), 0);
+
+  int8_t err = kAtcErrOk;
+  AtcColumnsInterval interval = {0, 0, 0}; // empty
+  int32_t cached_days = kAtcInvalidUnixDays;
+  int16_t year = 0;
+  uint8_t month = 0;
+  uint8_t day = 0;
+  for (uint32_t i = 0; i < num; i++) {
+    int64_t unix_seconds = epoch_unix_seconds + epoch_seconds[i];
+    if (epoch_seconds[i] == kAtcInvalidEpochSeconds
+        || ((unix_seconds < interval.start || unix_seconds >= interval.until)
+            && ! atc_columns_find_interval_for_unix_seconds(
+                &ctz, unix_seconds, &interval))) {
+      columns->month[i] = 0;
+      err = kAtcErrGeneric;
+      continue;
+    }
+
+    // Rows of the same local day share the (year, month, day).
+    int64_t local_seconds = unix_seconds + interval.offset_seconds;
+    int32_t days = (int32_t) ((local_seconds >= 0)
+        ? local_seconds / 86400
+        : (local_seconds - 86399) / 86400);
+    int32_t seconds = (int32_t) (local_seconds - (int64_t) 86400 * days);
+    if (days != cached_days) {
+      atc_plain_date_from_unix_days(days, &year, &month, &day);
+      cached_days = days;
+    }
+    columns->year[i] = year;
+    columns->month[i] = month;
+    columns->day[i] = day;
+    columns->hour[i] = (uint8_t) (seconds / 3600);
+    columns->minute[i] = (uint8_t) (seconds / 60 % 60);
+    columns->second[i] = (uint8_t) (seconds % 60);
+    columns->offset_seconds[i] = interval.offset_seconds;
+  }
+  return err;
+}
+
+/**
+ * Find the interval of local seconds around `local_seconds` which belongs to a
+ * single transition of the year `pdt.year`, excluding the gaps and overlaps
+ * with the neighboring transitions. Returns false if `pdt` is not in such an
+ * interval, in which case `unix_seconds` is set to the resolved value using
+ * `disambiguate`, or to kAtcInvalidUnixSeconds if not found.
+ */
+static bool atc_columns_find_interval_for_local_seconds(
+    const AtcTimeZone *tz,
+    const AtcPlainDateTime *pdt,
+    int64_t local_seconds,
+    uint8_t disambiguate,
+    AtcColumnsInterval *interval,
+    int64_t *unix_seconds)
+{
+  if (tz->type == kAtcTimeZoneTypeFixed) {
+    interval->start = INT64_MIN;
+    interval->until = INT64_MAX;
+    interval->offset_seconds = tz->std_offset_seconds + tz->dst_offset_seconds;
+    return true;
+  }
+
+  AtcZoneProcessor *processor = tz->zone_processor;
+  AtcFindResult result;
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    atc_tzif_find_by_plain_date_time(tz->tzif, pdt, disambiguate, &result);
+  } else if (atc_processor_init_for_year(processor, pdt->year)) {
+    result.type = kAtcFindResultNotFound;
+  } else {
+    atc_processor_search_by_plain_date_time(
+        processor, pdt, disambiguate, &result);
+  }
+  if (result.type == kAtcFindResultNotFound) {
+    *unix_seconds = kAtcInvalidUnixSeconds;
+    return false;
+  }
+  // Each row of an AtcTzif is a binary search, without a cached interval.
+  if (result.type != kAtcFindResultExact
+      || tz->type == kAtcTimeZoneTypeTzif) {
+    *unix_seconds = local_seconds
+        - (result.req_std_offset_seconds + result.req_dst_offset_seconds);
+    return false;
+  }
+
+  const AtcTransitionStorage *ts = &processor->transition_storage;
+  int32_t offset_seconds =
+      result.std_offset_seconds + result.dst_offset_seconds;
+  int8_t i = atc_columns_find_transition(ts, local_seconds - offset_seconds);
+  if (i < 0 || atc_columns_transition_offset(ts, i) != offset_seconds) {
+    *unix_seconds = local_seconds - offset_seconds;
+    return false;
+  }
+
+  // The local times of transition i which are not shared with transition i-1
+  // (overlap), nor skipped by it (gap).
+  interval->offset_seconds = offset_seconds;
+  interval->start = atc_columns_year_start(pdt->year);
+  int64_t start = atc_columns_transition_start(ts, i);
+  if (start != kAtcInvalidUnixSeconds) {
+    int32_t prev_offset = (i > 0)
+        ? atc_columns_transition_offset(ts, i - 1)
+        : offset_seconds;
+    start += (prev_offset > offset_seconds) ? prev_offset : offset_seconds;
+    if (start > interval->start) interval->start = start;
+  }
+  interval->until = atc_columns_year_start(pdt->year + 1);
+  if (i + 1 < ts->index_free) {
+    int32_t next_offset = atc_columns_transition_offset(ts, i + 1);
+    int64_t until = atc_columns_transition_start(ts, i + 1)
+        + ((next_offset < offset_seconds) ? next_offset : offset_seconds);
+    if (until < interval->until) interval->until = until;
+  }
+  return true;
+}
+
+int8_t atc_date_time_columns_to_epoch_seconds(
+    const AtcDateTimeColumns *columns,
+    uint32_t num,
+    const AtcTimeZone *tz,
+    uint8_t disambiguate,
+    atc_time_t *epoch_seconds)
+{
+  AtcTimeZone ctz = atc_columns_classify(tz);
+  if (ctz.type == kAtcTimeZoneTypeProcessor) {
+    atc_processor_init_for_zone_info(ctz.zone_processor, ctz.zone_info);
+  }
+  const AtcEpoch *epoch = atc_time_zone_get_epoch(tz);
+
+  int8_t err = kAtcErrOk;
+  AtcColumnsInterval interval = {0, 0, 0}; // empty
+  for (uint32_t i = 0; i < num; i++) {
+    AtcPlainDateTime pdt = {
+      columns->year[i], columns->month[i], columns->day[i],
+      columns->hour[i], columns->minute[i], columns->second[i],
+    };
+    if (atc_plain_date_time_is_error(&pdt)
+        || ! atc_plain_date_time_is_valid(&pdt)) {
+      epoch_seconds[i] = kAtcInvalidEpochSeconds;
+      err = kAtcErrGeneric;
+      continue;
+    }
+
+    int64_t local_seconds = atc_plain_date_time_to_unix_seconds(&pdt);
+    int64_t unix_seconds;
+    if (local_seconds >= interval.start && local_seconds < interval.until) {
+      unix_seconds = local_seconds - interval.offset_seconds;
+    } else if (atc_columns_find_interval_for_local_seconds(
+        &ctz, &pdt, local_seconds, disambiguate, &interval, &unix_seconds)) {
+      unix_seconds = local_seconds - interval.offset_seconds;
+    } else {
+      // Gap, overlap or error. Force the next row to search again.
+      interval.start = interval.until = 0;
+      if (unix_seconds == kAtcInvalidUnixSeconds) {
+        epoch_seconds[i] = kAtcInvalidEpochSeconds;
+        err = kAtcErrGeneric;
+        continue;
+      }
+    }
+    epoch_seconds[i] = atc_epoch_from_unix_seconds(epoch, unix_seconds);
+  }
+  return err;
+}
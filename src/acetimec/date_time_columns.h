@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file date_time_columns.h
+ *
+ * Batch conversions between arrays of epoch seconds and arrays of date-time
+ * fields in a single AtcTimeZone. The date-time fields are stored as a
+ * structure of arrays (one array per field), which is the layout of columnar
+ * data formats.
+ *
+ * Consecutive rows which fall into the same transition interval of the same
+ * year reuse the UTC offset of the previous row, without calling the
+ * AtcZoneProcessor again. Rows near a gap or an overlap are resolved
+ * individually, with the same result as the scalar functions of
+ * AtcZonedDateTime. Sorted inputs are the fastest, but any order is allowed.
+ */
+
+#ifndef ACE_TIME_C_DATE_TIME_COLUMNS_H
+#define ACE_TIME_C_DATE_TIME_COLUMNS_H
+
+#include <stdint.h>
+#include "common.h" // atc_time_t
+#include "time_zone.h" // AtcTimeZone
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Date-time fields stored as parallel arrays provided by the caller. Element
+ * `i` of each array belongs to row `i`. A row in an error state has a `month`
+ * of 0, similar to atc_zoned_date_time_is_error().
+ */
+typedef struct AtcDateTimeColumns {
+  /** year [1,9999] */
+  int16_t *year;
+  /** month [1,12], 0 for error */
+  uint8_t *month;
+  /** day [1,31] */
+  uint8_t *day;
+  /** hour [0,23] */
+  uint8_t *hour;
+  /** minute [0,59] */
+  uint8_t *minute;
+  /** second [0,59] */
+  uint8_t *second;
+  /**
+   * Total UTC offset in seconds, written by
+   * atc_date_time_columns_from_epoch_seconds(). Not used by
+   * atc_date_time_columns_to_epoch_seconds(), and can be NULL there.
+   */
+  int32_t *offset_seconds;
+} AtcDateTimeColumns;
+
+/**
+ * Convert `num` epoch seconds into the date-time fields and UTC offsets of
+ * `columns` in the time zone `tz`. Equivalent to calling
+ * atc_zoned_date_time_from_epoch_seconds() for each row.
+ *
+ * Rows which cannot be converted are set to an error state, and the function
+ * returns kAtcErrGeneric. Otherwise returns kAtcErrOk.
+ */
+int8_t atc_date_time_columns_from_epoch_seconds(
+    AtcDateTimeColumns *columns,
+    const atc_time_t *epoch_seconds,
+    uint32_t num,
+    const AtcTimeZone *tz);
+
+/**
+ * Convert the `num` date-time fields of `columns`, interpreted as local times
+ * of the time zone `tz`, into epoch seconds. Gaps and overlaps are resolved by
+ * `disambiguate` (kAtcDisambiguateXxx). Equivalent to calling
+ * atc_zoned_date_time_from_plain_date_time() then
+ * atc_zoned_date_time_to_epoch_seconds() for each row.
+ *
+ * Rows which are invalid or cannot be converted are set to
+ * kAtcInvalidEpochSeconds, and the function returns kAtcErrGeneric. Otherwise
+ * returns kAtcErrOk.
+ */
+int8_t atc_date_time_columns_to_epoch_seconds(
+    const AtcDateTimeColumns *columns,
+    uint32_t num,
+    const AtcTimeZone *tz,
+    uint8_t disambiguate,
+    atc_time_t *epoch_seconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -29,12 +29,11 @@ atc_time_t atc_date_tuple_subtract(
     const AtcDateTuple *a,
     const AtcDateTuple *b)
 {
-  int32_t da = atc_plain_date_to_epoch_days(a->year, a->month, a->day);
-  int32_t db = atc_plain_date_to_epoch_days(b->year, b->month, b->day);
+  int32_t da = atc_plain_date_to_unix_days(a->year, a->month, a->day);
+  int32_t db = atc_plain_date_to_unix_days(b->year, b->month, b->day);
 
   // Subtract the days, before converting to seconds, to avoid overflowing the
-  // int32_t when a.year or b.year is more than 68 years from the
-  // atc_current_epoch_year.
+  // int32_t when a.year and b.year are far apart.
   return (da - db) * 86400 + (a->seconds - b->seconds);
 }
 
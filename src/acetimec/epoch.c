@@ -3,6 +3,7 @@
  * Copyright (c) 2022 Brian T. Park
  */
 
+#include <stddef.h> // NULL
 #include <stdint.h>
 #include "common.h"
 #include "epoch.h"
@@ -27,40 +28,72 @@ void atc_set_current_epoch_year(int16_t year)
       atc_convert_to_internal_days(year, 1, 1);
 }
 
-int16_t atc_epoch_valid_year_lower(void)
+void atc_epoch_init(AtcEpoch *epoch, int16_t year)
 {
-  return atc_get_current_epoch_year() - 50;
+  epoch->year = year;
+  epoch->days_from_internal_epoch = atc_convert_to_internal_days(year, 1, 1);
 }
 
-int16_t atc_epoch_valid_year_upper(void)
+int16_t atc_epoch_get_year(const AtcEpoch *epoch)
 {
-  return atc_get_current_epoch_year() + 50;
+  return epoch ? epoch->year : atc_current_epoch_year;
 }
 
-int64_t atc_unix_seconds_from_epoch_seconds(atc_time_t epoch_seconds)
+int32_t atc_epoch_get_days_from_internal_epoch(const AtcEpoch *epoch)
+{
+  return epoch
+      ? epoch->days_from_internal_epoch
+      : atc_days_to_current_epoch_from_internal_epoch;
+}
+
+int64_t atc_epoch_to_unix_seconds(
+    const AtcEpoch *epoch,
+    atc_time_t epoch_seconds)
 {
   if (epoch_seconds == kAtcInvalidEpochSeconds) {
     return kAtcInvalidUnixSeconds;
   } else {
     return (int64_t) epoch_seconds
         + (int64_t) 86400
-          * (atc_days_to_current_epoch_from_internal_epoch
+          * (atc_epoch_get_days_from_internal_epoch(epoch)
               + kAtcDaysToInternalEpochFromUnixEpoch);
   }
 }
 
-atc_time_t atc_epoch_seconds_from_unix_seconds(int64_t unix_seconds)
+atc_time_t atc_epoch_from_unix_seconds(
+    const AtcEpoch *epoch,
+    int64_t unix_seconds)
 {
   if (unix_seconds == kAtcInvalidUnixSeconds) {
     return kAtcInvalidEpochSeconds;
   } else {
     return (int64_t) unix_seconds
         - (int64_t) 86400
-          * (atc_days_to_current_epoch_from_internal_epoch
+          * (atc_epoch_get_days_from_internal_epoch(epoch)
               + kAtcDaysToInternalEpochFromUnixEpoch);
   }
 }
 
+int16_t atc_epoch_valid_year_lower(void)
+{
+  return atc_get_current_epoch_year() - 50;
+}
+
+int16_t atc_epoch_valid_year_upper(void)
+{
+  return atc_get_current_epoch_year() + 50;
+}
+
+int64_t atc_unix_seconds_from_epoch_seconds(atc_time_t epoch_seconds)
+{
+  return atc_epoch_to_unix_seconds(NULL, epoch_seconds);
+}
+
+atc_time_t atc_epoch_seconds_from_unix_seconds(int64_t unix_seconds)
+{
+  return atc_epoch_from_unix_seconds(NULL, unix_seconds);
+}
+
 int32_t atc_unix_days_from_epoch_days(int32_t epoch_days)
 {
   return epoch_days
@@ -130,3 +163,54 @@ void atc_convert_from_internal_days(
   *month = (month_prime < 10) ? month_prime + 3 : month_prime - 9; // [1,12]
   *year = year_prime + ((*month <= 2) ? 1 : 0); // [1,9999]
 }
+
+// Same as atc_convert_to_internal_days(), using 32-bit unsigned arithmetic and
+// conditional selects instead of branches. Divisions by constants become
+// multiplications.
+void atc_convert_to_internal_days_array(
+    const int16_t *restrict year,
+    const uint8_t *restrict month,
+    const uint8_t *restrict day,
+    uint32_t num,
+    int32_t *restrict internal_days)
+{
+  for (uint32_t i = 0; i < num; i++) {
+    uint32_t m = month[i];
+    uint32_t is_jan_feb = (m <= 2);
+    uint32_t year_prime = (uint32_t) year[i] - is_jan_feb;
+    uint32_t era = year_prime / 400;
+    uint32_t year_of_era = year_prime - 400 * era;
+    uint32_t month_prime = is_jan_feb ? m + 9 : m - 3;
+    uint32_t day_of_year_prime = (153 * month_prime + 2) / 5 + day[i] - 1;
+    uint32_t day_of_era = 365 * year_of_era + year_of_era / 4
+        - year_of_era / 100 + day_of_year_prime;
+    internal_days[i] = (int32_t) (146097 * era + day_of_era)
+        - (kAtcInternalEpochYear / 400) * 146097 + 60;
+  }
+}
+
+// Same as atc_convert_from_internal_days(), without branches.
+void atc_convert_from_internal_days_array(
+    const int32_t *restrict internal_days,
+    uint32_t num,
+    int16_t *restrict year,
+    uint8_t *restrict month,
+    uint8_t *restrict day)
+{
+  for (uint32_t i = 0; i < num; i++) {
+    // epoch_prime days is relative to 0000-03-01
+    uint32_t day_of_epoch_prime = (uint32_t) (internal_days[i]
+        + (kAtcInternalEpochYear / 400) * 146097 - 60);
+    uint32_t era = day_of_epoch_prime / 146097;
+    uint32_t day_of_era = day_of_epoch_prime - 146097 * era;
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460
+        + day_of_era / 36524 - day_of_era / 146096) / 365;
+    uint32_t day_of_year_prime = day_of_era
+        - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    uint32_t month_prime = (5 * day_of_year_prime + 2) / 153;
+    uint32_t m = (month_prime < 10) ? month_prime + 3 : month_prime - 9;
+    day[i] = (uint8_t) (day_of_year_prime - (153 * month_prime + 2) / 5 + 1);
+    month[i] = (uint8_t) m;
+    year[i] = (int16_t) (year_of_era + 400 * era + (m <= 2));
+  }
+}
@@ -51,6 +51,43 @@ int16_t atc_get_current_epoch_year(void);
  */
 void atc_set_current_epoch_year(int16_t year);
 
+/**
+ * An explicit epoch, as an alternative to the current epoch year of the
+ * library, which is a process-wide global. An AtcZoneProcessor bound to an
+ * AtcEpoch using atc_processor_set_epoch() interprets `atc_time_t` relative to
+ * that epoch, so different components (or threads) can use different epochs
+ * at the same time, without invalidating each other's caches.
+ *
+ * Functions which take a `const AtcEpoch *` use the current epoch year of the
+ * library if the pointer is NULL.
+ */
+typedef struct AtcEpoch {
+  /** The epoch year. */
+  int16_t year;
+
+  /** Number of days from the internal epoch (2000-01-01) to the epoch. */
+  int32_t days_from_internal_epoch;
+} AtcEpoch;
+
+/** Initialize the AtcEpoch to 'year'-01-01T00:00:00 UTC. */
+void atc_epoch_init(AtcEpoch *epoch, int16_t year);
+
+/** Return the year of the epoch. */
+int16_t atc_epoch_get_year(const AtcEpoch *epoch);
+
+/** Return the number of days from the internal epoch to the epoch. */
+int32_t atc_epoch_get_days_from_internal_epoch(const AtcEpoch *epoch);
+
+/** Convert epoch seconds relative to the given epoch to unix seconds. */
+int64_t atc_epoch_to_unix_seconds(
+    const AtcEpoch *epoch,
+    atc_time_t epoch_seconds);
+
+/** Convert unix seconds to epoch seconds relative to the given epoch. */
+atc_time_t atc_epoch_from_unix_seconds(
+    const AtcEpoch *epoch,
+    int64_t unix_seconds);
+
 /** Convert epoch seconds to the unix seconds from 1970. */
 int64_t atc_unix_seconds_from_epoch_seconds(atc_time_t epoch_seconds);
 
@@ -128,6 +165,44 @@ void atc_convert_from_internal_days(
     uint8_t *month,
     uint8_t *day);
 
+/**
+ * Number of elements converted at a time by the array functions of PlainDate
+ * and PlainDateTime, which use temporary arrays of this size on the stack.
+ */
+enum { kAtcConvertArrayBlockSize = 32 };
+
+/**
+ * Array version of atc_convert_to_internal_days(). Converts `num` elements of
+ * the parallel arrays `year`, `month`, `day` into `internal_days`. This is a
+ * scalar loop, without branches and with 32-bit unsigned arithmetic, so that an
+ * application compiled with auto-vectorization (e.g. -O3) may vectorize it, but
+ * the library does not depend on it.
+ *
+ * No input validation is performed. The results are unspecified (but
+ * computed without undefined behavior) if the parameters are outside their
+ * expected range.
+ */
+void atc_convert_to_internal_days_array(
+    const int16_t *year,
+    const uint8_t *month,
+    const uint8_t *day,
+    uint32_t num,
+    int32_t *internal_days);
+
+/**
+ * Array version of atc_convert_from_internal_days(), written in the same style
+ * as atc_convert_to_internal_days_array().
+ *
+ * No input validation is performed. The results are unspecified if the
+ * parameters are outside their expected range.
+ */
+void atc_convert_from_internal_days_array(
+    const int32_t *internal_days,
+    uint32_t num,
+    int16_t *year,
+    uint8_t *month,
+    uint8_t *day);
+
 #ifdef __cplusplus
 }
 #endif
@@ -108,6 +108,45 @@ void atc_plain_date_from_epoch_days(
   atc_convert_from_internal_days(internal_days, year, month, day);
 }
 
+void atc_plain_date_array_to_epoch_days(
+    const AtcEpoch *epoch,
+    const int16_t *year,
+    const uint8_t *month,
+    const uint8_t *day,
+    uint32_t num,
+    int32_t *epoch_days)
+{
+  int32_t epoch_internal_days = atc_epoch_get_days_from_internal_epoch(epoch);
+  atc_convert_to_internal_days_array(year, month, day, num, epoch_days);
+  for (uint32_t i = 0; i < num; i++) {
+    epoch_days[i] = atc_plain_date_is_valid(year[i], month[i], day[i])
+        ? epoch_days[i] - epoch_internal_days
+        : kAtcInvalidEpochDays;
+  }
+}
+
+void atc_plain_date_array_from_epoch_days(
+    const AtcEpoch *epoch,
+    const int32_t *epoch_days,
+    uint32_t num,
+    int16_t *year,
+    uint8_t *month,
+    uint8_t *day)
+{
+  int32_t epoch_internal_days = atc_epoch_get_days_from_internal_epoch(epoch);
+  int32_t internal_days[kAtcConvertArrayBlockSize];
+  for (uint32_t start = 0; start < num; start += kAtcConvertArrayBlockSize) {
+    uint32_t n = (num - start < kAtcConvertArrayBlockSize)
+        ? num - start
+        : kAtcConvertArrayBlockSize;
+    for (uint32_t i = 0; i < n; i++) {
+      internal_days[i] = epoch_days[start + i] + epoch_internal_days;
+    }
+    atc_convert_from_internal_days_array(
+        internal_days, n, year + start, month + start, day + start);
+  }
+}
+
 int32_t atc_plain_date_to_unix_days(int16_t year, uint8_t month, uint8_t day)
 {
   bool is_valid = atc_plain_date_is_valid(year, month, day);
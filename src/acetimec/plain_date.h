@@ -19,6 +19,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "epoch.h" // AtcEpoch
 
 #ifdef __cplusplus
 extern "C" {
@@ -118,6 +119,38 @@ void atc_plain_date_from_unix_days(
     uint8_t *month,
     uint8_t *day);
 
+/**
+ * Convert `num` elements of the parallel arrays `year`, `month`, `day` into
+ * `epoch_days` relative to the given `epoch`, or to the current epoch year if
+ * NULL. Same as calling atc_plain_date_to_epoch_days() on each element,
+ * including the kAtcInvalidEpochDays of invalid dates, but uses the branchless
+ * atc_convert_to_internal_days_array().
+ */
+void atc_plain_date_array_to_epoch_days(
+    const AtcEpoch *epoch,
+    const int16_t *year,
+    const uint8_t *month,
+    const uint8_t *day,
+    uint32_t num,
+    int32_t *epoch_days);
+
+/**
+ * Convert `num` elements of `epoch_days` relative to the given `epoch`, or to
+ * the current epoch year if NULL, into the parallel arrays `year`, `month`,
+ * `day`. Same as calling atc_plain_date_from_epoch_days() on each element, but
+ * uses the branchless atc_convert_from_internal_days_array().
+ *
+ * No input validation is performed of `epoch_days` is performed. The behavior
+ * is undefined if the parameters are outside their expected range.
+ */
+void atc_plain_date_array_from_epoch_days(
+    const AtcEpoch *epoch,
+    const int32_t *epoch_days,
+    uint32_t num,
+    int16_t *year,
+    uint8_t *month,
+    uint8_t *day);
+
 /** Increment given (year, month, day) by one day. The (year, month, day)
  * arguments are not validated.
  */
@@ -74,18 +74,121 @@ void atc_plain_date_time_from_epoch_seconds(
   pdt->hour = minutes / 60;
 }
 
+void atc_plain_date_time_array_from_epoch_seconds(
+    const AtcEpoch *epoch,
+    AtcPlainDateTime *restrict pdts,
+    const atc_time_t *restrict epoch_seconds,
+    uint32_t num)
+{
+  int32_t epoch_internal_days = atc_epoch_get_days_from_internal_epoch(epoch);
+  int32_t internal_days[kAtcConvertArrayBlockSize];
+  int16_t years[kAtcConvertArrayBlockSize];
+  uint8_t months[kAtcConvertArrayBlockSize];
+  uint8_t days[kAtcConvertArrayBlockSize];
+  uint8_t hours[kAtcConvertArrayBlockSize];
+  uint8_t minutes[kAtcConvertArrayBlockSize];
+  uint8_t seconds[kAtcConvertArrayBlockSize];
+
+  for (uint32_t start = 0; start < num; start += kAtcConvertArrayBlockSize) {
+    uint32_t n = (num - start < kAtcConvertArrayBlockSize)
+        ? num - start
+        : kAtcConvertArrayBlockSize;
+
+    // Integer floor-division towards -infinity, without branches.
+    for (uint32_t i = 0; i < n; i++) {
+      atc_time_t es = epoch_seconds[start + i];
+      int32_t d = es / 86400;
+      int32_t s = es - 86400 * d;
+      d -= (s < 0);
+      s += (s < 0) ? 86400 : 0;
+      internal_days[i] = d + epoch_internal_days;
+      hours[i] = (uint8_t) (s / 3600);
+      minutes[i] = (uint8_t) (s / 60 % 60);
+      seconds[i] = (uint8_t) (s % 60);
+    }
+    atc_convert_from_internal_days_array(
+        internal_days, n, years, months, days);
+
+    // A month of 0 is the error state of atc_plain_date_time_set_error().
+    for (uint32_t i = 0; i < n; i++) {
+      AtcPlainDateTime *pdt = &pdts[start + i];
+      pdt->year = years[i];
+      pdt->month = (epoch_seconds[start + i] == kAtcInvalidEpochSeconds)
+          ? 0
+          : months[i];
+      pdt->day = days[i];
+      pdt->hour = hours[i];
+      pdt->minute = minutes[i];
+      pdt->second = seconds[i];
+    }
+  }
+}
+
+void atc_plain_date_time_array_to_epoch_seconds(
+    const AtcEpoch *epoch,
+    const AtcPlainDateTime *restrict pdts,
+    uint32_t num,
+    atc_time_t *restrict epoch_seconds)
+{
+  int32_t epoch_internal_days = atc_epoch_get_days_from_internal_epoch(epoch);
+  int32_t internal_days[kAtcConvertArrayBlockSize];
+  int16_t years[kAtcConvertArrayBlockSize];
+  uint8_t months[kAtcConvertArrayBlockSize];
+  uint8_t days[kAtcConvertArrayBlockSize];
+  uint8_t hours[kAtcConvertArrayBlockSize];
+  uint8_t minutes[kAtcConvertArrayBlockSize];
+  uint8_t seconds[kAtcConvertArrayBlockSize];
+
+  for (uint32_t start = 0; start < num; start += kAtcConvertArrayBlockSize) {
+    uint32_t n = (num - start < kAtcConvertArrayBlockSize)
+        ? num - start
+        : kAtcConvertArrayBlockSize;
+    for (uint32_t i = 0; i < n; i++) {
+      const AtcPlainDateTime *pdt = &pdts[start + i];
+      years[i] = pdt->year;
+      months[i] = pdt->month;
+      days[i] = pdt->day;
+      hours[i] = pdt->hour;
+      minutes[i] = pdt->minute;
+      seconds[i] = pdt->second;
+    }
+    atc_convert_to_internal_days_array(years, months, days, n, internal_days);
+
+    // Same validation as atc_plain_date_is_valid() and
+    // atc_plain_time_is_valid(), without branches.
+    for (uint32_t i = 0; i < n; i++) {
+      int32_t y = years[i];
+      int32_t m = months[i];
+      int32_t is_leap = ((y % 4 == 0) & (y % 100 != 0)) | (y % 400 == 0);
+      int32_t days_in_month = (m == 2)
+          ? 28 + is_leap
+          : 30 + ((m + (m >> 3)) & 1);
+      int32_t is_valid = (y >= 1) & (y <= 9999) & (m >= 1) & (m <= 12)
+          & (days[i] >= 1) & (days[i] <= days_in_month)
+          & (hours[i] < 24) & (minutes[i] < 60) & (seconds[i] < 60);
+      // Unsigned 32-bit arithmetic, which wraps like the scalar function for
+      // the years outside the range of atc_time_t.
+      uint32_t es = 86400u * (uint32_t) (internal_days[i]
+              - epoch_internal_days)
+          + (uint32_t) ((hours[i] * 60 + minutes[i]) * 60 + seconds[i]);
+      epoch_seconds[start + i] = is_valid
+          ? (atc_time_t) es
+          : kAtcInvalidEpochSeconds;
+    }
+  }
+}
+
 int64_t atc_plain_date_time_to_unix_seconds(const AtcPlainDateTime *pdt) {
   if (atc_plain_date_time_is_error(pdt)) return kAtcInvalidUnixSeconds;
 
-  int32_t days = atc_plain_date_to_epoch_days(
+  int32_t unix_days = atc_plain_date_to_unix_days(
       pdt->year, pdt->month, pdt->day);
-  if (days == kAtcInvalidUnixDays) return kAtcInvalidUnixSeconds;
+  if (unix_days == kAtcInvalidUnixDays) return kAtcInvalidUnixSeconds;
 
   int32_t seconds = atc_plain_time_to_seconds(
       pdt->hour, pdt->minute, pdt->second);
   if (seconds == kAtcInvalidSeconds) return kAtcInvalidUnixSeconds;
 
-  int32_t unix_days = atc_unix_days_from_epoch_days(days);
   return unix_days * (int64_t)86400 + seconds;
 }
 
@@ -105,12 +208,11 @@ void atc_plain_date_time_from_unix_seconds(
   int32_t unix_days = (unix_seconds < 0)
       ? (unix_seconds + 1) / 86400 - 1
       : unix_seconds / 86400;
-  int32_t seconds = unix_seconds - 86400 * unix_days;
-
-  int32_t days = atc_epoch_days_from_unix_days(unix_days);
+  int32_t seconds = unix_seconds - (int64_t) 86400 * unix_days;
 
   // Extract (year, month day).
-  atc_plain_date_from_epoch_days(days, &pdt->year, &pdt->month, &pdt->day);
+  atc_plain_date_from_unix_days(
+      unix_days, &pdt->year, &pdt->month, &pdt->day);
 
   // Extract (hour, minute, second). The compiler will combine the mod (%) and
   // division (/) operations into a single (dividend, remainder) function call.
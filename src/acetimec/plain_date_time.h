@@ -16,6 +16,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "common.h"
+#include "epoch.h" // AtcEpoch
 #include "string_buffer.h"
 
 #ifdef __cplusplus
@@ -80,6 +81,30 @@ void atc_plain_date_time_from_unix_seconds(
   AtcPlainDateTime *pdt,
   int64_t unix_seconds);
 
+/**
+ * Convert `num` epoch seconds relative to the given `epoch`, or to the current
+ * epoch year if NULL, into `pdts` in UTC. Same as calling
+ * atc_plain_date_time_from_epoch_seconds() on each element, but converts the
+ * dates using the branchless atc_convert_from_internal_days_array().
+ */
+void atc_plain_date_time_array_from_epoch_seconds(
+    const AtcEpoch *epoch,
+    AtcPlainDateTime *pdts,
+    const atc_time_t *epoch_seconds,
+    uint32_t num);
+
+/**
+ * Convert `num` elements of `pdts` in UTC to epoch seconds relative to the
+ * given `epoch`, or to the current epoch year if NULL. Same as calling
+ * atc_plain_date_time_to_epoch_seconds() on each element, but converts the
+ * dates using the branchless atc_convert_to_internal_days_array().
+ */
+void atc_plain_date_time_array_to_epoch_seconds(
+    const AtcEpoch *epoch,
+    const AtcPlainDateTime *pdts,
+    uint32_t num,
+    atc_time_t *epoch_seconds);
+
 /** Print the local date time in ISO 8601 format. */
 void atc_plain_date_time_print(
     AtcStringBuffer *sb,
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stddef.h> // NULL
+#include "zone_processor.h" // atc_processor_get_transition_time()
+#include "policy_cache.h"
+
+void atc_policy_cache_init(
+    AtcPolicyCache *cache,
+    AtcPolicyCacheEntry *entries,
+    uint16_t num_entries)
+{
+  cache->entries = entries;
+  cache->num_entries = num_entries;
+  atc_policy_cache_clear(cache);
+}
+
+void atc_policy_cache_clear(AtcPolicyCache *cache)
+{
+  for (uint16_t i = 0; i < cache->num_entries; i++) {
+    cache->entries[i].policy = NULL;
+  }
+  cache->num_hits = 0;
+  cache->num_misses = 0;
+}
+
+static uint16_t atc_policy_cache_hash(
+    const AtcPolicyCache *cache,
+    const AtcZonePolicy *policy,
+    int16_t year)
+{
+  uint32_t h = (uint32_t) ((uintptr_t) policy / sizeof(void*))
+      ^ ((uint32_t) (uint16_t) year * 2654435761u);
+  return (uint16_t) ((h ^ (h >> 16)) % cache->num_entries);
+}
+
+/**
+ * Fill the entry with the transition times of the rules of `policy` which are
+ * active in `year`, and the most recent transition before `year`. Returns
+ * false if there are too many active rules.
+ */
+static bool atc_policy_cache_fill(
+    AtcPolicyCacheEntry *entry,
+    const AtcZonePolicy *policy,
+    int16_t year)
+{
+  entry->policy = NULL;
+  entry->prior_rule_index = kAtcPolicyCacheNoRule;
+  uint8_t num_rules = 0;
+  for (uint8_t i = 0; i < policy->num_rules; i++) {
+    const AtcZoneRule *rule = &policy->rules[i];
+
+    // Same selection as atc_transition_storage_set_free_agent_as_prior_if_valid()
+    int16_t prior_year = atc_processor_get_most_recent_prior_year(
+        rule->from_year, rule->to_year, year, year);
+    if (prior_year != kAtcInvalidYear) {
+      AtcDateTuple dt;
+      atc_processor_get_transition_time(prior_year, rule, &dt);
+      if (entry->prior_rule_index == kAtcPolicyCacheNoRule
+          || atc_date_tuple_compare(&entry->prior_time, &dt) < 0) {
+        entry->prior_rule_index = i;
+        entry->prior_time = dt;
+      }
+    }
+
+    if (year < rule->from_year || rule->to_year < year) continue;
+    if (num_rules >= kAtcPolicyCacheMaxRules) return false;
+    entry->rule_indexes[num_rules] = i;
+    atc_processor_get_transition_time(
+        year, rule, &entry->transition_times[num_rules]);
+    num_rules++;
+  }
+  entry->policy = policy;
+  entry->year = year;
+  entry->num_rules = num_rules;
+  return true;
+}
+
+const AtcPolicyCacheEntry *atc_policy_cache_get(
+    AtcPolicyCache *cache,
+    const AtcZonePolicy *policy,
+    int16_t year)
+{
+  if (cache->num_entries == 0) return NULL;
+
+  AtcPolicyCacheEntry *entry =
+      &cache->entries[atc_policy_cache_hash(cache, policy, year)];
+  if (entry->policy == policy && entry->year == year) {
+    cache->num_hits++;
+    return entry;
+  }
+  cache->num_misses++;
+  return atc_policy_cache_fill(entry, policy, year) ? entry : NULL;
+}
+
+bool atc_policy_cache_get_transition_time(
+    AtcPolicyCache *cache,
+    const AtcZonePolicy *policy,
+    const AtcZoneRule *rule,
+    int16_t year,
+    AtcDateTuple *dt)
+{
+  const AtcPolicyCacheEntry *entry = atc_policy_cache_get(cache, policy, year);
+  if (entry == NULL) return false;
+
+  uint8_t index = (uint8_t) (rule - policy->rules);
+  for (uint8_t i = 0; i < entry->num_rules; i++) {
+    if (entry->rule_indexes[i] == index) {
+      *dt = entry->transition_times[i];
+      return true;
+    }
+  }
+  return false;
+}
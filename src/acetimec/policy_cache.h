@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file policy_cache.h
+ *
+ * A cache of the transition times of the rules of a ZonePolicy in a given
+ * year, shared by all the zones which use the same policy (e.g. the US or EU
+ * rules). The transition times are stored in their raw form, in the 'w', 's'
+ * or 'u' time of the rule, so they do not depend on the zone. Each zone then
+ * applies the offsets of its own ZoneEra.
+ *
+ * Each entry also holds the most recent transition of the policy before the
+ * year. Without the cache, every AtcZoneProcessor calculates the prior
+ * transition of every rule of the policy (e.g. about 10 rules for the US
+ * policy) to find the latest one, for every zone and every year.
+ *
+ * An AtcPolicyCache is attached to one or more AtcZoneProcessor using
+ * atc_processor_set_policy_cache(). The entries are provided by the caller.
+ * Each entry holds a (policy, year) pair, at the slot given by its hash, and a
+ * miss overwrites the slot. The cache is not thread-safe.
+ */
+
+#ifndef ACE_TIME_C_POLICY_CACHE_H
+#define ACE_TIME_C_POLICY_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "date_tuple.h" // AtcDateTuple
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  /**
+   * Maximum number of rules of a policy which are active in a single year.
+   * The zonedb has at most 4. Policies with more are not cached.
+   */
+  kAtcPolicyCacheMaxRules = 4,
+
+  /** Value of AtcPolicyCacheEntry.prior_rule_index if there is no rule. */
+  kAtcPolicyCacheNoRule = 255,
+};
+
+/** The transition times of the rules of a policy in a single year. */
+typedef struct AtcPolicyCacheEntry {
+  /** The policy, or NULL if the entry is empty. */
+  const AtcZonePolicy *policy;
+
+  /** The year of the transitions. */
+  int16_t year;
+
+  /** Number of rules which are active in `year`. */
+  uint8_t num_rules;
+
+  /** Index of each active rule in `policy->rules`. */
+  uint8_t rule_indexes[kAtcPolicyCacheMaxRules];
+
+  /** Transition time of each active rule, with the suffix of the rule. */
+  AtcDateTuple transition_times[kAtcPolicyCacheMaxRules];
+
+  /**
+   * Index of the rule with the most recent transition before `year`, or
+   * kAtcPolicyCacheNoRule. Same as the prior transition selected by
+   * atc_processor_find_candidate_transitions() among the rules which started
+   * before `year`.
+   */
+  uint8_t prior_rule_index;
+
+  /** Transition time of the prior rule. */
+  AtcDateTuple prior_time;
+} AtcPolicyCacheEntry;
+
+/** A cache of AtcPolicyCacheEntry, in an array provided by the caller. */
+typedef struct AtcPolicyCache {
+  /** Array of entries. */
+  AtcPolicyCacheEntry *entries;
+
+  /** Number of entries. */
+  uint16_t num_entries;
+
+  /** Number of lookups which found the (policy, year) in the cache. */
+  uint32_t num_hits;
+
+  /** Number of lookups which calculated the (policy, year). */
+  uint32_t num_misses;
+} AtcPolicyCache;
+
+/** Initialize the cache with the given array of entries, and clear it. */
+void atc_policy_cache_init(
+    AtcPolicyCache *cache,
+    AtcPolicyCacheEntry *entries,
+    uint16_t num_entries);
+
+/** Remove all entries and reset the counters. */
+void atc_policy_cache_clear(AtcPolicyCache *cache);
+
+/**
+ * Return the entry of the (policy, year), calculating it if necessary, or NULL
+ * if it cannot be cached. The entry is valid only until the next call, which
+ * may overwrite it.
+ */
+const AtcPolicyCacheEntry *atc_policy_cache_get(
+    AtcPolicyCache *cache,
+    const AtcZonePolicy *policy,
+    int16_t year);
+
+/**
+ * Set `dt` to the transition time of the given rule of `policy` in the given
+ * year, same as atc_processor_get_transition_time(). The year must be within
+ * the [from_year, to_year] of the rule. Returns false, leaving `dt` unchanged,
+ * if the (policy, year) cannot be cached.
+ */
+bool atc_policy_cache_get_transition_time(
+    AtcPolicyCache *cache,
+    const AtcZonePolicy *policy,
+    const AtcZoneRule *rule,
+    int16_t year,
+    AtcDateTuple *dt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include "registry_sort.h"
+
+/** Restore the max-heap of registry indexes at node i. */
+static void sift_down(
+    const AtcZoneInfo * const *registry,
+    uint16_t *heap,
+    uint16_t i,
+    uint16_t size,
+    AtcZoneInfoCompare compare)
+{
+  while (1) {
+    uint16_t largest = i;
+    uint16_t left = 2 * i + 1;
+    uint16_t right = left + 1;
+    if (left < size
+        && compare(registry[heap[left]], registry[heap[largest]]) > 0) {
+      largest = left;
+    }
+    if (right < size
+        && compare(registry[heap[right]], registry[heap[largest]]) > 0) {
+      largest = right;
+    }
+    if (largest == i) break;
+    uint16_t tmp = heap[i];
+    heap[i] = heap[largest];
+    heap[largest] = tmp;
+    i = largest;
+  }
+}
+
+void atc_registry_sort_indexes(
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *indexes,
+    AtcZoneInfoCompare compare)
+{
+  for (uint16_t i = 0; i < size; i++) indexes[i] = i;
+  for (uint16_t i = size / 2; i > 0; i--) {
+    sift_down(registry, indexes, i - 1, size, compare);
+  }
+  for (uint16_t end = size; end > 1; end--) {
+    uint16_t tmp = indexes[0];
+    indexes[0] = indexes[end - 1];
+    indexes[end - 1] = tmp;
+    sift_down(registry, indexes, 0, end - 1, compare);
+  }
+}
@@ -0,0 +1,41 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file registry_sort.h
+ *
+ * Internal helper which sorts the indexes of a registry in place, shared by
+ * the index of the zone_ids of zone_registrar.h and the index of the names of
+ * zone_name_index.h. It is not part of the public API of acetimec.h.
+ */
+
+#ifndef ACE_TIME_C_REGISTRY_SORT_H
+#define ACE_TIME_C_REGISTRY_SORT_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Compare 2 zones, returning a value <0, 0 or >0, like strcmp(). */
+typedef int (*AtcZoneInfoCompare)(const AtcZoneInfo *a, const AtcZoneInfo *b);
+
+/**
+ * Fill `indexes` with the `size` indexes of the registry, sorted by `compare`.
+ * Uses a heap sort, which needs no extra memory. The sort is not stable.
+ */
+void atc_registry_sort_indexes(
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *indexes,
+    AtcZoneInfoCompare compare);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,234 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include "shared_processor_cache.h"
+
+#if ACE_TIME_C_HAS_SHARED_CACHE
+
+#include <stdbool.h>
+#include <string.h> // strncpy()
+#include "epoch.h" // atc_get_current_epoch_year()
+#include "plain_date_time.h" // atc_plain_date_time_from_epoch_seconds()
+
+void atc_shared_cache_init(
+    AtcSharedProcessorCache *cache,
+    AtcSharedProcessorSlot *slots,
+    uint16_t num_slots)
+{
+  cache->slots = slots;
+  cache->num_slots = num_slots;
+  atomic_init(&cache->generation, 0);
+  for (uint16_t i = 0; i < num_slots; i++) {
+    atomic_init(&slots[i].state, kAtcSharedSlotEmpty);
+    atomic_init(&slots[i].generation, 0);
+  }
+}
+
+void atc_shared_cache_clear(AtcSharedProcessorCache *cache)
+{
+  for (uint16_t i = 0; i < cache->num_slots; i++) {
+    atomic_store_explicit(
+        &cache->slots[i].state, kAtcSharedSlotEmpty, memory_order_relaxed);
+  }
+}
+
+static uint16_t atc_shared_cache_hash(
+    const AtcSharedProcessorCache *cache,
+    uint32_t zone_id,
+    int16_t year)
+{
+  uint32_t h = zone_id ^ ((uint32_t) (uint16_t) year * 2654435761u);
+  return (uint16_t) ((h ^ (h >> 16)) % cache->num_slots);
+}
+
+/**
+ * Generate the transitions of the claimed slot, then publish it to the other
+ * threads with a new generation. Returns the generation.
+ */
+static uint32_t atc_shared_cache_fill(
+    AtcSharedProcessorCache *cache,
+    AtcSharedProcessorSlot *slot,
+    const AtcZoneInfo *zone_info,
+    int16_t year,
+    int16_t epoch_year)
+{
+  // The Writing state must be visible before the slot is overwritten, so that
+  // the readers which are still searching the previous content of a reclaimed
+  // slot reject their result.
+  atomic_thread_fence(memory_order_seq_cst);
+
+  atc_processor_init(&slot->processor);
+  atc_processor_init_for_zone_info(&slot->processor, zone_info);
+  atc_processor_init_for_year(&slot->processor, year);
+  slot->zone_info = zone_info;
+  slot->year = year;
+  slot->epoch_year = epoch_year;
+
+  uint32_t generation = atomic_fetch_add_explicit(
+      &cache->generation, 1, memory_order_relaxed) + 1;
+  atomic_store_explicit(&slot->generation, generation, memory_order_release);
+  atomic_store_explicit(&slot->state, kAtcSharedSlotReady, memory_order_release);
+  return generation;
+}
+
+const AtcSharedProcessorSlot *atc_shared_cache_get_for_year(
+    AtcSharedProcessorCache *cache,
+    const AtcZoneInfo *zone_info,
+    int16_t year,
+    uint32_t *generation)
+{
+  // Same range as atc_processor_init_for_year().
+  if (cache->num_slots == 0 || year <= kAtcMinYear || kAtcMaxYear <= year) {
+    return NULL;
+  }
+
+  int16_t epoch_year = atc_get_current_epoch_year();
+  uint32_t now = atomic_load_explicit(&cache->generation, memory_order_relaxed);
+  uint16_t index = atc_shared_cache_hash(cache, zone_info->zone_id, year);
+  uint8_t num_probes = (cache->num_slots < kAtcSharedCacheMaxProbes)
+      ? (uint8_t) cache->num_slots
+      : kAtcSharedCacheMaxProbes;
+
+  // The slot to reclaim if the key is not found: a slot of a previous epoch
+  // year, or else the oldest slot.
+  AtcSharedProcessorSlot *victim = NULL;
+  bool victim_is_stale = false;
+  uint32_t victim_age = 0;
+
+  for (uint8_t i = 0; i < num_probes; i++) {
+    AtcSharedProcessorSlot *slot = &cache->slots[index];
+    index = (uint16_t) ((index + 1) % cache->num_slots);
+    uint8_t state = atomic_load_explicit(&slot->state, memory_order_acquire);
+
+    if (state == kAtcSharedSlotEmpty) {
+      uint8_t expected = kAtcSharedSlotEmpty;
+      if (atomic_compare_exchange_strong_explicit(
+          &slot->state, &expected, kAtcSharedSlotWriting,
+          memory_order_acquire, memory_order_acquire)) {
+        *generation = atc_shared_cache_fill(
+            cache, slot, zone_info, year, epoch_year);
+        return slot;
+      }
+      // Lost the race, examine the slot filled by the other thread.
+      state = expected;
+    }
+
+    if (state == kAtcSharedSlotWriting) {
+      // The slot may be filled for the same key, so give up instead of
+      // filling a duplicate.
+      return NULL;
+    }
+
+    // kAtcSharedSlotReady. The key is read without a lock, so it is
+    // confirmed by atc_shared_cache_is_current() after the search.
+    uint32_t g = atomic_load_explicit(&slot->generation, memory_order_acquire);
+    bool is_stale = slot->epoch_year != epoch_year;
+    if (slot->zone_info == zone_info && slot->year == year && ! is_stale) {
+      *generation = g;
+      return slot;
+    }
+    uint32_t age = now - g;
+    if (victim == NULL
+        || (is_stale && ! victim_is_stale)
+        || (is_stale == victim_is_stale && age > victim_age)) {
+      victim = slot;
+      victim_is_stale = is_stale;
+      victim_age = age;
+    }
+  }
+
+  if (victim == NULL) return NULL;
+  uint8_t expected = kAtcSharedSlotReady;
+  if (! atomic_compare_exchange_strong_explicit(
+      &victim->state, &expected, kAtcSharedSlotWriting,
+      memory_order_acquire, memory_order_relaxed)) {
+    // Another thread is reclaiming the same slot.
+    return NULL;
+  }
+  *generation = atc_shared_cache_fill(
+      cache, victim, zone_info, year, epoch_year);
+  return victim;
+}
+
+bool atc_shared_cache_is_current(
+    const AtcSharedProcessorSlot *slot,
+    uint32_t generation)
+{
+  // Order the reads of the slot before the reads of its state.
+  atomic_thread_fence(memory_order_acquire);
+  uint8_t state = atomic_load_explicit(&slot->state, memory_order_relaxed);
+  uint32_t g = atomic_load_explicit(&slot->generation, memory_order_relaxed);
+  return state == kAtcSharedSlotReady && g == generation;
+}
+
+/**
+ * Copy the abbreviation of the result into `abbrev`, so that the result no
+ * longer points into the slot.
+ */
+static void atc_shared_cache_copy_abbrev(AtcFindResult *result, char *abbrev)
+{
+  if (result->type == kAtcFindResultNotFound) return;
+  strncpy(abbrev, result->abbrev, kAtcAbbrevSize - 1);
+  abbrev[kAtcAbbrevSize - 1] = '\0';
+  result->abbrev = abbrev;
+}
+
+void atc_shared_cache_find_by_epoch_seconds(
+    AtcSharedProcessorCache *cache,
+    AtcZoneProcessor *scratch,
+    const AtcZoneInfo *zone_info,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result,
+    char *abbrev)
+{
+  // Use the UTC year, same as atc_processor_init_for_epoch_seconds().
+  AtcPlainDateTime pdt;
+  atc_plain_date_time_from_epoch_seconds(&pdt, epoch_seconds);
+  if (atc_plain_date_time_is_error(&pdt)) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  uint32_t generation;
+  const AtcSharedProcessorSlot *slot =
+      atc_shared_cache_get_for_year(cache, zone_info, pdt.year, &generation);
+  if (slot) {
+    atc_processor_search_by_epoch_seconds(
+        &slot->processor, epoch_seconds, result);
+    atc_shared_cache_copy_abbrev(result, abbrev);
+    if (atc_shared_cache_is_current(slot, generation)) return;
+  }
+
+  atc_processor_init_for_zone_info(scratch, zone_info);
+  atc_processor_find_by_epoch_seconds(scratch, epoch_seconds, result);
+  atc_shared_cache_copy_abbrev(result, abbrev);
+}
+
+void atc_shared_cache_find_by_plain_date_time(
+    AtcSharedProcessorCache *cache,
+    AtcZoneProcessor *scratch,
+    const AtcZoneInfo *zone_info,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result,
+    char *abbrev)
+{
+  uint32_t generation;
+  const AtcSharedProcessorSlot *slot =
+      atc_shared_cache_get_for_year(cache, zone_info, pdt->year, &generation);
+  if (slot) {
+    atc_processor_search_by_plain_date_time(
+        &slot->processor, pdt, disambiguate, result);
+    atc_shared_cache_copy_abbrev(result, abbrev);
+    if (atc_shared_cache_is_current(slot, generation)) return;
+  }
+
+  atc_processor_init_for_zone_info(scratch, zone_info);
+  atc_processor_find_by_plain_date_time(
+      scratch, pdt, disambiguate, result);
+  atc_shared_cache_copy_abbrev(result, abbrev);
+}
+
+#endif
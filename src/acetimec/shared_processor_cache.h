@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file shared_processor_cache.h
+ *
+ * A cache of the transitions of (zone, year) pairs which can be shared by
+ * multiple threads. An AtcZoneProcessor is modified by every lookup in a
+ * different year, so it cannot be shared without external locking. Each slot of
+ * an AtcSharedProcessorCache holds an AtcZoneProcessor which is generated once,
+ * then published using an atomic store with release semantics. Readers search
+ * it without locks.
+ *
+ * A lookup which misses the cache claims an empty slot and fills it. When all
+ * the probed slots are used, it reclaims the slot filled with a previous epoch
+ * year, or else the oldest one. Each fill gives the slot a new generation, and
+ * a reader accepts its search only if the generation of the slot did not
+ * change during the search, like a seqlock. If no slot can be claimed (another
+ * thread is filling it), or the slot was reclaimed under the reader, the
+ * lookup falls back to a scratch AtcZoneProcessor provided by the calling
+ * thread. Readers never wait for writers.
+ *
+ * Requires C11 atomics, so this is not available on AVR processors, nor in C++
+ * translation units (which cannot include <stdatomic.h> before C++23).
+ */
+
+#ifndef ACE_TIME_C_SHARED_PROCESSOR_CACHE_H
+#define ACE_TIME_C_SHARED_PROCESSOR_CACHE_H
+
+#if ! defined(__cplusplus) \
+    && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L \
+    && ! defined(__STDC_NO_ATOMICS__) \
+    && ! defined(__AVR__)
+#define ACE_TIME_C_HAS_SHARED_CACHE 1
+#else
+#define ACE_TIME_C_HAS_SHARED_CACHE 0
+#endif
+
+#if ACE_TIME_C_HAS_SHARED_CACHE
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "common.h" // atc_time_t
+#include "../zoneinfo/zone_info.h"
+#include "plain_date_time.h" // AtcPlainDateTime
+#include "zone_processor.h" // AtcZoneProcessor, AtcFindResult
+
+enum {
+  /** Maximum number of slots examined by a lookup, starting at its hash. */
+  kAtcSharedCacheMaxProbes = 4,
+};
+
+/** State of an AtcSharedProcessorSlot. */
+enum {
+  kAtcSharedSlotEmpty = 0,
+  kAtcSharedSlotWriting = 1,
+  kAtcSharedSlotReady = 2,
+};
+
+/**
+ * A slot of the AtcSharedProcessorCache. The fields other than `state` and
+ * `generation` are written only while `state` is kAtcSharedSlotWriting, by the
+ * thread which claimed the slot.
+ */
+typedef struct AtcSharedProcessorSlot {
+  /** One of kAtcSharedSlotEmpty, kAtcSharedSlotWriting, kAtcSharedSlotReady. */
+  _Atomic uint8_t state;
+
+  /**
+   * The value of the generation counter of the cache when the slot was last
+   * filled, which identifies the content of the slot, and gives its age.
+   */
+  _Atomic uint32_t generation;
+
+  /**
+   * The zone_info of the processor. The zone_id alone is not unique, because
+   * different zone databases (e.g. zonedb2025 and zonedball) reuse the same
+   * zone_id for the same zone name.
+   */
+  const AtcZoneInfo *zone_info;
+
+  /** The year of the transitions of the processor. */
+  int16_t year;
+
+  /** The current epoch year when the processor was filled. */
+  int16_t epoch_year;
+
+  /** The processor, valid for `year`. */
+  AtcZoneProcessor processor;
+} AtcSharedProcessorSlot;
+
+/** A cache of AtcZoneProcessor, keyed by (zone_info, year). */
+typedef struct AtcSharedProcessorCache {
+  /** Slots provided by the caller. */
+  AtcSharedProcessorSlot *slots;
+
+  /** Number of elements in `slots`. */
+  uint16_t num_slots;
+
+  /** Incremented by every fill of a slot. */
+  _Atomic uint32_t generation;
+} AtcSharedProcessorCache;
+
+/**
+ * Initialize the cache using the given array of slots. Must be called before
+ * the cache is shared with other threads.
+ */
+void atc_shared_cache_init(
+    AtcSharedProcessorCache *cache,
+    AtcSharedProcessorSlot *slots,
+    uint16_t num_slots);
+
+/**
+ * Remove all entries. Must not be called while other threads use the cache.
+ * Not required after atc_set_current_epoch_year(), because the slots filled
+ * with the previous epoch year are reclaimed first.
+ */
+void atc_shared_cache_clear(AtcSharedProcessorCache *cache);
+
+/**
+ * Return the slot which holds the transitions of the given zone and year,
+ * filling an empty or reclaimed slot if necessary, and its `generation`.
+ * Returns NULL if the year is out of range, or if no slot is available. The
+ * processor of the slot must be treated as read-only, using
+ * atc_processor_search_by_epoch_seconds() or
+ * atc_processor_search_by_plain_date_time(), and the result of the search is
+ * valid only if atc_shared_cache_is_current() returns true afterwards. The
+ * result must not point into the slot after that check (e.g. copy the
+ * `abbrev`), because another thread may reclaim the slot at any time.
+ */
+const AtcSharedProcessorSlot *atc_shared_cache_get_for_year(
+    AtcSharedProcessorCache *cache,
+    const AtcZoneInfo *zone_info,
+    int16_t year,
+    uint32_t *generation);
+
+/**
+ * Return true if the slot still holds the content of the given generation,
+ * i.e. it was not reclaimed since atc_shared_cache_get_for_year() returned
+ * it, so that what was read from the slot in between is consistent.
+ */
+bool atc_shared_cache_is_current(
+    const AtcSharedProcessorSlot *slot,
+    uint32_t generation);
+
+/**
+ * Find the AtcFindResult at the given epoch_seconds. Same semantics as
+ * atc_processor_find_by_epoch_seconds(). The `scratch` processor is owned by
+ * the calling thread, and is used only when the cache cannot provide the year.
+ * The abbreviation is copied into `abbrev` (kAtcAbbrevSize bytes, also owned by
+ * the calling thread), and `result.abbrev` points to it, because the slot may
+ * be reclaimed by another thread after the lookup.
+ */
+void atc_shared_cache_find_by_epoch_seconds(
+    AtcSharedProcessorCache *cache,
+    AtcZoneProcessor *scratch,
+    const AtcZoneInfo *zone_info,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result,
+    char *abbrev);
+
+/**
+ * Find the AtcFindResult at the given PlainDateTime. Same semantics as
+ * atc_processor_find_by_plain_date_time(). The `scratch` processor and the
+ * `abbrev` buffer are used as in atc_shared_cache_find_by_epoch_seconds().
+ */
+void atc_shared_cache_find_by_plain_date_time(
+    AtcSharedProcessorCache *cache,
+    AtcZoneProcessor *scratch,
+    const AtcZoneInfo *zone_info,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result,
+    char *abbrev);
+
+#endif
+
+#endif
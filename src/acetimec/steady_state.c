@@ -0,0 +1,384 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include "../zoneinfo/zone_info_utils.h"
+#include "common.h"
+#include "epoch.h" // atc_unix_seconds_from_epoch_seconds()
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "zone_processor.h" // atc_processor_calc_start_day_of_month()
+#include "steady_state.h"
+
+/**
+ * Return true if the wall times just before and just after the transition of
+ * the given rule, from the DST offset of the prev rule, are both within the
+ * day of the rule.
+ */
+static bool atc_steady_state_is_same_day(
+    const AtcSteadyState *state,
+    const AtcZoneRule *rule,
+    const AtcZoneRule *prev)
+{
+  int32_t prev_dst = atc_zone_rule_dst_offset_seconds(prev);
+  int32_t dst = atc_zone_rule_dst_offset_seconds(rule);
+  int32_t at = atc_zone_rule_at_seconds(rule);
+  uint8_t suffix = atc_zone_rule_at_suffix(rule);
+
+  // Convert 'at' to the wall time before the transition.
+  int32_t before;
+  if (suffix == kAtcSuffixU) {
+    before = at + state->std_offset_seconds + prev_dst;
+  } else if (suffix == kAtcSuffixS) {
+    before = at + prev_dst;
+  } else {
+    before = at;
+  }
+  int32_t after = before + dst - prev_dst;
+  return before >= 0 && before < 86400 && after >= 0 && after < 86400;
+}
+
+int8_t atc_steady_state_init(
+    AtcSteadyState *state,
+    const AtcZoneInfo *zone_info)
+{
+  state->start_year = kAtcInvalidYear;
+  state->window_year = kAtcInvalidYear;
+  if (zone_info == NULL || zone_info->num_eras == 0) return kAtcErrGeneric;
+
+  // The final era must never end, and must use a ZonePolicy.
+  const AtcZoneEra *era = &zone_info->eras[zone_info->num_eras - 1];
+  const AtcZonePolicy *policy = era->zone_policy;
+  if (era->until_year != kAtcZoneInfoMaxUntilYear || policy == NULL) {
+    return kAtcErrGeneric;
+  }
+
+  // The era must start at least 2 years before the steady state, so that the
+  // 14-month window of the AtcZoneProcessor never sees the previous era.
+  int16_t start_year = kAtcMinYear + 1;
+  if (zone_info->num_eras > 1) {
+    int16_t prev_until_year = zone_info->eras[zone_info->num_eras - 2].until_year;
+    if (prev_until_year + 2 > start_year) start_year = prev_until_year + 2;
+  }
+
+  // Find exactly 2 rules which never end. Other rules must have expired at
+  // least 2 years before the steady state.
+  uint8_t num_recurring = 0;
+  const AtcZoneRule *recurring[2];
+  for (uint8_t i = 0; i < policy->num_rules; i++) {
+    const AtcZoneRule *rule = &policy->rules[i];
+    if (rule->to_year == kAtcZoneInfoMaxYear) {
+      if (num_recurring >= 2) return kAtcErrGeneric;
+      recurring[num_recurring++] = rule;
+      if (rule->from_year + 2 > start_year) start_year = rule->from_year + 2;
+    } else {
+      if (rule->to_year + 2 > start_year) start_year = rule->to_year + 2;
+    }
+  }
+  if (num_recurring != 2) return kAtcErrGeneric;
+
+  // The transitions must not cross the boundary of a year, even when the
+  // on_day_of_month expression crosses the boundary of a month.
+  if (recurring[0]->in_month == recurring[1]->in_month) return kAtcErrGeneric;
+  for (uint8_t i = 0; i < 2; i++) {
+    if (recurring[i]->in_month < 2 || recurring[i]->in_month > 11) {
+      return kAtcErrGeneric;
+    }
+  }
+  if (start_year >= kAtcMaxYear - 1) return kAtcErrGeneric;
+
+  // Sort the rules by the order of their transitions within a year.
+  uint8_t first = (recurring[0]->in_month < recurring[1]->in_month) ? 0 : 1;
+  state->rules[0] = recurring[first];
+  state->rules[1] = recurring[1 - first];
+  state->std_offset_seconds = atc_zone_era_std_offset_seconds(era);
+
+  // The wall time just before and just after each transition must fall on the
+  // day of the rule. Otherwise the AtcZoneProcessor compares unnormalized
+  // AtcDateTuple, and the 2 methods disagree near midnight.
+  for (uint8_t i = 0; i < 2; i++) {
+    if (! atc_steady_state_is_same_day(
+        state, state->rules[i], state->rules[1 - i])) {
+      state->start_year = kAtcInvalidYear;
+      return kAtcErrGeneric;
+    }
+  }
+
+  // The abbreviations are also fixed.
+  const char * const *letters = zone_info->zone_context->letters;
+  for (uint8_t i = 0; i < 2; i++) {
+    atc_processor_create_abbreviation(
+        state->abbrevs[i],
+        kAtcAbbrevSize,
+        era->format,
+        state->std_offset_seconds,
+        atc_zone_rule_dst_offset_seconds(state->rules[i]),
+        letters[state->rules[i]->letter_index]);
+  }
+
+  state->start_year = start_year;
+  state->start_unix_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(start_year, 1, 1);
+  state->until_unix_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(kAtcMaxYear - 1, 1, 1);
+  return kAtcErrOk;
+}
+
+bool atc_steady_state_is_valid_for_year(
+    const AtcSteadyState *state,
+    int16_t year)
+{
+  // The transitions of the following year must also be calculated.
+  return state->start_year != kAtcInvalidYear
+      && year >= state->start_year
+      && year < kAtcMaxYear - 1;
+}
+
+/**
+ * Return the Unix seconds of the transition of the given rule in the given
+ * year, using the DST offset of the previous transition to interpret the 'w'
+ * suffix.
+ */
+static int64_t atc_steady_state_transition_seconds(
+    const AtcSteadyState *state,
+    int16_t year,
+    const AtcZoneRule *rule,
+    int32_t prev_dst_offset_seconds)
+{
+  AtcMonthDay md = atc_processor_calc_start_day_of_month(
+      year, rule->in_month, rule->on_day_of_week, rule->on_day_of_month);
+  int64_t seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(year, md.month, md.day)
+      + atc_zone_rule_at_seconds(rule);
+
+  uint8_t suffix = atc_zone_rule_at_suffix(rule);
+  if (suffix == kAtcSuffixU) {
+    return seconds;
+  } else if (suffix == kAtcSuffixS) {
+    return seconds - state->std_offset_seconds;
+  } else {
+    return seconds - (state->std_offset_seconds + prev_dst_offset_seconds);
+  }
+}
+
+void atc_steady_state_transitions_for_year(
+    const AtcSteadyState *state,
+    int16_t year,
+    int64_t unix_seconds[2])
+{
+  int32_t dst0 = atc_zone_rule_dst_offset_seconds(state->rules[0]);
+  int32_t dst1 = atc_zone_rule_dst_offset_seconds(state->rules[1]);
+  unix_seconds[0] = atc_steady_state_transition_seconds(
+      state, year, state->rules[0], dst1);
+  unix_seconds[1] = atc_steady_state_transition_seconds(
+      state, year, state->rules[1], dst0);
+}
+
+/**
+ * The 4 transitions which surround the given year: the second transition of
+ * the previous year, the 2 transitions of the year, and the first transition
+ * of the following year. Element i uses state.rules[(i + 1) % 2].
+ */
+typedef struct AtcSteadyStateWindow {
+  const int64_t *start_seconds;
+  int32_t dst_offset_seconds[4];
+} AtcSteadyStateWindow;
+
+/**
+ * Fill the window of the given year. The start times are calculated only if
+ * the year differs from the cached `state.window_year`.
+ */
+static void atc_steady_state_window(
+    AtcSteadyState *state,
+    int16_t year,
+    AtcSteadyStateWindow *window)
+{
+  if (state->window_year != year) {
+    int64_t prev[2];
+    int64_t curr[2];
+    int64_t next[2];
+    atc_steady_state_transitions_for_year(state, year - 1, prev);
+    atc_steady_state_transitions_for_year(state, year, curr);
+    atc_steady_state_transitions_for_year(state, year + 1, next);
+    state->window_seconds[0] = prev[1];
+    state->window_seconds[1] = curr[0];
+    state->window_seconds[2] = curr[1];
+    state->window_seconds[3] = next[0];
+    state->window_year_seconds[0] = (int64_t) 86400
+        * atc_plain_date_to_unix_days(year, 1, 1);
+    state->window_year_seconds[1] = (int64_t) 86400
+        * atc_plain_date_to_unix_days(year + 1, 1, 1);
+    state->window_year = year;
+  }
+  window->start_seconds = state->window_seconds;
+
+  int32_t dst0 = atc_zone_rule_dst_offset_seconds(state->rules[0]);
+  int32_t dst1 = atc_zone_rule_dst_offset_seconds(state->rules[1]);
+  window->dst_offset_seconds[0] = dst1;
+  window->dst_offset_seconds[1] = dst0;
+  window->dst_offset_seconds[2] = dst1;
+  window->dst_offset_seconds[3] = dst0;
+}
+
+void atc_steady_state_find_by_unix_seconds(
+    AtcSteadyState *state,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+  // The years before the steady state are rejected by comparing the seconds,
+  // so that the historical lookups of the AtcZoneProcessor do not pay for a
+  // conversion to a date here.
+  if (state->start_year == kAtcInvalidYear
+      || unix_seconds < state->start_unix_seconds
+      || unix_seconds >= state->until_unix_seconds) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  // Use the UTC year, same as atc_processor_init_for_epoch_seconds(). The
+  // year of the cached window is also found without a conversion.
+  int16_t year;
+  if (state->window_year != kAtcInvalidYear
+      && unix_seconds >= state->window_year_seconds[0]
+      && unix_seconds < state->window_year_seconds[1]) {
+    year = state->window_year;
+  } else {
+    AtcPlainDateTime pdt;
+    atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds);
+    year = pdt.year;
+  }
+
+  AtcSteadyStateWindow w;
+  atc_steady_state_window(state, year, &w);
+
+  // Element 0 starts before the year, and element 3 starts after the year.
+  uint8_t i = 0;
+  while (i < 2 && w.start_seconds[i + 1] <= unix_seconds) i++;
+
+  // Detect overlaps using the same rules as
+  // atc_transition_storage_find_for_seconds().
+  result->type = kAtcFindResultExact;
+  result->fold = 0;
+  int32_t prev_shift = (i > 0)
+      ? w.dst_offset_seconds[i] - w.dst_offset_seconds[i - 1]
+      : 0;
+  int32_t next_shift = w.dst_offset_seconds[i + 1] - w.dst_offset_seconds[i];
+  if (prev_shift < 0 && unix_seconds - w.start_seconds[i] < -prev_shift) {
+    result->type = kAtcFindResultOverlap;
+    result->fold = 1;
+  } else if (next_shift < 0
+      && w.start_seconds[i + 1] - unix_seconds <= -next_shift) {
+    result->type = kAtcFindResultOverlap;
+  }
+
+  uint8_t r = (i + 1) % 2;
+  result->std_offset_seconds = state->std_offset_seconds;
+  result->dst_offset_seconds = w.dst_offset_seconds[i];
+  result->req_std_offset_seconds = state->std_offset_seconds;
+  result->req_dst_offset_seconds = w.dst_offset_seconds[i];
+  result->abbrev = state->abbrevs[r];
+  result->valid_from_unix_seconds = w.start_seconds[i];
+  result->valid_until_unix_seconds = w.start_seconds[i + 1];
+}
+
+void atc_steady_state_find_by_epoch_seconds(
+    AtcSteadyState *state,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result)
+{
+  if (epoch_seconds == kAtcInvalidEpochSeconds) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+  atc_steady_state_find_by_unix_seconds(
+      state, atc_unix_seconds_from_epoch_seconds(epoch_seconds), result);
+}
+
+// Same rules as atc_processor_find_by_plain_date_time().
+void atc_steady_state_find_by_plain_date_time(
+    AtcSteadyState *state,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result)
+{
+  if (! atc_steady_state_is_valid_for_year(state, pdt->year)) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  AtcSteadyStateWindow w;
+  atc_steady_state_window(state, pdt->year, &w);
+
+  // Local seconds of pdt, compared to the local start and until times of
+  // elements 0 to 2, each using its own UTC offset.
+  int64_t local_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(pdt->year, pdt->month, pdt->day)
+      + (pdt->hour * (int32_t) 60 + pdt->minute) * 60 + pdt->second;
+  int8_t prev = -1;
+  int8_t curr = -1;
+  uint8_t num = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    int32_t total = state->std_offset_seconds + w.dst_offset_seconds[i];
+    int64_t start = w.start_seconds[i] + total;
+    int64_t until = w.start_seconds[i + 1] + total;
+    if (start <= local_seconds && local_seconds < until) {
+      if (num == 0) {
+        prev = i;
+        curr = i;
+      } else {
+        curr = i;
+      }
+      num++;
+    } else if (num == 0 && until <= local_seconds) {
+      // pdt is after this element: either in a later element, or in the gap
+      // before the next element.
+      prev = i;
+      curr = i + 1;
+    }
+  }
+
+  // Extract the target element, and the element of the requested offsets.
+  int8_t target;
+  int8_t req;
+  if (num == 1) {
+    result->type = kAtcFindResultExact;
+    result->fold = 0;
+    target = curr;
+    req = curr;
+  } else if (num == 2) {
+    result->type = kAtcFindResultOverlap;
+    if ((disambiguate == kAtcDisambiguateCompatible)
+        || (disambiguate == kAtcDisambiguateEarlier)) {
+      target = prev;
+      result->fold = 0;
+    } else {
+      target = curr;
+      result->fold = 1;
+    }
+    req = target;
+  } else if (prev >= 0 && curr <= 2) {
+    result->type = kAtcFindResultGap;
+    if ((disambiguate == kAtcDisambiguateCompatible)
+        || disambiguate == kAtcDisambiguateLater) {
+      req = prev;
+      result->fold = 0;
+      target = curr;
+    } else {
+      req = curr;
+      result->fold = 1;
+      target = prev;
+    }
+  } else {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  result->std_offset_seconds = state->std_offset_seconds;
+  result->dst_offset_seconds = w.dst_offset_seconds[target];
+  result->req_std_offset_seconds = state->std_offset_seconds;
+  result->req_dst_offset_seconds = w.dst_offset_seconds[req];
+  result->abbrev = state->abbrevs[(target + 1) % 2];
+  result->valid_from_unix_seconds = w.start_seconds[target];
+  result->valid_until_unix_seconds = w.start_seconds[target + 1];
+}
@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file steady_state.h
+ *
+ * A compiled representation of the "steady state" of a time zone: the final
+ * ZoneEra whose DST transitions are governed by exactly 2 rules which recur
+ * every year until the end of time (e.g. "Mar Sun>=8" and "Nov Sun>=1" of the
+ * US rules). In the years after all other eras and rules have expired, the
+ * transitions are a pure function of the year, so they can be calculated
+ * directly in constant time, without the AtcTransitionStorage of the
+ * AtcZoneProcessor. The calculations use 64-bit Unix seconds, so they are
+ * valid until the year 9999.
+ */
+
+#ifndef ACE_TIME_C_STEADY_STATE_H
+#define ACE_TIME_C_STEADY_STATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // atc_time_t
+#include "plain_date_time.h" // AtcPlainDateTime
+#include "transition.h" // kAtcAbbrevSize
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Forward declaration for AtcFindResult. */
+typedef struct AtcFindResult AtcFindResult;
+
+/** The steady-state rule pair of a zone. */
+typedef struct AtcSteadyState {
+  /**
+   * The first year which can be calculated using the rule pair, or
+   * kAtcInvalidYear if the zone has no steady state.
+   */
+  int16_t start_year;
+
+  /**
+   * The Unix seconds of the start of `start_year`, and of the year
+   * kAtcMaxYear - 1, in UTC, so that atc_steady_state_find_by_unix_seconds()
+   * rejects the other instants without converting them to a date.
+   */
+  int64_t start_unix_seconds;
+  int64_t until_unix_seconds;
+
+  /** The STD offset of the final ZoneEra. */
+  int32_t std_offset_seconds;
+
+  /** The 2 recurring rules, in the order of their transitions in a year. */
+  const AtcZoneRule *rules[2];
+
+  /** The abbreviations after the transition of each rule. */
+  char abbrevs[2][kAtcAbbrevSize];
+
+  /** The year of `window_seconds`, or kAtcInvalidYear if not calculated. */
+  int16_t window_year;
+
+  /** The Unix seconds of the start and the end of `window_year`, in UTC. */
+  int64_t window_year_seconds[2];
+
+  /**
+   * Cache of the 4 transitions which surround `window_year`: the second
+   * transition of the previous year, the 2 transitions of the year, and the
+   * first transition of the following year.
+   */
+  int64_t window_seconds[4];
+} AtcSteadyState;
+
+/**
+ * Compile the steady state of the given zone_info. Returns kAtcErrGeneric, and
+ * sets `start_year` to kAtcInvalidYear, if the zone has no steady state. A zone
+ * has a steady state if its final ZoneEra never ends, and its ZonePolicy
+ * contains exactly 2 rules which never end, whose transitions occur between
+ * February and November, so that they never cross the boundary of a year. The
+ * wall time before and after each transition must also stay within the day of
+ * the rule.
+ */
+int8_t atc_steady_state_init(
+    AtcSteadyState *state,
+    const AtcZoneInfo *zone_info);
+
+/** Return true if the given year can be calculated using the steady state. */
+bool atc_steady_state_is_valid_for_year(
+    const AtcSteadyState *state,
+    int16_t year);
+
+/**
+ * Calculate the Unix seconds of the 2 transitions of the given year, in the
+ * same order as `state.rules`. The year must be valid for the steady state.
+ */
+void atc_steady_state_transitions_for_year(
+    const AtcSteadyState *state,
+    int16_t year,
+    int64_t unix_seconds[2]);
+
+/**
+ * Find the AtcFindResult at the given unix_seconds. Same semantics as
+ * atc_processor_find_by_epoch_seconds(). Returns `result.type ==
+ * kAtcFindResultNotFound` if the UTC year is not valid for the steady state.
+ * The transitions of the year are cached in `state`, so that the following
+ * lookups in the same year do not recalculate them.
+ */
+void atc_steady_state_find_by_unix_seconds(
+    AtcSteadyState *state,
+    int64_t unix_seconds,
+    AtcFindResult *result);
+
+/**
+ * Same as atc_steady_state_find_by_unix_seconds() but using epoch seconds
+ * relative to the current epoch year.
+ */
+void atc_steady_state_find_by_epoch_seconds(
+    AtcSteadyState *state,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result);
+
+/**
+ * Find the AtcFindResult at the given PlainDateTime. Same semantics as
+ * atc_processor_find_by_plain_date_time(). Returns `result.type ==
+ * kAtcFindResultNotFound` if the year is not valid for the steady state.
+ */
+void atc_steady_state_find_by_plain_date_time(
+    AtcSteadyState *state,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
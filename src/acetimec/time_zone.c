@@ -4,19 +4,158 @@
  */
 
 #include <stdbool.h>
-#include <string.h> // memcpy()
+#include <string.h> // memcpy(), strncpy()
 #include "plain_date.h" // kAtcInvalidEpochSeconds
+#include "epoch.h" // atc_epoch_to_unix_seconds()
 #include "../zoneinfo/zone_info_utils.h" // atc_zone_info_zone_name()
 #include "zone_processor.h"
 #include "offset_date_time.h" // AtcOffsetDateTime
 #include "zoned_extra.h" // AtcZonedExtra
+#include "transition_iterator.h" // AtcZoneTransition
+#include "tzif.h" // atc_tzif_find_by_unix_seconds()
 #include "time_zone.h"
 
 // A default time zone representing UTC.
-const AtcTimeZone atc_time_zone_utc = {NULL, NULL};
+const AtcTimeZone atc_time_zone_utc = {
+  NULL, NULL, kAtcTimeZoneTypeFixed, 0, 0, NULL
+};
 
 uint8_t resolve_for_result_type_and_fold(uint8_t frtype, uint8_t fold);
 
+AtcTimeZone atc_time_zone_for_zone_info(
+  const AtcZoneInfo *zone_info,
+  AtcZoneProcessor *zone_processor)
+{
+  AtcTimeZone tz = {
+    zone_info, zone_processor, kAtcTimeZoneTypeFixed, 0, 0, NULL
+  };
+  if (zone_info == NULL) return tz;
+
+  if (atc_zone_info_is_fixed_offset(zone_info)) {
+    tz.std_offset_seconds = atc_zone_era_std_offset_seconds(&zone_info->eras[0]);
+    tz.dst_offset_seconds = atc_zone_era_dst_offset_seconds(&zone_info->eras[0]);
+  } else {
+    tz.type = kAtcTimeZoneTypeProcessor;
+  }
+  return tz;
+}
+
+AtcTimeZone atc_time_zone_fixed(int32_t offset_seconds)
+{
+  AtcTimeZone tz = {
+    NULL, NULL, kAtcTimeZoneTypeFixed, offset_seconds, 0, NULL
+  };
+  return tz;
+}
+
+AtcTimeZone atc_time_zone_for_tzif(const AtcTzif *tzif)
+{
+  AtcTimeZone tz = {NULL, NULL, kAtcTimeZoneTypeTzif, 0, 0, tzif};
+  return tz;
+}
+
+const AtcEpoch *atc_time_zone_get_epoch(const AtcTimeZone *tz)
+{
+  return tz->zone_processor ? tz->zone_processor->epoch : NULL;
+}
+
+/**
+ * Fill the `result` and return true if the time zone has a fixed UTC offset.
+ * Time zones which are not classified (e.g. initialized as `{zone_info,
+ * zone_processor}`) are classified on the fly. If `abbrev` is not NULL, the
+ * abbreviation is written into it, and `result.abbrev` points to it.
+ */
+static bool atc_time_zone_find_fixed(
+    const AtcTimeZone *tz,
+    AtcFindResult *result,
+    char *abbrev)
+{
+  const AtcZoneInfo *info = tz->zone_info;
+  if (tz->type == kAtcTimeZoneTypeProcessor
+      || tz->type == kAtcTimeZoneTypeTzif) {
+    return false;
+  } else if (tz->type == kAtcTimeZoneTypeFixed) {
+    result->std_offset_seconds = tz->std_offset_seconds;
+    result->dst_offset_seconds = tz->dst_offset_seconds;
+  } else if (info == NULL) {
+    // Unclassified UTC
+    result->std_offset_seconds = 0;
+    result->dst_offset_seconds = 0;
+  } else if (atc_zone_info_is_fixed_offset(info)) {
+    result->std_offset_seconds = atc_zone_era_std_offset_seconds(&info->eras[0]);
+    result->dst_offset_seconds = atc_zone_era_dst_offset_seconds(&info->eras[0]);
+  } else {
+    return false;
+  }
+
+  result->type = kAtcFindResultExact;
+  result->fold = 0;
+  result->req_std_offset_seconds = result->std_offset_seconds;
+  result->req_dst_offset_seconds = result->dst_offset_seconds;
+  result->abbrev = abbrev;
+  result->valid_from_unix_seconds = INT64_MIN;
+  result->valid_until_unix_seconds = INT64_MAX;
+  if (abbrev == NULL) return true;
+
+  if (info != NULL) {
+    // Same as the AtcZoneProcessor for a simple era without a RULES policy,
+    // which uses an empty letter.
+    atc_processor_create_abbreviation(
+        abbrev,
+        kAtcAbbrevSize,
+        info->eras[0].format,
+        result->std_offset_seconds,
+        result->dst_offset_seconds,
+        "" /*letter_string*/);
+  } else if (result->std_offset_seconds + result->dst_offset_seconds == 0) {
+    memcpy(abbrev, "UTC", sizeof("UTC"));
+  } else {
+    // An empty FORMAT is the encoding of "%z", i.e. "+/-hh[mm[ss]]".
+    atc_processor_create_abbreviation(
+        abbrev,
+        kAtcAbbrevSize,
+        "",
+        result->std_offset_seconds,
+        result->dst_offset_seconds,
+        NULL /*letter_string*/);
+  }
+  return true;
+}
+
+/**
+ * Find the result at unix_seconds in a time zone whose UTC offsets are not
+ * fixed, using either its AtcTzif or its AtcZoneProcessor.
+ */
+static void atc_time_zone_find_by_unix_seconds(
+    const AtcTimeZone *tz,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    atc_tzif_find_by_unix_seconds(tz->tzif, unix_seconds, result);
+  } else {
+    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
+    atc_processor_find_by_unix_seconds(
+        tz->zone_processor, unix_seconds, result);
+  }
+}
+
+/** Same as atc_time_zone_find_by_unix_seconds() for a local date time. */
+static void atc_time_zone_find_by_plain_date_time(
+    const AtcTimeZone *tz,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result)
+{
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    atc_tzif_find_by_plain_date_time(tz->tzif, pdt, disambiguate, result);
+  } else {
+    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
+    atc_processor_find_by_plain_date_time(
+        tz->zone_processor, pdt, disambiguate, result);
+  }
+}
+
 // Adapted from TimeZone::getOffsetDateTime(epochSeconds) from the
 // AceTime library.
 void atc_time_zone_offset_date_time_from_epoch_seconds(
@@ -28,27 +167,35 @@ void atc_time_zone_offset_date_time_from_epoch_seconds(
     atc_offset_date_time_set_error(odt);
     return;
   }
+  int64_t unix_seconds = atc_epoch_to_unix_seconds(
+      atc_time_zone_get_epoch(tz), epoch_seconds);
+  atc_time_zone_offset_date_time_from_unix_seconds(tz, unix_seconds, odt);
+}
 
-  int32_t offset_seconds;
-  if (tz->zone_info) {
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
+void atc_time_zone_offset_date_time_from_unix_seconds(
+    const AtcTimeZone *tz,
+    int64_t unix_seconds,
+    AtcOffsetDateTime *odt)
+{
+  if (unix_seconds == kAtcInvalidUnixSeconds) {
+    atc_offset_date_time_set_error(odt);
+    return;
+  }
 
-    AtcFindResult result;
-    atc_processor_find_by_epoch_seconds(
-        tz->zone_processor, epoch_seconds, &result);
+  AtcFindResult result;
+  if (! atc_time_zone_find_fixed(tz, &result, NULL)) {
+    atc_time_zone_find_by_unix_seconds(tz, unix_seconds, &result);
     if (result.type == kAtcFindResultNotFound) {
       atc_offset_date_time_set_error(odt);
       return;
     }
-    offset_seconds = result.std_offset_seconds + result.dst_offset_seconds;
-  } else {
-    // Set to UTC
-    offset_seconds = 0;
   }
+  int32_t offset_seconds =
+      result.std_offset_seconds + result.dst_offset_seconds;
 
-  // resolved is always unique when looking up by epochSeconds
+  // resolved is always unique when looking up by unix seconds
   odt->resolved = kAtcResolvedUnique;
-  atc_offset_date_time_from_epoch_seconds(odt, epoch_seconds, offset_seconds);
+  atc_offset_date_time_from_unix_seconds(odt, unix_seconds, offset_seconds);
 }
 
 // Adapted from TimeZone::getOffsetDateTime(const PlainDatetime&) from the
@@ -66,48 +213,36 @@ void atc_time_zone_offset_date_time_from_plain_date_time(
     return;
   }
 
-  if (tz->zone_info) {
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
-
-    AtcFindResult result;
-    atc_processor_find_by_plain_date_time(
-      tz->zone_processor, pdt, disambiguate, &result);
+  AtcFindResult result;
+  if (! atc_time_zone_find_fixed(tz, &result, NULL)) {
+    atc_time_zone_find_by_plain_date_time(tz, pdt, disambiguate, &result);
     if (result.type == kAtcFindResultNotFound) {
       atc_offset_date_time_set_error(odt);
       return;
     }
+  }
 
-    // Convert FindResult into OffsetDateTime using the requested offset.
-    odt->year = pdt->year;
-    odt->month = pdt->month;
-    odt->day = pdt->day;
-    odt->hour = pdt->hour;
-    odt->minute = pdt->minute;
-    odt->second = pdt->second;
-    odt->offset_seconds =
-        result.req_std_offset_seconds + result.req_dst_offset_seconds;
-    odt->resolved = resolve_for_result_type_and_fold(result.type, result.fold);
-
-    // Special process for kAtcFindResultGap: Convert to epoch_seconds using the
-    // req_std_offset_seconds and req_dst_offset_seconds, then convert back to
-    // AtcOffsetDateTime using the target's std_offset_seconds and
-    // dst_offset_seconds.
-    if (result.type == kAtcFindResultGap) {
-      atc_time_t epoch_seconds = atc_offset_date_time_to_epoch_seconds(odt);
-      int32_t target_offset =
-          result.std_offset_seconds + result.dst_offset_seconds;
-      atc_offset_date_time_from_epoch_seconds(
-          odt, epoch_seconds, target_offset);
-    }
-  } else { // UTC or Error
-    odt->year = pdt->year;
-    odt->month = pdt->month;
-    odt->day = pdt->day;
-    odt->hour = pdt->hour;
-    odt->minute = pdt->minute;
-    odt->second = pdt->second;
-    odt->offset_seconds = 0;
-    odt->resolved = kAtcResolvedUnique;
+  // Convert FindResult into OffsetDateTime using the requested offset.
+  odt->year = pdt->year;
+  odt->month = pdt->month;
+  odt->day = pdt->day;
+  odt->hour = pdt->hour;
+  odt->minute = pdt->minute;
+  odt->second = pdt->second;
+  odt->offset_seconds =
+      result.req_std_offset_seconds + result.req_dst_offset_seconds;
+  odt->resolved = resolve_for_result_type_and_fold(result.type, result.fold);
+
+  // Special process for kAtcFindResultGap: Convert to unix_seconds using the
+  // req_std_offset_seconds and req_dst_offset_seconds, then convert back to
+  // AtcOffsetDateTime using the target's std_offset_seconds and
+  // dst_offset_seconds. Unix seconds do not depend on the epoch.
+  if (result.type == kAtcFindResultGap) {
+    int64_t unix_seconds = atc_offset_date_time_to_unix_seconds(odt);
+    int32_t target_offset =
+        result.std_offset_seconds + result.dst_offset_seconds;
+    atc_offset_date_time_from_unix_seconds(
+        odt, unix_seconds, target_offset);
   }
 }
 
@@ -120,33 +255,40 @@ void atc_time_zone_zoned_extra_from_epoch_seconds(
     atc_zoned_extra_set_error(extra);
     return;
   }
+  int64_t unix_seconds = atc_epoch_to_unix_seconds(
+      atc_time_zone_get_epoch(tz), epoch_seconds);
+  atc_time_zone_zoned_extra_from_unix_seconds(tz, unix_seconds, extra);
+}
 
-  if (tz->zone_info) {
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
+void atc_time_zone_zoned_extra_from_unix_seconds(
+  const AtcTimeZone *tz,
+  int64_t unix_seconds,
+  AtcZonedExtra *extra)
+{
+  if (unix_seconds == kAtcInvalidUnixSeconds) {
+    atc_zoned_extra_set_error(extra);
+    return;
+  }
 
-    AtcFindResult result;
-    atc_processor_find_by_epoch_seconds(
-        tz->zone_processor, epoch_seconds, &result);
+  AtcFindResult result;
+  if (! atc_time_zone_find_fixed(tz, &result, extra->abbrev)) {
+    atc_time_zone_find_by_unix_seconds(tz, unix_seconds, &result);
     if (result.type == kAtcFindResultNotFound) {
       atc_zoned_extra_set_error(extra);
       return;
     }
-
-    extra->resolved = kAtcResolvedUnique;
-    extra->std_offset_seconds = result.std_offset_seconds;
-    extra->dst_offset_seconds = result.dst_offset_seconds;
-    extra->req_std_offset_seconds = result.req_std_offset_seconds;
-    extra->req_dst_offset_seconds = result.req_dst_offset_seconds;
-    memcpy(extra->abbrev, result.abbrev, kAtcAbbrevSize);
+    // The abbreviation of an AtcTzif may be at the end of the file.
+    strncpy(extra->abbrev, result.abbrev, kAtcAbbrevSize - 1);
     extra->abbrev[kAtcAbbrevSize - 1] = '\0';
-  } else {
-    extra->resolved = kAtcResolvedUnique;
-    extra->std_offset_seconds = 0;
-    extra->dst_offset_seconds = 0;
-    extra->req_std_offset_seconds = 0;
-    extra->req_dst_offset_seconds = 0;
-    memcpy(extra->abbrev, "UTC", sizeof("UTC"));
   }
+
+  extra->resolved = kAtcResolvedUnique;
+  extra->std_offset_seconds = result.std_offset_seconds;
+  extra->dst_offset_seconds = result.dst_offset_seconds;
+  extra->req_std_offset_seconds = result.req_std_offset_seconds;
+  extra->req_dst_offset_seconds = result.req_dst_offset_seconds;
+  extra->valid_from_unix_seconds = result.valid_from_unix_seconds;
+  extra->valid_until_unix_seconds = result.valid_until_unix_seconds;
 }
 
 void atc_time_zone_zoned_extra_from_plain_date_time(
@@ -162,39 +304,68 @@ void atc_time_zone_zoned_extra_from_plain_date_time(
     return;
   }
 
-  if (tz->zone_info) {
-    atc_processor_init_for_zone_info(tz->zone_processor, tz->zone_info);
-
-    AtcFindResult result;
-    atc_processor_find_by_plain_date_time(
-      tz->zone_processor, pdt, disambiguate, &result);
+  AtcFindResult result;
+  if (! atc_time_zone_find_fixed(tz, &result, extra->abbrev)) {
+    atc_time_zone_find_by_plain_date_time(tz, pdt, disambiguate, &result);
     if (result.type == kAtcFindResultNotFound) {
       atc_zoned_extra_set_error(extra);
       return;
     }
-
-    extra->resolved = resolve_for_result_type_and_fold(
-        result.type, result.fold);
-    extra->std_offset_seconds = result.std_offset_seconds;
-    extra->dst_offset_seconds = result.dst_offset_seconds;
-    extra->req_std_offset_seconds = result.req_std_offset_seconds;
-    extra->req_dst_offset_seconds = result.req_dst_offset_seconds;
-    memcpy(extra->abbrev, result.abbrev, kAtcAbbrevSize);
+    // The abbreviation of an AtcTzif may be at the end of the file.
+    strncpy(extra->abbrev, result.abbrev, kAtcAbbrevSize - 1);
     extra->abbrev[kAtcAbbrevSize - 1] = '\0';
-  } else {
-    extra->resolved = kAtcResolvedUnique;
-    extra->std_offset_seconds = 0;
-    extra->dst_offset_seconds = 0;
-    extra->req_std_offset_seconds = 0;
-    extra->req_dst_offset_seconds = 0;
-    memcpy(extra->abbrev, "UTC", sizeof("UTC"));
   }
+
+  extra->resolved = resolve_for_result_type_and_fold(
+      result.type, result.fold);
+  extra->std_offset_seconds = result.std_offset_seconds;
+  extra->dst_offset_seconds = result.dst_offset_seconds;
+  extra->req_std_offset_seconds = result.req_std_offset_seconds;
+  extra->req_dst_offset_seconds = result.req_dst_offset_seconds;
+  extra->valid_from_unix_seconds = result.valid_from_unix_seconds;
+  extra->valid_until_unix_seconds = result.valid_until_unix_seconds;
+}
+
+bool atc_time_zone_next_transition(
+    const AtcTimeZone *tz,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  AtcFindResult result;
+  if (unix_seconds == kAtcInvalidUnixSeconds) return false;
+  if (atc_time_zone_find_fixed(tz, &result, NULL)) return false;
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    return atc_tzif_next_transition(tz->tzif, unix_seconds, transition);
+  }
+  return atc_zone_transition_find_next(
+      tz->zone_processor, tz->zone_info, unix_seconds, transition);
+}
+
+bool atc_time_zone_prev_transition(
+    const AtcTimeZone *tz,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  AtcFindResult result;
+  if (unix_seconds == kAtcInvalidUnixSeconds) return false;
+  if (atc_time_zone_find_fixed(tz, &result, NULL)) return false;
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    return atc_tzif_prev_transition(tz->tzif, unix_seconds, transition);
+  }
+  return atc_zone_transition_find_prev(
+      tz->zone_processor, tz->zone_info, unix_seconds, transition);
 }
 
 void atc_time_zone_print(AtcStringBuffer *sb, const AtcTimeZone *tz)
 {
-  if (tz->zone_info == NULL) {
-    atc_print_string(sb, "UTC");
+  if (tz->type == kAtcTimeZoneTypeTzif) {
+    atc_print_string(sb, tz->tzif->name);
+  } else if (tz->zone_info == NULL) {
+    // "UTC" or the "+/-hh[mm[ss]]" of an atc_time_zone_fixed().
+    AtcFindResult result;
+    char abbrev[kAtcAbbrevSize];
+    atc_time_zone_find_fixed(tz, &result, abbrev);
+    atc_print_string(sb, abbrev);
   } else {
     atc_print_string(sb, atc_zone_info_zone_name(tz->zone_info));
   }
@@ -27,6 +27,37 @@ typedef struct AtcOffsetDateTime AtcOffsetDateTime;
 /** Forward declaration for AtcZonedExtra. */
 typedef struct AtcZonedExtra AtcZonedExtra;
 
+/** Forward declaration for AtcZoneTransition. */
+typedef struct AtcZoneTransition AtcZoneTransition;
+
+/** Forward declaration for AtcTzif. */
+typedef struct AtcTzif AtcTzif;
+
+/** Values of the AtcTimeZone.type field. */
+enum {
+  /**
+   * Not yet classified, for example an AtcTimeZone initialized as
+   * `{zone_info, zone_processor}`. The zone is classified on each conversion.
+   * If `zone_info` is NULL, the time zone is UTC.
+   */
+  kAtcTimeZoneTypeUnclassified = 0,
+
+  /** The UTC offsets are calculated by the `zone_processor`. */
+  kAtcTimeZoneTypeProcessor = 1,
+
+  /**
+   * The UTC offsets never change, and are stored in the AtcTimeZone. The
+   * `zone_processor` is not used, and can be NULL.
+   */
+  kAtcTimeZoneTypeFixed = 2,
+
+  /**
+   * The UTC offsets are read from the TZif file of `tzif`. The `zone_info` and
+   * `zone_processor` are not used, and are NULL.
+   */
+  kAtcTimeZoneTypeTzif = 3,
+};
+
 /** A data structure that represents a specific Time Zone. */
 typedef struct AtcTimeZone {
   /** Pointer to an AtcZoneInfo that contains the IANA TZ database info. */
@@ -37,11 +68,55 @@ typedef struct AtcTimeZone {
    * to calculate the DST transitions of the particular time zone.
    */
   AtcZoneProcessor *zone_processor;
+
+  /** Classification of the time zone, kAtcTimeZoneTypeXxx. */
+  uint8_t type;
+
+  /** STD offset of a kAtcTimeZoneTypeFixed zone. */
+  int32_t std_offset_seconds;
+
+  /** DST offset of a kAtcTimeZoneTypeFixed zone. */
+  int32_t dst_offset_seconds;
+
+  /** The TZif file of a kAtcTimeZoneTypeTzif zone. */
+  const AtcTzif *tzif;
 } AtcTimeZone;
 
 /** A default time zone instance representing UTC. */
 extern const AtcTimeZone atc_time_zone_utc;
 
+/**
+ * Create an AtcTimeZone for the given zone_info, classified as either
+ * kAtcTimeZoneTypeFixed or kAtcTimeZoneTypeProcessor. A zone with a single
+ * AtcZoneEra without DST rules (e.g. "Etc/GMT+5") is a fixed-offset zone,
+ * whose conversions are pure arithmetic which do not use the
+ * `zone_processor`. A NULL zone_info creates UTC.
+ */
+AtcTimeZone atc_time_zone_for_zone_info(
+  const AtcZoneInfo *zone_info,
+  AtcZoneProcessor *zone_processor);
+
+/**
+ * Create a fixed-offset AtcTimeZone which is not associated with an
+ * AtcZoneInfo. The abbreviation is "UTC" if offset_seconds is 0, otherwise
+ * the "+/-hh[mm[ss]]" form of the offset.
+ */
+AtcTimeZone atc_time_zone_fixed(int32_t offset_seconds);
+
+/**
+ * Create an AtcTimeZone which uses the transitions and the footer of a TZif
+ * file loaded by atc_tzif_init() or atc_tzif_open_zone(). The AtcTzif must
+ * outlive the AtcTimeZone.
+ */
+AtcTimeZone atc_time_zone_for_tzif(const AtcTzif *tzif);
+
+/**
+ * Return the epoch used to interpret the epoch seconds of the time zone: the
+ * AtcEpoch bound to `tz.zone_processor` by atc_processor_set_epoch(), or NULL
+ * for the current epoch year of the library.
+ */
+const AtcEpoch *atc_time_zone_get_epoch(const AtcTimeZone *tz);
+
 /**
  * Convert epoch_seconds to an AtcOffsetDateTime using the given time zone.
  * The `tz.zone_processor` is rebound to the `zone_info` in case it was
@@ -54,6 +129,18 @@ void atc_time_zone_offset_date_time_from_epoch_seconds(
   atc_time_t epoch_seconds,
   AtcOffsetDateTime *odt);
 
+/**
+ * Convert 64-bit unix_seconds to an AtcOffsetDateTime using the given time
+ * zone. Unlike atc_time_zone_offset_date_time_from_epoch_seconds(), the epoch
+ * of the time zone is not used, so all years [1,9999] are supported.
+ *
+ * Returns `odt` in an error state upon failure.
+ */
+void atc_time_zone_offset_date_time_from_unix_seconds(
+  const AtcTimeZone *tz,
+  int64_t unix_seconds,
+  AtcOffsetDateTime *odt);
+
 /**
  * Convert the PlainDateTime to AtcOffsetDateTime using the given time zone.
  * The `tz.zone_processor` is rebound to the `zone_info` in case it was
@@ -79,6 +166,15 @@ void atc_time_zone_zoned_extra_from_epoch_seconds(
   atc_time_t epoch_seconds,
   AtcZonedExtra *extra);
 
+/**
+ * Same as atc_time_zone_zoned_extra_from_epoch_seconds() using 64-bit
+ * unix_seconds, independent of the epoch.
+ */
+void atc_time_zone_zoned_extra_from_unix_seconds(
+  const AtcTimeZone *tz,
+  int64_t unix_seconds,
+  AtcZonedExtra *extra);
+
 /**
  * Populate the ZonedExtra using the given local date time for the time zone.
  * The `tz.zone_processor` is rebound to the `zone_info` in case it was
@@ -92,6 +188,28 @@ void atc_time_zone_zoned_extra_from_plain_date_time(
   uint8_t disambiguate,
   AtcZonedExtra *extra);
 
+/**
+ * Find the first transition of the time zone which starts strictly after
+ * unix_seconds, i.e. the instant when the current UTC offset stops being
+ * valid. Returns false if there is none, for example for a fixed-offset zone.
+ * See atc_zone_transition_find_next().
+ */
+bool atc_time_zone_next_transition(
+  const AtcTimeZone *tz,
+  int64_t unix_seconds,
+  AtcZoneTransition *transition);
+
+/**
+ * Find the last transition of the time zone which starts at or before
+ * unix_seconds, i.e. the instant when the current UTC offset became valid.
+ * Returns false if there is none, for example for a fixed-offset zone. See
+ * atc_zone_transition_find_prev().
+ */
+bool atc_time_zone_prev_transition(
+  const AtcTimeZone *tz,
+  int64_t unix_seconds,
+  AtcZoneTransition *transition);
+
 /** Print the name of the current time zone. */
 void atc_time_zone_print(AtcStringBuffer *sb, const AtcTimeZone *tz);
 
@@ -16,6 +16,10 @@ void atc_transition_storage_init(
     AtcTransitionStorage *ts, const AtcZoneInfo *zone_info)
 {
   ts->zone_info = zone_info;
+  ts->policy_cache = NULL;
+#if ACE_TIME_C_PROCESSOR_STATS
+  ts->stats = NULL;
+#endif
 
   for (int i = 0; i < kAtcTransitionStorageSize; i++) {
     ts->transitions[i] = &ts->transition_pool[i];
@@ -406,3 +410,158 @@ AtcTransitionForDateTime atc_transition_storage_find_for_date_time(
   AtcTransitionForDateTime result = {prev, curr, num};
   return result;
 }
+
+AtcTransitionForSeconds atc_transition_storage_find_for_unix_seconds(
+    const AtcTransitionStorage *ts,
+    int64_t unix_seconds)
+{
+  // Number of transitions which start at or before unix_seconds.
+  uint8_t k = 0;
+  for (uint8_t i = 0; i < ts->index_free; i++) {
+    k += (ts->transitions[i]->start_unix_seconds <= unix_seconds);
+  }
+
+  if (k == 0) {
+    AtcTransitionForSeconds result = {NULL, 0, 0};
+    return result;
+  }
+
+  // Same as atc_calculate_fold_and_overlap(), using unix seconds.
+  uint8_t curr = k - 1;
+  uint8_t fold = 0;
+  uint8_t num = 1;
+  const AtcTransition *t = ts->transitions[curr];
+  if (curr > 0) {
+    int32_t shift = (int32_t) atc_date_tuple_subtract(
+        &t->start_dt, &ts->transitions[curr - 1]->until_dt);
+    if (shift < 0 && unix_seconds - t->start_unix_seconds < -shift) {
+      fold = 1;
+      num = 2;
+    }
+  }
+  if (num == 1 && k < ts->index_free) {
+    const AtcTransition *next = ts->transitions[k];
+    int32_t shift = (int32_t) atc_date_tuple_subtract(
+        &next->start_dt, &t->until_dt);
+    if (shift < 0 && next->start_unix_seconds - unix_seconds <= -shift) {
+      num = 2;
+    }
+  }
+  AtcTransitionForSeconds result = {t, fold, num};
+  return result;
+}
+
+//---------------------------------------------------------------------------
+
+/**
+ * Pack the (year, month, day, seconds) into a single integer with the same
+ * ordering as atc_date_tuple_compare(). The seconds field is biased so that
+ * negative values, and values beyond 24:00, are allowed within about 24 days.
+ */
+static int64_t atc_transition_keys_pack(
+    int16_t year, uint8_t month, uint8_t day, int32_t seconds)
+{
+  return ((((int64_t) year * 16 + month) * 32 + day) << 22)
+      + (seconds + ((int32_t) 1 << 21));
+}
+
+void atc_transition_keys_init(
+    AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts)
+{
+  keys->num = ts->index_free;
+  for (uint8_t i = 0; i < ts->index_free; i++) {
+    const AtcTransition *t = ts->transitions[i];
+    keys->start_unix_seconds[i] = t->start_unix_seconds;
+    keys->start_keys[i] = atc_transition_keys_pack(
+        t->start_dt.year, t->start_dt.month, t->start_dt.day,
+        t->start_dt.seconds);
+    keys->until_keys[i] = atc_transition_keys_pack(
+        t->until_dt.year, t->until_dt.month, t->until_dt.day,
+        t->until_dt.seconds);
+    keys->shift_seconds[i] = (i == 0)
+        ? 0
+        : (int32_t) atc_date_tuple_subtract(
+            &t->start_dt, &ts->transitions[i - 1]->until_dt);
+  }
+}
+
+AtcTransitionForSeconds atc_transition_keys_find_for_unix_seconds(
+    const AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts,
+    int64_t unix_seconds)
+{
+  // The start times are sorted, so the number of transitions which start at
+  // or before unix_seconds is the index of the next transition. The loop
+  // body compiles to a compare and add, without a branch.
+  uint8_t k = 0;
+  for (uint8_t i = 0; i < keys->num; i++) {
+    k += (keys->start_unix_seconds[i] <= unix_seconds);
+  }
+
+  if (k == 0) {
+    AtcTransitionForSeconds result = {NULL, 0, 0};
+    return result;
+  }
+
+  // Same as atc_calculate_fold_and_overlap(), using the precalculated shifts
+  // instead of subtracting the AtcDateTuple of adjacent transitions.
+  uint8_t curr = k - 1;
+  uint8_t fold = 0;
+  uint8_t num = 1;
+  int32_t shift = keys->shift_seconds[curr];
+  if (curr > 0 && shift < 0
+      && unix_seconds - keys->start_unix_seconds[curr] < -shift) {
+    fold = 1;
+    num = 2;
+  } else if (k < keys->num) {
+    shift = keys->shift_seconds[k];
+    if (shift < 0 && keys->start_unix_seconds[k] - unix_seconds <= -shift) {
+      num = 2;
+    }
+  }
+  AtcTransitionForSeconds result = {ts->transitions[curr], fold, num};
+  return result;
+}
+
+AtcTransitionForDateTime atc_transition_keys_find_for_date_time(
+    const AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts,
+    const AtcPlainDateTime *pdt)
+{
+  int64_t key = atc_transition_keys_pack(
+      pdt->year, pdt->month, pdt->day,
+      (pdt->hour * (int32_t) 60 + pdt->minute) * 60 + pdt->second);
+
+  // Number of transitions which start at or before pdt.
+  uint8_t k = 0;
+  for (uint8_t i = 0; i < keys->num; i++) {
+    k += (keys->start_keys[i] <= key);
+  }
+
+  // Only the last 2 transitions which start at or before pdt can contain pdt.
+  // If both do, pdt is in an overlap. If neither does, pdt is in a gap
+  // before transitions[k] (or in the far future if k == num).
+  bool is_curr_match = (k >= 1) && (key < keys->until_keys[k - 1]);
+  bool is_prev_match = (k >= 2) && (key < keys->until_keys[k - 2]);
+
+  AtcTransitionForDateTime result;
+  if (is_prev_match && is_curr_match) {
+    result.prev = ts->transitions[k - 2];
+    result.curr = ts->transitions[k - 1];
+    result.num = 2;
+  } else if (is_curr_match) {
+    result.prev = ts->transitions[k - 1];
+    result.curr = result.prev;
+    result.num = 1;
+  } else if (is_prev_match) {
+    result.prev = ts->transitions[k - 2];
+    result.curr = result.prev;
+    result.num = 1;
+  } else {
+    result.prev = (k >= 1) ? ts->transitions[k - 1] : NULL;
+    result.curr = (k < keys->num) ? ts->transitions[k] : NULL;
+    result.num = 0;
+  }
+  return result;
+}
@@ -17,11 +17,40 @@
 #include "common.h" // atc_time_t
 #include "plain_date_time.h" // AtcPlainDateTime
 #include "date_tuple.h" // AtcDateTuple
+#include "policy_cache.h" // AtcPolicyCache
+
+#ifndef ACE_TIME_C_TRANSITION_KEYS
+/**
+ * Set to 1 to keep a copy of the search keys of the active transitions
+ * (AtcTransitionKeys, 232 bytes on a 64-bit host) in each AtcZoneProcessor,
+ * so that the lookups do not follow the pointers to the transitions. Set to 0
+ * to save that RAM, and search the transitions directly. Enabled by default,
+ * except on microcontrollers (ARDUINO).
+ */
+#if defined(ARDUINO)
+#define ACE_TIME_C_TRANSITION_KEYS 0
+#else
+#define ACE_TIME_C_TRANSITION_KEYS 1
+#endif
+#endif
+
+#ifndef ACE_TIME_C_PROCESSOR_STATS
+/**
+ * Set to 1 (e.g. through the Makefile) to collect the AtcProcessorStats of
+ * each AtcZoneProcessor and to call its AtcProcessorStepCallback. Disabled by
+ * default, so that the counters cost neither time nor RAM. The stats fields of
+ * AtcZoneProcessor and AtcTransitionStorage exist only if enabled, so the
+ * library and the application must be compiled with the same value.
+ */
+#define ACE_TIME_C_PROCESSOR_STATS 0
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct AtcProcessorStats;
+
 //---------------------------------------------------------------------------
 
 enum {
@@ -130,6 +159,12 @@ typedef struct AtcTransition {
   /** The calculated transition time of the given rule. */
   atc_time_t start_epoch_seconds;
 
+  /**
+   * The calculated transition time as 64-bit unix seconds, which does not
+   * depend on the epoch, or kAtcInvalidUnixSeconds if before the year 1.
+   */
+  int64_t start_unix_seconds;
+
   /** The STD offset seconds, not the total effective UTC offset. */
   int32_t offset_seconds;
 
@@ -169,6 +204,17 @@ typedef struct AtcTransitionStorage {
    */
   const AtcZoneInfo *zone_info;
 
+  /**
+   * Optional cache of the transition times of the ZonePolicy rules, shared
+   * with other zones. NULL if not used.
+   */
+  AtcPolicyCache *policy_cache;
+
+#if ACE_TIME_C_PROCESSOR_STATS
+  /** Statistics of the AtcZoneProcessor which owns this storage, or NULL. */
+  struct AtcProcessorStats *stats;
+#endif
+
   /** A pool of AtcTransition objects. */
   AtcTransition transition_pool[kAtcTransitionStorageSize];
   /** Pointers into the pool of AtcTransition objects. */
@@ -357,6 +403,15 @@ AtcTransitionForSeconds atc_transition_storage_find_for_seconds(
     const AtcTransitionStorage *ts,
     atc_time_t epoch_seconds);
 
+/**
+ * Same as atc_transition_storage_find_for_seconds(), using 64-bit unix seconds
+ * instead of epoch seconds. Used by the AtcZoneProcessor when
+ * ACE_TIME_C_TRANSITION_KEYS is disabled.
+ */
+AtcTransitionForSeconds atc_transition_storage_find_for_unix_seconds(
+    const AtcTransitionStorage *ts,
+    int64_t unix_seconds);
+
 /**
  * The result returned by atc_transition_storage_find_for_date_time() when
  * searching for transitions by local date time. There are 5 possibilities:
@@ -389,6 +444,65 @@ AtcTransitionForDateTime atc_transition_storage_find_for_date_time(
     const AtcTransitionStorage *ts,
     const AtcPlainDateTime *pdt);
 
+//---------------------------------------------------------------------------
+
+/**
+ * A contiguous, key-only copy of the active transitions of an
+ * AtcTransitionStorage. The finders below search these arrays using a
+ * branchless count over the keys, instead of following the pointers of
+ * AtcTransitionStorage.transitions and comparing AtcDateTuple fields one at a
+ * time. The wall time keys pack the (year, month, day, seconds) of an
+ * AtcDateTuple into a single integer which preserves the ordering of
+ * atc_date_tuple_compare().
+ */
+typedef struct AtcTransitionKeys {
+  /** Copy of AtcTransition.start_unix_seconds. */
+  int64_t start_unix_seconds[kAtcTransitionStorageSize];
+
+  /** Packed AtcTransition.start_dt. */
+  int64_t start_keys[kAtcTransitionStorageSize];
+
+  /** Packed AtcTransition.until_dt. */
+  int64_t until_keys[kAtcTransitionStorageSize];
+
+  /**
+   * Shift of the wall time at the start of each transition, relative to the
+   * until time of the previous transition. Negative for a "fall back". The
+   * first element is always 0.
+   */
+  int32_t shift_seconds[kAtcTransitionStorageSize];
+
+  /** Number of active transitions. */
+  uint8_t num;
+} AtcTransitionKeys;
+
+/**
+ * Copy the keys of the active transitions of the AtcTransitionStorage. Must be
+ * called again whenever the transitions are regenerated.
+ */
+void atc_transition_keys_init(
+    AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts);
+
+/**
+ * Same as atc_transition_storage_find_for_seconds(), using the `keys` which
+ * were created from the `ts`, and 64-bit unix seconds instead of epoch
+ * seconds.
+ */
+AtcTransitionForSeconds atc_transition_keys_find_for_unix_seconds(
+    const AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts,
+    int64_t unix_seconds);
+
+/**
+ * Same as atc_transition_storage_find_for_date_time(), using the `keys` which
+ * were created from the `ts`.
+ */
+AtcTransitionForDateTime atc_transition_keys_find_for_date_time(
+    const AtcTransitionKeys *keys,
+    const AtcTransitionStorage *ts,
+    const AtcPlainDateTime *pdt);
+
 #ifdef __cplusplus
 }
 #endif
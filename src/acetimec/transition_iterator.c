@@ -0,0 +1,324 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <string.h> // strcmp(), strncpy()
+#include "common.h"
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "plain_date_time.h" // atc_plain_date_time_from_unix_seconds()
+#include "transition.h"
+#include "zone_processor.h"
+#include "transition_iterator.h"
+
+/**
+ * Return the Unix seconds of year-01-01 00:00:00 UTC, for years in [2,10000].
+ * Uses the last day of the previous year, because kAtcMaxYear itself is not a
+ * valid date.
+ */
+static int64_t atc_transition_iterator_year_start(int16_t year)
+{
+  return (int64_t) 86400
+      * (atc_plain_date_to_unix_days(year - 1, 12, 31) + 1);
+}
+
+/** Make the given transition the one in effect before the next transition. */
+static void atc_transition_iterator_set_state(
+    AtcTransitionIterator *it,
+    const AtcTransition *t)
+{
+  it->std_offset_seconds = t->offset_seconds;
+  it->dst_offset_seconds = t->delta_seconds;
+  strncpy(it->abbrev, t->abbrev, kAtcAbbrevSize - 1);
+  it->abbrev[kAtcAbbrevSize - 1] = '\0';
+}
+
+/** Return true if the transition changes neither the offsets nor the abbrev. */
+static bool atc_transition_iterator_is_same_state(
+    const AtcTransitionIterator *it,
+    const AtcTransition *t)
+{
+  return it->std_offset_seconds == t->offset_seconds
+      && it->dst_offset_seconds == t->delta_seconds
+      && strcmp(it->abbrev, t->abbrev) == 0;
+}
+
+/**
+ * Return the first UTC year >= `year` which may contain a transition,
+ * according to the era boundaries and the [from_year, to_year] of the rules
+ * of the era in effect at `year`, or kAtcMaxYear if there is none. The years
+ * of the eras and rules are in local time, so they are widened by one year on
+ * each side, to cover the transitions near New Year which fall into the
+ * previous or the next UTC year.
+ */
+static int16_t atc_zone_transition_next_year(
+    const AtcZoneInfo *zone_info,
+    int16_t year)
+{
+  for (uint8_t i = 0; i < zone_info->num_eras; i++) {
+    const AtcZoneEra *era = &zone_info->eras[i];
+    if (era->until_year + 1 < year) continue;
+
+    int32_t candidate = kAtcMaxYear;
+    if (i + 1 < zone_info->num_eras) candidate = era->until_year;
+    const AtcZonePolicy *policy = era->zone_policy;
+    if (policy) {
+      for (uint8_t r = 0; r < policy->num_rules; r++) {
+        const AtcZoneRule *rule = &policy->rules[r];
+        if (rule->to_year + 1 < year) continue;
+        int32_t from_year = (rule->from_year < year) ? year : rule->from_year;
+        if (from_year < candidate) candidate = from_year;
+      }
+    }
+    if (candidate >= kAtcMaxYear) return kAtcMaxYear;
+    return (candidate - 1 < year) ? year : (int16_t) (candidate - 1);
+  }
+  return kAtcMaxYear;
+}
+
+int8_t atc_transition_iterator_init(
+    AtcTransitionIterator *it,
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t start_unix_seconds,
+    int64_t until_unix_seconds)
+{
+  it->processor = processor;
+  it->zone_info = zone_info;
+  it->start_unix_seconds = start_unix_seconds;
+  it->until_unix_seconds = until_unix_seconds;
+  it->year = kAtcInvalidYear;
+  it->index = 0;
+  it->std_offset_seconds = 0;
+  it->dst_offset_seconds = 0;
+  it->abbrev[0] = '\0';
+
+  // Restrict to the same range as atc_processor_init_for_year().
+  AtcPlainDateTime pdt;
+  atc_plain_date_time_from_unix_seconds(&pdt, start_unix_seconds);
+  if (atc_plain_date_time_is_error(&pdt)
+      || pdt.year <= kAtcMinYear
+      || pdt.year >= kAtcMaxYear) {
+    return kAtcErrGeneric;
+  }
+  int64_t max_unix_seconds = atc_transition_iterator_year_start(kAtcMaxYear);
+  if (it->until_unix_seconds > max_unix_seconds) {
+    it->until_unix_seconds = max_unix_seconds;
+  }
+
+  atc_processor_init_for_zone_info(processor, zone_info);
+  int8_t err = atc_processor_init_for_year(processor, pdt.year);
+  if (err) return err;
+
+  it->year = pdt.year;
+  it->year_start = atc_transition_iterator_year_start(pdt.year);
+  it->year_until = atc_transition_iterator_year_start(pdt.year + 1);
+
+  // Skip the transitions before the start, keeping the one in effect.
+  const AtcTransitionStorage *ts = &processor->transition_storage;
+  while (it->index < ts->index_free) {
+    const AtcTransition *t = ts->transitions[it->index];
+    if (t->start_unix_seconds >= start_unix_seconds) break;
+    atc_transition_iterator_set_state(it, t);
+    it->index++;
+  }
+  return kAtcErrOk;
+}
+
+bool atc_transition_iterator_next(
+    AtcTransitionIterator *it,
+    AtcZoneTransition *transition)
+{
+  if (it->year == kAtcInvalidYear) return false;
+
+  AtcZoneProcessor *processor = it->processor;
+  while (it->year_start < it->until_unix_seconds) {
+    // Both are no-ops unless the processor was used for something else
+    // between the calls.
+    atc_processor_init_for_zone_info(processor, it->zone_info);
+    int8_t err = atc_processor_init_for_year(processor, it->year);
+    if (err) break;
+
+    // Each year contributes only the transitions which start within the UTC
+    // year, the others belong to the previous or the next year.
+    const AtcTransitionStorage *ts = &processor->transition_storage;
+    while (it->index < ts->index_free) {
+      const AtcTransition *t = ts->transitions[it->index];
+      int64_t start_unix_seconds = t->start_unix_seconds;
+      if (start_unix_seconds >= it->year_until
+          || start_unix_seconds >= it->until_unix_seconds) {
+        break;
+      }
+      it->index++;
+      if (start_unix_seconds < it->year_start) continue;
+      if (atc_transition_iterator_is_same_state(it, t)) continue;
+
+      transition->start_unix_seconds = start_unix_seconds;
+      transition->std_offset_seconds = t->offset_seconds;
+      transition->dst_offset_seconds = t->delta_seconds;
+      transition->prev_std_offset_seconds = it->std_offset_seconds;
+      transition->prev_dst_offset_seconds = it->dst_offset_seconds;
+      atc_transition_iterator_set_state(it, t);
+      memcpy(transition->abbrev, it->abbrev, kAtcAbbrevSize);
+      return true;
+    }
+
+    // Skip the years in which the eras and the rules cannot produce a
+    // transition, without calculating their transitions.
+    it->year = atc_zone_transition_next_year(it->zone_info, it->year + 1);
+    if (it->year >= kAtcMaxYear) break;
+    it->year_start = atc_transition_iterator_year_start(it->year);
+    it->year_until = atc_transition_iterator_year_start(it->year + 1);
+    it->index = 0;
+  }
+
+  it->year = kAtcInvalidYear;
+  return false;
+}
+
+//---------------------------------------------------------------------------
+
+/** Copy transition `t`, which follows transition `prev`. */
+static void atc_zone_transition_set(
+    AtcZoneTransition *transition,
+    const AtcTransition *t,
+    const AtcTransition *prev)
+{
+  transition->start_unix_seconds = t->start_unix_seconds;
+  transition->std_offset_seconds = t->offset_seconds;
+  transition->dst_offset_seconds = t->delta_seconds;
+  transition->prev_std_offset_seconds = prev->offset_seconds;
+  transition->prev_dst_offset_seconds = prev->delta_seconds;
+  memcpy(transition->abbrev, t->abbrev, kAtcAbbrevSize);
+}
+
+/** Return true if `t` changes the offsets or the abbrev of `prev`. */
+static bool atc_zone_transition_is_change(
+    const AtcTransition *t,
+    const AtcTransition *prev)
+{
+  return t->offset_seconds != prev->offset_seconds
+      || t->delta_seconds != prev->delta_seconds
+      || strcmp(t->abbrev, prev->abbrev) != 0;
+}
+
+/**
+ * Return the last UTC year <= `year` which may contain a transition, or
+ * kAtcMinYear if there is none. The mirror image of
+ * atc_zone_transition_next_year(), returning the following year for a
+ * transition in a given year.
+ */
+static int16_t atc_zone_transition_prev_year(
+    const AtcZoneInfo *zone_info,
+    int16_t year)
+{
+  for (uint8_t i = 0; i < zone_info->num_eras; i++) {
+    const AtcZoneEra *era = &zone_info->eras[i];
+    if (era->until_year + 1 < year) continue;
+
+    // The boundary with the next era may fall within the year.
+    if (era->until_year - 1 <= year && i + 1 < zone_info->num_eras) {
+      return year;
+    }
+
+    int32_t candidate = kAtcMinYear;
+    if (i > 0) candidate = zone_info->eras[i - 1].until_year;
+    const AtcZonePolicy *policy = era->zone_policy;
+    if (policy) {
+      for (uint8_t r = 0; r < policy->num_rules; r++) {
+        const AtcZoneRule *rule = &policy->rules[r];
+        if (rule->from_year - 1 > year) continue;
+        int32_t to_year = (rule->to_year > year) ? year : rule->to_year;
+        if (to_year > candidate) candidate = to_year;
+      }
+    }
+    if (candidate <= kAtcMinYear) return kAtcMinYear;
+    return (candidate + 1 > year) ? year : (int16_t) (candidate + 1);
+  }
+  return year;
+}
+
+/** Return the UTC year of unix_seconds, or kAtcInvalidYear if out of range. */
+static int16_t atc_zone_transition_year(int64_t unix_seconds)
+{
+  AtcPlainDateTime pdt;
+  atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds);
+  if (atc_plain_date_time_is_error(&pdt)
+      || pdt.year <= kAtcMinYear
+      || pdt.year >= kAtcMaxYear) {
+    return kAtcInvalidYear;
+  }
+  return pdt.year;
+}
+
+bool atc_zone_transition_find_next(
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  int16_t year = atc_zone_transition_year(unix_seconds);
+  if (year == kAtcInvalidYear) return false;
+
+  atc_processor_init_for_zone_info(processor, zone_info);
+  while (true) {
+    year = atc_zone_transition_next_year(zone_info, year);
+    if (year >= kAtcMaxYear) break;
+    if (atc_processor_init_for_year(processor, year)) break;
+
+    int64_t year_start = atc_transition_iterator_year_start(year);
+    int64_t year_until = atc_transition_iterator_year_start(year + 1);
+    const AtcTransitionStorage *ts = &processor->transition_storage;
+    for (uint8_t i = 1; i < ts->index_free; i++) {
+      const AtcTransition *t = ts->transitions[i];
+      int64_t start_unix_seconds = t->start_unix_seconds;
+      if (start_unix_seconds >= year_until) break;
+      if (start_unix_seconds < year_start
+          || start_unix_seconds <= unix_seconds) {
+        continue;
+      }
+      const AtcTransition *prev = ts->transitions[i - 1];
+      if (! atc_zone_transition_is_change(t, prev)) continue;
+      atc_zone_transition_set(transition, t, prev);
+      return true;
+    }
+    year++;
+  }
+  return false;
+}
+
+bool atc_zone_transition_find_prev(
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  int16_t year = atc_zone_transition_year(unix_seconds);
+  if (year == kAtcInvalidYear) return false;
+
+  atc_processor_init_for_zone_info(processor, zone_info);
+  while (true) {
+    year = atc_zone_transition_prev_year(zone_info, year);
+    if (year <= kAtcMinYear) break;
+    if (atc_processor_init_for_year(processor, year)) break;
+
+    int64_t year_start = atc_transition_iterator_year_start(year);
+    int64_t year_until = atc_transition_iterator_year_start(year + 1);
+    const AtcTransitionStorage *ts = &processor->transition_storage;
+    for (uint8_t i = ts->index_free; i > 1; i--) {
+      const AtcTransition *t = ts->transitions[i - 1];
+      int64_t start_unix_seconds = t->start_unix_seconds;
+      if (start_unix_seconds < year_start) break;
+      if (start_unix_seconds >= year_until
+          || start_unix_seconds > unix_seconds) {
+        continue;
+      }
+      const AtcTransition *prev = ts->transitions[i - 2];
+      if (! atc_zone_transition_is_change(t, prev)) continue;
+      atc_zone_transition_set(transition, t, prev);
+      return true;
+    }
+    year--;
+  }
+  return false;
+}
@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file transition_iterator.h
+ *
+ * A streaming iterator over the transitions of a single zone within an
+ * interval [start, until) of Unix seconds. The iterator advances the
+ * AtcZoneProcessor one UTC year at a time, and takes from each year only the
+ * transitions which start within that year, so the 14-month windows of
+ * adjacent years never produce duplicate or missing transitions at the seams.
+ * The years in which the eras and the rules of the zone cannot produce a
+ * transition are skipped without calculating their transitions, like
+ * atc_zone_transition_find_next().
+ *
+ * Unlike the AtcTransitionTable, no buffer is needed, so any number of years
+ * can be traversed in a single pass.
+ */
+
+#ifndef ACE_TIME_C_TRANSITION_ITERATOR_H
+#define ACE_TIME_C_TRANSITION_ITERATOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "transition.h" // kAtcAbbrevSize
+#include "zone_processor.h" // AtcZoneProcessor
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A transition of a zone, returned by atc_transition_iterator_next(). The
+ * fields are copied out of the AtcZoneProcessor, so they remain valid after
+ * the processor moves to another year.
+ */
+typedef struct AtcZoneTransition {
+  /** Start time of the transition, in seconds since the Unix epoch (1970). */
+  int64_t start_unix_seconds;
+
+  /** The STD offset seconds after the transition. */
+  int32_t std_offset_seconds;
+
+  /** The DST offset seconds after the transition. */
+  int32_t dst_offset_seconds;
+
+  /** The STD offset seconds before the transition. */
+  int32_t prev_std_offset_seconds;
+
+  /** The DST offset seconds before the transition. */
+  int32_t prev_dst_offset_seconds;
+
+  /** The abbreviation after the transition, e.g. "PDT". */
+  char abbrev[kAtcAbbrevSize];
+} AtcZoneTransition;
+
+/**
+ * State of the iteration over the transitions of a zone. Consecutive
+ * transitions which do not change the STD offset, DST offset, or abbreviation
+ * are merged, like the AtcTransitionTable.
+ */
+typedef struct AtcTransitionIterator {
+  /** The work space used to calculate the transitions of each year. */
+  AtcZoneProcessor *processor;
+
+  /** The time zone of the transitions. */
+  const AtcZoneInfo *zone_info;
+
+  /** Start of the interval, inclusive. */
+  int64_t start_unix_seconds;
+
+  /** End of the interval, exclusive. */
+  int64_t until_unix_seconds;
+
+  /** Current UTC year, or kAtcInvalidYear when the iteration is done. */
+  int16_t year;
+
+  /** Unix seconds of year-01-01 00:00:00 UTC. */
+  int64_t year_start;
+
+  /** Unix seconds of (year+1)-01-01 00:00:00 UTC. */
+  int64_t year_until;
+
+  /** Index of the next transition of the year in the transition storage. */
+  uint8_t index;
+
+  /** The STD offset seconds in effect before the next transition. */
+  int32_t std_offset_seconds;
+
+  /** The DST offset seconds in effect before the next transition. */
+  int32_t dst_offset_seconds;
+
+  /** The abbreviation in effect before the next transition. */
+  char abbrev[kAtcAbbrevSize];
+} AtcTransitionIterator;
+
+/**
+ * Initialize the iterator over the transitions of `zone_info` which start
+ * within [start_unix_seconds, until_unix_seconds), using the given processor
+ * as a work space. The processor must not be used for another zone until the
+ * iteration is done. The `until_unix_seconds` is clamped to the year
+ * kAtcMaxYear.
+ *
+ * Returns kAtcErrGeneric if `start_unix_seconds` is outside of the years
+ * (kAtcMinYear, kAtcMaxYear). The iterator then returns no transition.
+ */
+int8_t atc_transition_iterator_init(
+    AtcTransitionIterator *it,
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t start_unix_seconds,
+    int64_t until_unix_seconds);
+
+/**
+ * Copy the next transition into `transition` and return true, or return false
+ * when there are no more transitions in the interval.
+ */
+bool atc_transition_iterator_next(
+    AtcTransitionIterator *it,
+    AtcZoneTransition *transition);
+
+//---------------------------------------------------------------------------
+
+/**
+ * Find the first transition of `zone_info` which starts strictly after
+ * `unix_seconds`, using the given processor as a work space. In other words,
+ * the instant when the UTC offset or the abbreviation in effect at
+ * `unix_seconds` stops being valid. The years in which the eras and the rules
+ * of the zone cannot produce a transition are skipped without calculating
+ * their transitions.
+ *
+ * Returns false if there is no such transition before the year kAtcMaxYear,
+ * or if `unix_seconds` is outside of the years (kAtcMinYear, kAtcMaxYear).
+ */
+bool atc_zone_transition_find_next(
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition);
+
+/**
+ * Find the last transition of `zone_info` which starts at or before
+ * `unix_seconds`, i.e. the transition which established the UTC offset and
+ * the abbreviation in effect at `unix_seconds`. The search goes backwards
+ * from the year of `unix_seconds`, skipping the years without transitions
+ * like atc_zone_transition_find_next().
+ *
+ * Returns false if there is no such transition after the year kAtcMinYear, or
+ * if `unix_seconds` is outside of the years (kAtcMinYear, kAtcMaxYear).
+ */
+bool atc_zone_transition_find_prev(
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
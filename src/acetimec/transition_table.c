@@ -0,0 +1,242 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include <string.h> // strcmp(), strncpy()
+#include "common.h"
+#include "epoch.h" // atc_unix_seconds_from_epoch_seconds()
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "transition.h"
+#include "zone_processor.h"
+#include "transition_table.h"
+
+void atc_transition_table_init(
+    AtcTransitionTable *table,
+    AtcTransitionTableEntry *entries,
+    uint16_t entries_size,
+    char (*abbrevs)[kAtcAbbrevSize],
+    uint8_t abbrevs_size)
+{
+  table->zone_info = NULL;
+  table->start_year = kAtcInvalidYear;
+  table->until_year = kAtcInvalidYear;
+  table->until_unix_seconds = kAtcInvalidUnixSeconds;
+  table->entries = entries;
+  table->entries_size = entries_size;
+  table->num_entries = 0;
+  table->abbrevs = abbrevs;
+  table->abbrevs_size = abbrevs_size;
+  table->num_abbrevs = 0;
+}
+
+/**
+ * Return the index of the abbreviation in the table, adding it if necessary.
+ * Returns -1 if the `abbrevs` array is full.
+ */
+static int16_t atc_transition_table_intern_abbrev(
+    AtcTransitionTable *table,
+    const char *abbrev)
+{
+  for (uint8_t i = 0; i < table->num_abbrevs; i++) {
+    if (strcmp(table->abbrevs[i], abbrev) == 0) return i;
+  }
+  if (table->num_abbrevs >= table->abbrevs_size) return -1;
+
+  char *dest = table->abbrevs[table->num_abbrevs];
+  strncpy(dest, abbrev, kAtcAbbrevSize - 1);
+  dest[kAtcAbbrevSize - 1] = '\0';
+  return table->num_abbrevs++;
+}
+
+/**
+ * Append the transition at the given unix seconds, unless it does not change
+ * the UTC offsets or the abbreviation of the previous entry. Returns
+ * kAtcErrGeneric if one of the buffers is full.
+ */
+static int8_t atc_transition_table_append(
+    AtcTransitionTable *table,
+    const AtcTransition *t,
+    int64_t start_unix_seconds)
+{
+  int16_t abbrev_index = atc_transition_table_intern_abbrev(table, t->abbrev);
+  if (abbrev_index < 0) return kAtcErrGeneric;
+
+  if (table->num_entries > 0) {
+    const AtcTransitionTableEntry *last =
+        &table->entries[table->num_entries - 1];
+    if (last->std_offset_seconds == t->offset_seconds
+        && last->dst_offset_seconds == t->delta_seconds
+        && last->abbrev_index == abbrev_index) {
+      return kAtcErrOk;
+    }
+  }
+  if (table->num_entries >= table->entries_size) return kAtcErrGeneric;
+
+  AtcTransitionTableEntry *entry = &table->entries[table->num_entries++];
+  entry->start_unix_seconds = start_unix_seconds;
+  entry->std_offset_seconds = t->offset_seconds;
+  entry->dst_offset_seconds = t->delta_seconds;
+  entry->abbrev_index = (uint8_t) abbrev_index;
+  return kAtcErrOk;
+}
+
+/**
+ * Append the transitions which start within the UTC year [year_start,
+ * year_until). Each year contributes only its own transitions, so that the
+ * 14-month windows of adjacent years do not produce duplicates. The first
+ * year of the table also contributes the transition which is already in effect
+ * at year_start, clamped to year_start.
+ */
+static int8_t atc_transition_table_append_year(
+    AtcTransitionTable *table,
+    const AtcTransitionStorage *ts,
+    int64_t year_start,
+    int64_t year_until)
+{
+  bool is_first = (table->num_entries == 0);
+  const AtcTransition *prior = NULL;
+  for (uint8_t i = 0; i < ts->index_free; i++) {
+    const AtcTransition *t = ts->transitions[i];
+    int64_t start_unix_seconds = t->start_unix_seconds;
+    if (start_unix_seconds < year_start
+        || (is_first && start_unix_seconds == year_start)) {
+      prior = t;
+      continue;
+    }
+    if (start_unix_seconds >= year_until) break;
+
+    if (is_first && prior != NULL) {
+      int8_t err = atc_transition_table_append(table, prior, year_start);
+      if (err) return err;
+      is_first = false;
+    }
+    int8_t err = atc_transition_table_append(table, t, start_unix_seconds);
+    if (err) return err;
+    is_first = false;
+  }
+  if (is_first && prior != NULL) {
+    return atc_transition_table_append(table, prior, year_start);
+  }
+  return kAtcErrOk;
+}
+
+int8_t atc_transition_table_build(
+    AtcTransitionTable *table,
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int16_t start_year,
+    int16_t until_year)
+{
+  table->zone_info = zone_info;
+  table->start_year = start_year;
+  table->until_year = until_year;
+  table->until_unix_seconds = kAtcInvalidUnixSeconds;
+  table->num_entries = 0;
+  table->num_abbrevs = 0;
+
+  // Restrict to the same range as atc_processor_init_for_year().
+  if (start_year <= kAtcMinYear
+      || until_year >= kAtcMaxYear
+      || start_year >= until_year) {
+    return kAtcErrGeneric;
+  }
+
+  atc_processor_init_for_zone_info(processor, zone_info);
+  int64_t year_start = (int64_t) 86400
+      * atc_plain_date_to_unix_days(start_year, 1, 1);
+  for (int16_t year = start_year; year < until_year; year++) {
+    int64_t year_until = (int64_t) 86400
+        * atc_plain_date_to_unix_days(year + 1, 1, 1);
+    int8_t err = atc_processor_init_for_year(processor, year);
+    if (! err) {
+      err = atc_transition_table_append_year(
+          table, &processor->transition_storage, year_start, year_until);
+    }
+    if (err) {
+      table->num_entries = 0;
+      table->num_abbrevs = 0;
+      return kAtcErrGeneric;
+    }
+    year_start = year_until;
+  }
+
+  table->until_unix_seconds = year_start;
+  return kAtcErrOk;
+}
+
+void atc_transition_table_find_by_unix_seconds(
+    const AtcTransitionTable *table,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+  uint16_t n = table->num_entries;
+  if (n == 0
+      || unix_seconds < table->entries[0].start_unix_seconds
+      || unix_seconds >= table->until_unix_seconds) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  // Find the last entry whose start is <= unix_seconds.
+  uint16_t lo = 0;
+  uint16_t hi = n;
+  while (hi - lo > 1) {
+    uint16_t mid = lo + (hi - lo) / 2;
+    if (table->entries[mid].start_unix_seconds <= unix_seconds) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  const AtcTransitionTableEntry *curr = &table->entries[lo];
+  int32_t curr_total = curr->std_offset_seconds + curr->dst_offset_seconds;
+
+  // Detect overlaps using the same rules as
+  // atc_transition_storage_find_for_seconds(): inside the shadow after a
+  // "fall back" from the previous entry selects fold=1, inside the shadow
+  // before a "fall back" to the next entry selects fold=0.
+  result->type = kAtcFindResultExact;
+  result->fold = 0;
+  if (lo > 0) {
+    const AtcTransitionTableEntry *prev = &table->entries[lo - 1];
+    int32_t shift = curr_total
+        - (prev->std_offset_seconds + prev->dst_offset_seconds);
+    if (shift < 0 && unix_seconds - curr->start_unix_seconds < -shift) {
+      result->type = kAtcFindResultOverlap;
+      result->fold = 1;
+    }
+  }
+  if (result->type == kAtcFindResultExact && lo + 1 < n) {
+    const AtcTransitionTableEntry *next = &table->entries[lo + 1];
+    int32_t shift = (next->std_offset_seconds + next->dst_offset_seconds)
+        - curr_total;
+    if (shift < 0 && next->start_unix_seconds - unix_seconds <= -shift) {
+      result->type = kAtcFindResultOverlap;
+    }
+  }
+
+  result->std_offset_seconds = curr->std_offset_seconds;
+  result->dst_offset_seconds = curr->dst_offset_seconds;
+  result->req_std_offset_seconds = curr->std_offset_seconds;
+  result->req_dst_offset_seconds = curr->dst_offset_seconds;
+  result->abbrev = table->abbrevs[curr->abbrev_index];
+  result->valid_from_unix_seconds = curr->start_unix_seconds;
+  result->valid_until_unix_seconds = (lo + 1 < n)
+      ? table->entries[lo + 1].start_unix_seconds
+      : table->until_unix_seconds;
+}
+
+void atc_transition_table_find_by_epoch_seconds(
+    const AtcTransitionTable *table,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result)
+{
+  if (epoch_seconds == kAtcInvalidEpochSeconds) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+  int64_t unix_seconds = atc_unix_seconds_from_epoch_seconds(epoch_seconds);
+  atc_transition_table_find_by_unix_seconds(table, unix_seconds, result);
+}
@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file transition_table.h
+ *
+ * A flat, sorted table of the transitions of a single zone over a range of
+ * years. The table is generated once using an AtcZoneProcessor, then lookups by
+ * epoch seconds or Unix seconds become a binary search over the table, instead
+ * of running the full transition pipeline of the zone processor for each year.
+ * This is useful for bulk conversions over a known range of years.
+ *
+ * The memory for the table is provided by the caller, so that no dynamic
+ * memory allocation is performed.
+ */
+
+#ifndef ACE_TIME_C_TRANSITION_TABLE_H
+#define ACE_TIME_C_TRANSITION_TABLE_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // atc_time_t
+#include "transition.h" // kAtcAbbrevSize
+#include "zone_processor.h" // AtcZoneProcessor, AtcFindResult
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A single transition in the AtcTransitionTable. */
+typedef struct AtcTransitionTableEntry {
+  /** Start time of the transition, in seconds since the Unix epoch (1970). */
+  int64_t start_unix_seconds;
+
+  /** The STD offset seconds after the transition. */
+  int32_t std_offset_seconds;
+
+  /** The DST offset seconds after the transition. */
+  int32_t dst_offset_seconds;
+
+  /** Index into AtcTransitionTable.abbrevs. */
+  uint8_t abbrev_index;
+} AtcTransitionTableEntry;
+
+/**
+ * A sorted array of transitions of a single zone, covering the UTC years
+ * [start_year, until_year). The first entry is the transition in effect at the
+ * start of start_year, with its start time clamped to start_year-01-01
+ * 00:00:00 UTC. Consecutive transitions which do not change the STD offset, DST
+ * offset, or abbreviation are merged.
+ */
+typedef struct AtcTransitionTable {
+  /** The time zone of the transitions. */
+  const AtcZoneInfo *zone_info;
+
+  /** Start year of the table, inclusive. */
+  int16_t start_year;
+
+  /** Until year of the table, exclusive. */
+  int16_t until_year;
+
+  /** Unix seconds of until_year-01-01 00:00:00 UTC, end of the table. */
+  int64_t until_unix_seconds;
+
+  /** Array of transitions, provided by the caller. */
+  AtcTransitionTableEntry *entries;
+
+  /** Number of elements in `entries`. */
+  uint16_t entries_size;
+
+  /** Number of valid transitions in `entries`. */
+  uint16_t num_entries;
+
+  /** Array of unique abbreviations, provided by the caller. */
+  char (*abbrevs)[kAtcAbbrevSize];
+
+  /** Number of elements in `abbrevs`. */
+  uint8_t abbrevs_size;
+
+  /** Number of valid abbreviations in `abbrevs`. */
+  uint8_t num_abbrevs;
+} AtcTransitionTable;
+
+/**
+ * Initialize the AtcTransitionTable with the caller-provided buffers. The
+ * table is empty until atc_transition_table_build() is called.
+ */
+void atc_transition_table_init(
+    AtcTransitionTable *table,
+    AtcTransitionTableEntry *entries,
+    uint16_t entries_size,
+    char (*abbrevs)[kAtcAbbrevSize],
+    uint8_t abbrevs_size);
+
+/**
+ * Fill the table with the transitions of the given zone for the UTC years
+ * [start_year, until_year), using the given processor as a work space. The
+ * transitions are calculated using Unix seconds, so the range of years is not
+ * limited by the current epoch year.
+ *
+ * Returns kAtcErrGeneric if the years are out of range, or if the `entries` or
+ * `abbrevs` buffers are too small. The table is left empty upon failure.
+ */
+int8_t atc_transition_table_build(
+    AtcTransitionTable *table,
+    AtcZoneProcessor *processor,
+    const AtcZoneInfo *zone_info,
+    int16_t start_year,
+    int16_t until_year);
+
+/**
+ * Find the AtcFindResult at the given unix_seconds using a binary search
+ * over the table, with the same semantics as
+ * atc_processor_find_by_epoch_seconds(). Returns `result.type ==
+ * kAtcFindResultNotFound` if unix_seconds is outside of the table.
+ */
+void atc_transition_table_find_by_unix_seconds(
+    const AtcTransitionTable *table,
+    int64_t unix_seconds,
+    AtcFindResult *result);
+
+/**
+ * Same as atc_transition_table_find_by_unix_seconds() but using epoch seconds
+ * relative to the current epoch year.
+ */
+void atc_transition_table_find_by_epoch_seconds(
+    const AtcTransitionTable *table,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
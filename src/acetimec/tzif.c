@@ -0,0 +1,842 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+// Required by open(), fstat() and mmap() with -std=c11.
+#if ! defined(_POSIX_C_SOURCE) && ! defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <string.h>
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "plain_date_time.h" // atc_plain_date_time_to_unix_seconds()
+#include "transition_iterator.h" // AtcZoneTransition
+#include "tzif.h"
+
+#if ACE_TIME_C_HAS_MMAP
+#include <fcntl.h> // open()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h> // close()
+#endif
+
+enum {
+  /** Size of the header of each data block. */
+  kAtcTzifHeaderSize = 44,
+
+  /** Size of a local time type record. */
+  kAtcTzifTypeSize = 6,
+};
+
+static uint32_t atc_tzif_read32(const uint8_t *p)
+{
+  return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16)
+      | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+static int64_t atc_tzif_read64(const uint8_t *p)
+{
+  uint64_t u = ((uint64_t) atc_tzif_read32(p) << 32) | atc_tzif_read32(p + 4);
+  return (int64_t) u;
+}
+
+//---------------------------------------------------------------------------
+// POSIX TZ string of the footer.
+//---------------------------------------------------------------------------
+
+static bool atc_tzif_is_alpha(char c)
+{
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+static bool atc_tzif_is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+/** Parse an unsigned integer of at most `max_digits` digits. */
+static bool atc_tzif_parse_uint(
+    const char **p,
+    const char *end,
+    uint8_t max_digits,
+    int32_t *value)
+{
+  int32_t v = 0;
+  uint8_t n = 0;
+  while (*p < end && atc_tzif_is_digit(**p) && n < max_digits) {
+    v = v * 10 + (**p - '0');
+    (*p)++;
+    n++;
+  }
+  *value = v;
+  return n > 0;
+}
+
+/** Parse an abbreviation, either alphabetic or quoted as "<...>". */
+static bool atc_tzif_parse_abbrev(
+    const char **p,
+    const char *end,
+    char *abbrev)
+{
+  const char *start = *p;
+  size_t len;
+  if (*p < end && **p == '<') {
+    start++;
+    (*p)++;
+    while (*p < end && (atc_tzif_is_alpha(**p) || atc_tzif_is_digit(**p)
+        || **p == '+' || **p == '-')) {
+      (*p)++;
+    }
+    len = (size_t) (*p - start);
+    if (*p >= end || **p != '>') return false;
+    (*p)++;
+  } else {
+    while (*p < end && atc_tzif_is_alpha(**p)) (*p)++;
+    len = (size_t) (*p - start);
+  }
+  if (len < 3) return false;
+
+  if (len > kAtcAbbrevSize - 1) len = kAtcAbbrevSize - 1;
+  memcpy(abbrev, start, len);
+  abbrev[len] = '\0';
+  return true;
+}
+
+/** Parse "[+-]hh[:mm[:ss]]" with hh in [0, max_hours]. */
+static bool atc_tzif_parse_hms(
+    const char **p,
+    const char *end,
+    int32_t max_hours,
+    int32_t *seconds)
+{
+  int32_t sign = 1;
+  if (*p < end && (**p == '+' || **p == '-')) {
+    if (**p == '-') sign = -1;
+    (*p)++;
+  }
+  int32_t hours;
+  int32_t minutes = 0;
+  int32_t secs = 0;
+  if (! atc_tzif_parse_uint(p, end, 3, &hours) || hours > max_hours) {
+    return false;
+  }
+  if (*p < end && **p == ':') {
+    (*p)++;
+    if (! atc_tzif_parse_uint(p, end, 2, &minutes) || minutes > 59) {
+      return false;
+    }
+    if (*p < end && **p == ':') {
+      (*p)++;
+      if (! atc_tzif_parse_uint(p, end, 2, &secs) || secs > 59) return false;
+    }
+  }
+  *seconds = sign * ((hours * 60 + minutes) * 60 + secs);
+  return true;
+}
+
+/** Parse ",date[/time]" of a DST rule. */
+static bool atc_tzif_parse_rule(
+    const char **p,
+    const char *end,
+    AtcTzifRule *rule)
+{
+  if (*p >= end || **p != ',') return false;
+  (*p)++;
+
+  int32_t value;
+  memset(rule, 0, sizeof(*rule));
+  if (*p < end && **p == 'J') {
+    (*p)++;
+    if (! atc_tzif_parse_uint(p, end, 3, &value)
+        || value < 1 || value > 365) {
+      return false;
+    }
+    rule->kind = kAtcTzifRuleJulian;
+    rule->day = (uint16_t) value;
+  } else if (*p < end && **p == 'M') {
+    int32_t week;
+    int32_t weekday;
+    (*p)++;
+    if (! atc_tzif_parse_uint(p, end, 2, &value) || value < 1 || value > 12
+        || *p >= end || *(*p)++ != '.'
+        || ! atc_tzif_parse_uint(p, end, 1, &week) || week < 1 || week > 5
+        || *p >= end || *(*p)++ != '.'
+        || ! atc_tzif_parse_uint(p, end, 1, &weekday) || weekday > 6) {
+      return false;
+    }
+    rule->kind = kAtcTzifRuleMonth;
+    rule->month = (uint8_t) value;
+    rule->week = (uint8_t) week;
+    rule->weekday = (uint8_t) weekday;
+  } else {
+    if (! atc_tzif_parse_uint(p, end, 3, &value) || value > 365) return false;
+    rule->kind = kAtcTzifRuleDay;
+    rule->day = (uint16_t) value;
+  }
+
+  rule->time_seconds = 2 * 3600;
+  if (*p < end && **p == '/') {
+    (*p)++;
+    return atc_tzif_parse_hms(p, end, 167, &rule->time_seconds);
+  }
+  return true;
+}
+
+int8_t atc_tzif_parse_footer(
+    AtcTzifFooter *footer,
+    const char *s,
+    size_t size)
+{
+  const char *p = s;
+  const char *end = s + size;
+  int32_t offset;
+  memset(footer, 0, sizeof(*footer));
+
+  // The POSIX offsets are positive west of UTC.
+  if (! atc_tzif_parse_abbrev(&p, end, footer->std_abbrev)
+      || ! atc_tzif_parse_hms(&p, end, 24, &offset)) {
+    return kAtcErrGeneric;
+  }
+  footer->std_offset_seconds = -offset;
+  if (p == end) return kAtcErrOk;
+
+  if (! atc_tzif_parse_abbrev(&p, end, footer->dst_abbrev)) {
+    return kAtcErrGeneric;
+  }
+  footer->dst_offset_seconds = 3600;
+  if (p < end && *p != ',') {
+    if (! atc_tzif_parse_hms(&p, end, 24, &offset)) return kAtcErrGeneric;
+    footer->dst_offset_seconds = -offset - footer->std_offset_seconds;
+  }
+  if (! atc_tzif_parse_rule(&p, end, &footer->start)
+      || ! atc_tzif_parse_rule(&p, end, &footer->end)
+      || p != end) {
+    return kAtcErrGeneric;
+  }
+  footer->has_dst = true;
+  return kAtcErrOk;
+}
+
+//---------------------------------------------------------------------------
+// Validation.
+//---------------------------------------------------------------------------
+
+/** The counts of the header of a data block. */
+typedef struct AtcTzifCounts {
+  uint32_t isutcnt;
+  uint32_t isstdcnt;
+  uint32_t leapcnt;
+  uint32_t timecnt;
+  uint32_t typecnt;
+  uint32_t charcnt;
+} AtcTzifCounts;
+
+/**
+ * Read the header at `offset` and return the size of its data block, with
+ * `time_size` bytes per transition time and `time_size + 4` bytes per leap
+ * second record. Returns 0 if the header is invalid or the data block does not
+ * fit in the file.
+ */
+static uint64_t atc_tzif_read_header(
+    const uint8_t *data,
+    size_t size,
+    uint64_t offset,
+    uint8_t time_size,
+    AtcTzifCounts *counts)
+{
+  if (offset + kAtcTzifHeaderSize > size) return 0;
+  const uint8_t *h = data + offset;
+  if (memcmp(h, "TZif", 4) != 0) return 0;
+  counts->isutcnt = atc_tzif_read32(h + 20);
+  counts->isstdcnt = atc_tzif_read32(h + 24);
+  counts->leapcnt = atc_tzif_read32(h + 28);
+  counts->timecnt = atc_tzif_read32(h + 32);
+  counts->typecnt = atc_tzif_read32(h + 36);
+  counts->charcnt = atc_tzif_read32(h + 40);
+  if (counts->typecnt == 0 || counts->typecnt > 256
+      || counts->charcnt == 0
+      || (counts->isutcnt != 0 && counts->isutcnt != counts->typecnt)
+      || (counts->isstdcnt != 0 && counts->isstdcnt != counts->typecnt)) {
+    return 0;
+  }
+
+  // The counts are 32-bit, so the sum cannot overflow 64 bits.
+  uint64_t block_size = (uint64_t) counts->timecnt * (time_size + 1)
+      + (uint64_t) counts->typecnt * kAtcTzifTypeSize
+      + counts->charcnt
+      + (uint64_t) counts->leapcnt * (time_size + 4)
+      + counts->isstdcnt
+      + counts->isutcnt;
+  if (offset + kAtcTzifHeaderSize + block_size > size) return 0;
+  return kAtcTzifHeaderSize + block_size;
+}
+
+/** Return true if the local time types and the abbreviations are valid. */
+static bool atc_tzif_validate_types(const AtcTzif *tzif)
+{
+  if (tzif->abbrevs[tzif->abbrevs_size - 1] != '\0') return false;
+  for (uint16_t i = 0; i < tzif->num_types; i++) {
+    const uint8_t *type = tzif->types + i * kAtcTzifTypeSize;
+    int32_t utoff = (int32_t) atc_tzif_read32(type);
+    if (utoff < -kAtcTzifMaxOffsetSeconds
+        || utoff > kAtcTzifMaxOffsetSeconds
+        || type[4] > 1
+        || type[5] >= tzif->abbrevs_size) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Return true if the transitions are sorted and use valid types. */
+static bool atc_tzif_validate_transitions(const AtcTzif *tzif)
+{
+  for (uint32_t i = 0; i < tzif->num_transitions; i++) {
+    if (tzif->transition_types[i] >= tzif->num_types) return false;
+    if (i > 0
+        && atc_tzif_read64(tzif->transition_times + 8 * (i - 1))
+            >= atc_tzif_read64(tzif->transition_times + 8 * i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int8_t atc_tzif_init(AtcTzif *tzif, const void *data, size_t size)
+{
+  memset(tzif, 0, sizeof(*tzif));
+  const uint8_t *d = (const uint8_t *) data;
+
+  // Skip the version 1 data block.
+  AtcTzifCounts counts;
+  uint64_t v1_size = atc_tzif_read_header(d, size, 0, 4, &counts);
+  if (v1_size == 0 || d[4] < '2') return kAtcErrGeneric;
+  uint64_t v2_size = atc_tzif_read_header(d, size, v1_size, 8, &counts);
+  if (v2_size == 0 || counts.leapcnt != 0) return kAtcErrGeneric;
+
+  const uint8_t *p = d + v1_size + kAtcTzifHeaderSize;
+  tzif->data = d;
+  tzif->size = size;
+  tzif->version = (uint8_t) (d[4] - '0');
+  tzif->num_transitions = counts.timecnt;
+  tzif->num_types = (uint16_t) counts.typecnt;
+  tzif->transition_times = p;
+  p += (size_t) counts.timecnt * 8;
+  tzif->transition_types = p;
+  p += counts.timecnt;
+  tzif->types = p;
+  p += (size_t) counts.typecnt * kAtcTzifTypeSize;
+  tzif->abbrevs = (const char *) p;
+  tzif->abbrevs_size = counts.charcnt;
+
+  // The footer is "\n<TZ string>\n".
+  const char *footer = (const char *) d + v1_size + v2_size;
+  const char *end = (const char *) d + size;
+  const char *newline = NULL;
+  if (footer < end && *footer == '\n') {
+    newline = memchr(footer + 1, '\n', (size_t) (end - footer - 1));
+  }
+  bool is_valid = newline != NULL
+      && atc_tzif_validate_types(tzif)
+      && atc_tzif_validate_transitions(tzif);
+  if (is_valid && newline > footer + 1) {
+    tzif->has_footer = true;
+    is_valid = ! atc_tzif_parse_footer(
+        &tzif->footer, footer + 1, (size_t) (newline - footer - 1));
+  }
+  if (! is_valid) {
+    memset(tzif, 0, sizeof(*tzif));
+    return kAtcErrGeneric;
+  }
+  return kAtcErrOk;
+}
+
+//---------------------------------------------------------------------------
+// Lookups. The transitions of the file and of the footer are converted into
+// intervals of Unix seconds with constant offsets and abbreviation.
+//---------------------------------------------------------------------------
+
+/** An interval [start, until) of Unix seconds using a single time type. */
+typedef struct AtcTzifInterval {
+  int64_t start;
+  int64_t until;
+  int32_t std_offset_seconds;
+  int32_t dst_offset_seconds;
+  const char *abbrev;
+} AtcTzifInterval;
+
+static int64_t atc_tzif_transition_time(const AtcTzif *tzif, uint32_t i)
+{
+  return atc_tzif_read64(tzif->transition_times + 8 * i);
+}
+
+static const uint8_t *atc_tzif_type(const AtcTzif *tzif, uint8_t index)
+{
+  return tzif->types + index * kAtcTzifTypeSize;
+}
+
+/**
+ * Return the UTC offset of the closest standard time type before transition
+ * `i` (-1 for the time before the first transition), or after it if there is
+ * none, or if it is the same as `utoff` (e.g. when the STD offset changes at
+ * the start of DST). Falls back to the STD offset of the footer, then to
+ * `utoff`.
+ */
+static int32_t atc_tzif_std_offset_near(
+    const AtcTzif *tzif,
+    int64_t i,
+    int32_t utoff)
+{
+  int32_t std_offset = utoff;
+  for (int64_t j = i - 1; j >= 0; j--) {
+    const uint8_t *type = atc_tzif_type(tzif, tzif->transition_types[j]);
+    if (! type[4]) {
+      std_offset = (int32_t) atc_tzif_read32(type);
+      break;
+    }
+  }
+  if (std_offset != utoff) return std_offset;
+
+  for (int64_t j = i + 1; j < (int64_t) tzif->num_transitions; j++) {
+    const uint8_t *type = atc_tzif_type(tzif, tzif->transition_types[j]);
+    if (! type[4]) {
+      int32_t next_offset = (int32_t) atc_tzif_read32(type);
+      if (next_offset != utoff) return next_offset;
+      break;
+    }
+  }
+  if (tzif->has_footer && tzif->footer.std_offset_seconds != utoff) {
+    return tzif->footer.std_offset_seconds;
+  }
+  return std_offset;
+}
+
+/**
+ * Fill the offsets and the abbreviation of the interval from the type in
+ * effect after transition `i`, or before the first transition if `i` is -1.
+ */
+static void atc_tzif_set_type(
+    const AtcTzif *tzif,
+    int64_t i,
+    AtcTzifInterval *interval)
+{
+  uint8_t index = (i < 0) ? 0 : tzif->transition_types[i];
+  const uint8_t *type = atc_tzif_type(tzif, index);
+  int32_t utoff = (int32_t) atc_tzif_read32(type);
+  int32_t std_offset = type[4]
+      ? atc_tzif_std_offset_near(tzif, i, utoff)
+      : utoff;
+  interval->std_offset_seconds = std_offset;
+  interval->dst_offset_seconds = utoff - std_offset;
+  interval->abbrev = tzif->abbrevs + type[5];
+}
+
+/** Return the Unix days of the date of the rule in the given year. */
+static int32_t atc_tzif_rule_days(const AtcTzifRule *rule, int16_t year)
+{
+  int32_t jan1 = atc_plain_date_to_unix_days(year, 1, 1);
+  if (rule->kind == kAtcTzifRuleJulian) {
+    bool skip = atc_is_leap_year(year) && rule->day >= 60;
+    return jan1 + rule->day - 1 + skip;
+  } else if (rule->kind == kAtcTzifRuleDay) {
+    return jan1 + rule->day;
+  }
+
+  // 1970-01-01 was a Thursday (4).
+  int32_t first = atc_plain_date_to_unix_days(year, rule->month, 1);
+  int32_t weekday = ((first % 7) + 7 + 4) % 7;
+  int32_t day = 1 + (rule->weekday - weekday + 7) % 7 + 7 * (rule->week - 1);
+  uint8_t days_in_month = atc_plain_date_days_in_year_month(year, rule->month);
+  while (day > days_in_month) day -= 7;
+  return first + day - 1;
+}
+
+/** A DST transition of the footer. */
+typedef struct AtcTzifEvent {
+  int64_t unix_seconds;
+  bool is_dst;
+} AtcTzifEvent;
+
+/**
+ * Find the interval of the footer which contains unix_seconds. Returns false
+ * if unix_seconds is outside of the years supported by the library.
+ */
+static bool atc_tzif_find_footer_interval(
+    const AtcTzifFooter *footer,
+    int64_t unix_seconds,
+    AtcTzifInterval *interval)
+{
+  interval->std_offset_seconds = footer->std_offset_seconds;
+  interval->dst_offset_seconds = 0;
+  interval->abbrev = footer->std_abbrev;
+  if (! footer->has_dst) {
+    interval->start = INT64_MIN;
+    interval->until = INT64_MAX;
+    return true;
+  }
+
+  // Keep the years of the events within [1, 9999].
+  int64_t min_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(kAtcMinYear + 2, 1, 1);
+  int64_t max_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(kAtcMaxYear - 3, 1, 1);
+  if (unix_seconds < min_seconds || unix_seconds >= max_seconds) return false;
+  int32_t days = (int32_t) ((unix_seconds >= 0)
+      ? unix_seconds / 86400
+      : (unix_seconds - 86399) / 86400);
+  int16_t year;
+  uint8_t month;
+  uint8_t day;
+  atc_plain_date_from_unix_days(days, &year, &month, &day);
+
+  // The events of the previous, current and next 2 years, sorted by time, with
+  // the end of DST before the start of DST at the same instant. The rule times
+  // are within 167 hours of the date, so unix_seconds is after the first event
+  // and before the last one.
+  AtcTzifEvent events[8];
+  int32_t dst_total =
+      footer->std_offset_seconds + footer->dst_offset_seconds;
+  for (uint8_t i = 0; i < 4; i++) {
+    int16_t y = year - 1 + i;
+    events[2 * i].unix_seconds =
+        (int64_t) 86400 * atc_tzif_rule_days(&footer->start, y)
+        + footer->start.time_seconds - footer->std_offset_seconds;
+    events[2 * i].is_dst = true;
+    events[2 * i + 1].unix_seconds =
+        (int64_t) 86400 * atc_tzif_rule_days(&footer->end, y)
+        + footer->end.time_seconds - dst_total;
+    events[2 * i + 1].is_dst = false;
+  }
+  for (uint8_t i = 1; i < 8; i++) {
+    AtcTzifEvent e = events[i];
+    uint8_t j = i;
+    for (; j > 0 && (events[j - 1].unix_seconds > e.unix_seconds
+        || (events[j - 1].unix_seconds == e.unix_seconds
+            && events[j - 1].is_dst && ! e.is_dst)); j--) {
+      events[j] = events[j - 1];
+    }
+    events[j] = e;
+  }
+
+  uint8_t k = 0;
+  while (k < 6 && events[k + 1].unix_seconds <= unix_seconds) k++;
+  interval->start = events[k].unix_seconds;
+  interval->until = events[k + 1].unix_seconds;
+  if (events[k].is_dst) {
+    interval->dst_offset_seconds = footer->dst_offset_seconds;
+    interval->abbrev = footer->dst_abbrev;
+  }
+  return true;
+}
+
+/**
+ * Find the interval which contains unix_seconds, using a binary search over
+ * the transitions of the file. Returns false if unix_seconds is after the last
+ * transition and outside of the years supported by the footer.
+ */
+static bool atc_tzif_find_interval(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcTzifInterval *interval)
+{
+  uint32_t n = tzif->num_transitions;
+  if (n == 0 || unix_seconds < atc_tzif_transition_time(tzif, 0)) {
+    // Without transitions, the footer (if any) applies to all instants.
+    if (n == 0 && tzif->has_footer) {
+      return atc_tzif_find_footer_interval(
+          &tzif->footer, unix_seconds, interval);
+    }
+    atc_tzif_set_type(tzif, -1, interval);
+    interval->start = INT64_MIN;
+    interval->until = (n == 0) ? INT64_MAX : atc_tzif_transition_time(tzif, 0);
+    return true;
+  }
+
+  int64_t last = atc_tzif_transition_time(tzif, n - 1);
+  if (unix_seconds >= last && tzif->has_footer) {
+    if (! atc_tzif_find_footer_interval(&tzif->footer, unix_seconds, interval)) {
+      return false;
+    }
+    if (interval->start < last) interval->start = last;
+    return true;
+  }
+
+  // Find the last transition whose start is <= unix_seconds.
+  uint32_t lo = 0;
+  uint32_t hi = n;
+  while (hi - lo > 1) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (atc_tzif_transition_time(tzif, mid) <= unix_seconds) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  atc_tzif_set_type(tzif, lo, interval);
+  interval->start = atc_tzif_transition_time(tzif, lo);
+  interval->until = (lo + 1 < n)
+      ? atc_tzif_transition_time(tzif, lo + 1)
+      : INT64_MAX;
+  return true;
+}
+
+static int32_t atc_tzif_interval_offset(const AtcTzifInterval *interval)
+{
+  return interval->std_offset_seconds + interval->dst_offset_seconds;
+}
+
+static bool atc_tzif_is_same_state(
+    const AtcTzifInterval *a,
+    const AtcTzifInterval *b)
+{
+  return a->std_offset_seconds == b->std_offset_seconds
+      && a->dst_offset_seconds == b->dst_offset_seconds
+      && strcmp(a->abbrev, b->abbrev) == 0;
+}
+
+/** Fill the offsets of the result from the target and requested intervals. */
+static void atc_tzif_set_result(
+    const AtcTzifInterval *target,
+    const AtcTzifInterval *req,
+    AtcFindResult *result)
+{
+  result->std_offset_seconds = target->std_offset_seconds;
+  result->dst_offset_seconds = target->dst_offset_seconds;
+  result->req_std_offset_seconds = req->std_offset_seconds;
+  result->req_dst_offset_seconds = req->dst_offset_seconds;
+  result->abbrev = target->abbrev;
+  result->valid_from_unix_seconds = target->start;
+  result->valid_until_unix_seconds = target->until;
+}
+
+void atc_tzif_find_by_unix_seconds(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+  AtcTzifInterval curr;
+  if (unix_seconds == kAtcInvalidUnixSeconds
+      || ! atc_tzif_find_interval(tzif, unix_seconds, &curr)) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  // Detect overlaps using the same rules as
+  // atc_transition_table_find_by_unix_seconds().
+  AtcTzifInterval other;
+  int32_t curr_total = atc_tzif_interval_offset(&curr);
+  result->type = kAtcFindResultExact;
+  result->fold = 0;
+  if (curr.start != INT64_MIN
+      && atc_tzif_find_interval(tzif, curr.start - 1, &other)) {
+    int32_t shift = curr_total - atc_tzif_interval_offset(&other);
+    if (shift < 0 && unix_seconds - curr.start < -shift) {
+      result->type = kAtcFindResultOverlap;
+      result->fold = 1;
+    }
+  }
+  if (result->type == kAtcFindResultExact
+      && curr.until != INT64_MAX
+      && atc_tzif_find_interval(tzif, curr.until, &other)) {
+    int32_t shift = atc_tzif_interval_offset(&other) - curr_total;
+    if (shift < 0 && curr.until - unix_seconds <= -shift) {
+      result->type = kAtcFindResultOverlap;
+    }
+  }
+  atc_tzif_set_result(&curr, &curr, result);
+}
+
+// Same rules as atc_steady_state_find_by_plain_date_time().
+void atc_tzif_find_by_plain_date_time(
+    const AtcTzif *tzif,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result)
+{
+  int64_t local_seconds = atc_plain_date_time_to_unix_seconds(pdt);
+  if (local_seconds == kAtcInvalidUnixSeconds) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  // The intervals which contain `local_seconds - offset` for some valid UTC
+  // offset, in the order of their local start and until times: `before` ends
+  // before pdt, `first` and `last` contain pdt, and `after` starts after pdt.
+  AtcTzifInterval before;
+  AtcTzifInterval first;
+  AtcTzifInterval last;
+  AtcTzifInterval after;
+  bool has_before = false;
+  bool has_after = false;
+  uint8_t num = 0;
+  AtcTzifInterval interval;
+  int64_t unix_seconds = local_seconds - kAtcTzifMaxOffsetSeconds;
+  while (atc_tzif_find_interval(tzif, unix_seconds, &interval)) {
+    int32_t total = atc_tzif_interval_offset(&interval);
+    bool starts_before = interval.start == INT64_MIN
+        || interval.start + total <= local_seconds;
+    bool ends_after = interval.until == INT64_MAX
+        || local_seconds < interval.until + total;
+    if (starts_before && ends_after) {
+      if (num == 0) first = interval;
+      last = interval;
+      num++;
+    } else if (num == 0 && ! ends_after) {
+      before = interval;
+      has_before = true;
+      has_after = false;
+    } else if (num == 0 && has_before && ! has_after) {
+      after = interval;
+      has_after = true;
+    }
+    if (interval.until == INT64_MAX
+        || interval.until > local_seconds + kAtcTzifMaxOffsetSeconds) {
+      break;
+    }
+    unix_seconds = interval.until;
+  }
+
+  if (num == 1) {
+    result->type = kAtcFindResultExact;
+    result->fold = 0;
+    atc_tzif_set_result(&first, &first, result);
+  } else if (num >= 2) {
+    result->type = kAtcFindResultOverlap;
+    if ((disambiguate == kAtcDisambiguateCompatible)
+        || (disambiguate == kAtcDisambiguateEarlier)) {
+      result->fold = 0;
+      atc_tzif_set_result(&first, &first, result);
+    } else {
+      result->fold = 1;
+      atc_tzif_set_result(&last, &last, result);
+    }
+  } else if (has_before && has_after) {
+    result->type = kAtcFindResultGap;
+    if ((disambiguate == kAtcDisambiguateCompatible)
+        || disambiguate == kAtcDisambiguateLater) {
+      result->fold = 0;
+      atc_tzif_set_result(&after, &before, result);
+    } else {
+      result->fold = 1;
+      atc_tzif_set_result(&before, &after, result);
+    }
+  } else {
+    result->type = kAtcFindResultNotFound;
+  }
+}
+
+static void atc_tzif_set_transition(
+    const AtcTzifInterval *prev,
+    const AtcTzifInterval *curr,
+    AtcZoneTransition *transition)
+{
+  transition->start_unix_seconds = curr->start;
+  transition->std_offset_seconds = curr->std_offset_seconds;
+  transition->dst_offset_seconds = curr->dst_offset_seconds;
+  transition->prev_std_offset_seconds = prev->std_offset_seconds;
+  transition->prev_dst_offset_seconds = prev->dst_offset_seconds;
+  strncpy(transition->abbrev, curr->abbrev, kAtcAbbrevSize - 1);
+  transition->abbrev[kAtcAbbrevSize - 1] = '\0';
+}
+
+bool atc_tzif_next_transition(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  AtcTzifInterval curr;
+  AtcTzifInterval next;
+  if (unix_seconds == kAtcInvalidUnixSeconds
+      || ! atc_tzif_find_interval(tzif, unix_seconds, &curr)) {
+    return false;
+  }
+  while (curr.until != INT64_MAX) {
+    if (! atc_tzif_find_interval(tzif, curr.until, &next)) return false;
+    if (! atc_tzif_is_same_state(&curr, &next)) {
+      atc_tzif_set_transition(&curr, &next, transition);
+      return true;
+    }
+    curr.until = next.until;
+  }
+  return false;
+}
+
+bool atc_tzif_prev_transition(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition)
+{
+  AtcTzifInterval curr;
+  AtcTzifInterval prev;
+  if (unix_seconds == kAtcInvalidUnixSeconds
+      || ! atc_tzif_find_interval(tzif, unix_seconds, &curr)) {
+    return false;
+  }
+  while (curr.start != INT64_MIN) {
+    if (! atc_tzif_find_interval(tzif, curr.start - 1, &prev)) return false;
+    if (! atc_tzif_is_same_state(&prev, &curr)) {
+      atc_tzif_set_transition(&prev, &curr, transition);
+      return true;
+    }
+    curr.start = prev.start;
+  }
+  return false;
+}
+
+//---------------------------------------------------------------------------
+// Files.
+//---------------------------------------------------------------------------
+
+#if ACE_TIME_C_HAS_MMAP
+
+int8_t atc_tzif_open_file(AtcTzif *tzif, const char *path)
+{
+  memset(tzif, 0, sizeof(*tzif));
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return kAtcErrGeneric;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return kAtcErrGeneric;
+  }
+  size_t size = (size_t) st.st_size;
+  void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) return kAtcErrGeneric;
+
+  if (atc_tzif_init(tzif, data, size)) {
+    munmap(data, size);
+    return kAtcErrGeneric;
+  }
+  tzif->is_mapped = true;
+  return kAtcErrOk;
+}
+
+int8_t atc_tzif_open_zone(AtcTzif *tzif, const char *name)
+{
+  memset(tzif, 0, sizeof(*tzif));
+  size_t len = strlen(name);
+  if (len == 0 || len >= kAtcTzifNameSize || name[0] == '/'
+      || strstr(name, "..") != NULL) {
+    return kAtcErrGeneric;
+  }
+
+  char path[sizeof(ACE_TIME_C_TZIF_DIR) + kAtcTzifNameSize];
+  memcpy(path, ACE_TIME_C_TZIF_DIR, sizeof(ACE_TIME_C_TZIF_DIR) - 1);
+  path[sizeof(ACE_TIME_C_TZIF_DIR) - 1] = '/';
+  memcpy(path + sizeof(ACE_TIME_C_TZIF_DIR), name, len + 1);
+  if (atc_tzif_open_file(tzif, path)) return kAtcErrGeneric;
+  memcpy(tzif->name, name, len + 1);
+  return kAtcErrOk;
+}
+
+void atc_tzif_close_file(AtcTzif *tzif)
+{
+  if (tzif->is_mapped) {
+    munmap((void *) tzif->data, tzif->size);
+  }
+  memset(tzif, 0, sizeof(*tzif));
+}
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file tzif.h
+ *
+ * A reader of the TZif files (RFC 8536) compiled by zic, for example the
+ * files under /usr/share/zoneinfo, so that a host can use the TZ data
+ * maintained by the operating system instead of a compiled zonedb. Only the
+ * version 2 and later data block is used, with 64-bit transition times.
+ *
+ * The file is validated once by atc_tzif_init(), then used in place: a lookup
+ * is a binary search over the big-endian transition times of the file, and the
+ * abbreviations point into the file. The instants after the last transition
+ * use the POSIX TZ string of the footer, which is parsed into an AtcTzifFooter
+ * by atc_tzif_init().
+ *
+ * A TZif file does not store the STD and DST offsets separately, only the
+ * total UTC offset and an `isdst` flag. The DST offset of a local time type
+ * with `isdst` is calculated relative to the closest preceding transition into
+ * standard time, or the following one if there is none, or if the preceding
+ * one has the same UTC offset.
+ *
+ * An AtcTimeZone created by atc_time_zone_for_tzif() uses the AtcTzif for all
+ * the `atc_time_zone_xxx()` conversion functions.
+ */
+
+#ifndef ACE_TIME_C_TZIF_H
+#define ACE_TIME_C_TZIF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h" // kAtcErrOk, kAtcErrGeneric, ACE_TIME_C_HAS_MMAP
+#include "plain_date_time.h" // AtcPlainDateTime
+#include "transition.h" // kAtcAbbrevSize
+#include "zone_processor.h" // AtcFindResult
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Forward declaration for AtcZoneTransition. */
+typedef struct AtcZoneTransition AtcZoneTransition;
+
+/** Directory of atc_tzif_open_zone(). */
+#ifndef ACE_TIME_C_TZIF_DIR
+#define ACE_TIME_C_TZIF_DIR "/usr/share/zoneinfo"
+#endif
+
+enum {
+  /** Size of AtcTzif.name, including the NUL terminator. */
+  kAtcTzifNameSize = 48,
+
+  /**
+   * Maximum absolute UTC offset of a local time type. RFC 8536 recommends
+   * [-89999, 93599].
+   */
+  kAtcTzifMaxOffsetSeconds = 26 * 3600,
+};
+
+/** Values of AtcTzifRule.kind. */
+enum {
+  /** "Jn": day [1,365] of the year, never counting February 29. */
+  kAtcTzifRuleJulian = 0,
+
+  /** "n": day [0,365] of the year, counting February 29. */
+  kAtcTzifRuleDay = 1,
+
+  /** "Mm.w.d": weekday d of week w [1,5] of month m, 5 is the last week. */
+  kAtcTzifRuleMonth = 2,
+};
+
+/** The date and time of a DST transition in a POSIX TZ string. */
+typedef struct AtcTzifRule {
+  /** kAtcTzifRuleXxx */
+  uint8_t kind;
+  /** Month [1,12] of kAtcTzifRuleMonth. */
+  uint8_t month;
+  /** Week [1,5] of kAtcTzifRuleMonth. */
+  uint8_t week;
+  /** Day of week [0,6] of kAtcTzifRuleMonth, Sunday is 0. */
+  uint8_t weekday;
+  /** Day of kAtcTzifRuleJulian or kAtcTzifRuleDay. */
+  uint16_t day;
+  /** Local time of the transition, [-167,167] hours. Defaults to 02:00. */
+  int32_t time_seconds;
+} AtcTzifRule;
+
+/**
+ * A parsed POSIX TZ string, e.g. "PST8PDT,M3.2.0,M11.1.0". The offsets use the
+ * sign convention of acetimec (east of UTC is positive), which is the opposite
+ * of the POSIX TZ string.
+ */
+typedef struct AtcTzifFooter {
+  /** The STD offset. */
+  int32_t std_offset_seconds;
+  /** The DST offset during DST, usually 3600. */
+  int32_t dst_offset_seconds;
+  /** True if the string has a DST part, with its start and end rules. */
+  bool has_dst;
+  /** Start of DST, in local standard time. */
+  AtcTzifRule start;
+  /** End of DST, in local daylight time. */
+  AtcTzifRule end;
+  char std_abbrev[kAtcAbbrevSize];
+  char dst_abbrev[kAtcAbbrevSize];
+} AtcTzifFooter;
+
+/** A validated TZif file in memory. */
+typedef struct AtcTzif {
+  /** The content of the file. */
+  const uint8_t *data;
+
+  /** Size of the data. */
+  size_t size;
+
+  /** Version of the file: 2, 3 or 4. */
+  uint8_t version;
+
+  /** Number of local time types. */
+  uint16_t num_types;
+
+  /** Number of transitions. */
+  uint32_t num_transitions;
+
+  /** The 64-bit big-endian transition times, in ascending order. */
+  const uint8_t *transition_times;
+
+  /** The index of the local time type of each transition. */
+  const uint8_t *transition_types;
+
+  /** The 6-byte local time type records {utoff, isdst, desigidx}. */
+  const uint8_t *types;
+
+  /** The NUL-terminated abbreviations of the local time types. */
+  const char *abbrevs;
+
+  /** Size of the abbrevs. */
+  uint32_t abbrevs_size;
+
+  /** True if the file has a non-empty footer. */
+  bool has_footer;
+
+  /** Rule of the instants after the last transition, if has_footer. */
+  AtcTzifFooter footer;
+
+  /** Name of the zone, set by atc_tzif_open_zone(), or empty. */
+  char name[kAtcTzifNameSize];
+
+  /** True if the data was mapped by atc_tzif_open_file(). */
+  bool is_mapped;
+} AtcTzif;
+
+/**
+ * Parse the POSIX TZ string of `size` bytes (without a NUL terminator) into
+ * the footer, including the extensions of RFC 8536 (quoted abbreviations, and
+ * transition times from -167 to 167 hours). Returns kAtcErrGeneric if the
+ * string is invalid, or if it has a DST part without the start and end rules.
+ */
+int8_t atc_tzif_parse_footer(
+    AtcTzifFooter *footer,
+    const char *s,
+    size_t size);
+
+/**
+ * Initialize the AtcTzif with the content of a TZif file, which must remain
+ * valid while the AtcTzif is used. Validates the header, the bounds of the
+ * data block, the order of the transitions, the local time types and the
+ * footer. Returns kAtcErrGeneric if the data is not a valid TZif file of
+ * version 2 or later, or if it contains leap seconds.
+ */
+int8_t atc_tzif_init(AtcTzif *tzif, const void *data, size_t size);
+
+/**
+ * Find the AtcFindResult at the given unix_seconds using a binary search over
+ * the transitions, or the footer after the last transition, with the same
+ * semantics as atc_processor_find_by_unix_seconds(). The `result.abbrev`
+ * points into the AtcTzif.
+ */
+void atc_tzif_find_by_unix_seconds(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcFindResult *result);
+
+/**
+ * Find the AtcFindResult of the local date time, resolving a gap or an overlap
+ * using `disambiguate`, with the same semantics as
+ * atc_processor_find_by_plain_date_time().
+ */
+void atc_tzif_find_by_plain_date_time(
+    const AtcTzif *tzif,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result);
+
+/**
+ * Find the first transition which starts strictly after unix_seconds, and
+ * which changes the UTC offsets or the abbreviation. Returns false if there is
+ * none.
+ */
+bool atc_tzif_next_transition(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition);
+
+/**
+ * Find the last transition which starts at or before unix_seconds, and which
+ * changes the UTC offsets or the abbreviation. Returns false if there is none.
+ */
+bool atc_tzif_prev_transition(
+    const AtcTzif *tzif,
+    int64_t unix_seconds,
+    AtcZoneTransition *transition);
+
+#if ACE_TIME_C_HAS_MMAP
+
+/**
+ * Map the TZif file at `path` read-only into memory and validate it with
+ * atc_tzif_init(). Returns kAtcErrGeneric on failure, with nothing left to
+ * release.
+ */
+int8_t atc_tzif_open_file(AtcTzif *tzif, const char *path);
+
+/**
+ * Open the TZif file of the zone `name` (e.g. "America/Los_Angeles") in
+ * ACE_TIME_C_TZIF_DIR, and set `tzif->name`. Returns kAtcErrGeneric if the
+ * name is too long, or not a relative path without "..".
+ */
+int8_t atc_tzif_open_zone(AtcTzif *tzif, const char *name);
+
+/** Release the mapping of atc_tzif_open_file() or atc_tzif_open_zone(). */
+void atc_tzif_close_file(AtcTzif *tzif);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
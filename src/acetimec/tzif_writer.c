@@ -0,0 +1,535 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include <string.h> // strlen(), strcmp(), strncpy()
+#include "../zoneinfo/zone_info_utils.h"
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "string_buffer.h"
+#include "transition_iterator.h"
+#include "tzif.h" // AtcTzifRule, atc_tzif_parse_footer()
+#include "tzif_writer.h"
+
+enum {
+  /** Size of the buffer of AtcTzifWriter. */
+  kAtcTzifWriterBufferSize = 128,
+
+  /** Maximum absolute transition time of a POSIX TZ string rule. */
+  kAtcTzifMaxRuleSeconds = 167 * 3600,
+};
+
+//---------------------------------------------------------------------------
+// The POSIX TZ string of the footer.
+//---------------------------------------------------------------------------
+
+static bool atc_tzif_is_alpha(char c)
+{
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+/**
+ * Print the abbreviation, quoted with <...> if it contains digits or signs.
+ * Returns false if it cannot be used in a POSIX TZ string.
+ */
+static bool atc_tzif_print_abbrev(AtcStringBuffer *sb, const char *abbrev)
+{
+  size_t len = strlen(abbrev);
+  if (len < 3) return false;
+  bool quoted = false;
+  for (size_t i = 0; i < len; i++) {
+    char c = abbrev[i];
+    if (atc_tzif_is_alpha(c)) continue;
+    if ((c >= '0' && c <= '9') || c == '+' || c == '-') {
+      quoted = true;
+    } else {
+      return false;
+    }
+  }
+  if (quoted) atc_print_char(sb, '<');
+  atc_print_string(sb, abbrev);
+  if (quoted) atc_print_char(sb, '>');
+  return true;
+}
+
+/** Print the seconds as [-]h[:mm[:ss]]. */
+static void atc_tzif_print_hms(AtcStringBuffer *sb, int32_t seconds)
+{
+  if (seconds < 0) {
+    atc_print_char(sb, '-');
+    seconds = -seconds;
+  }
+  uint16_t hh, mm, ss;
+  atc_seconds_to_hms((uint32_t) seconds, &hh, &mm, &ss);
+  atc_print_uint16(sb, hh);
+  if (mm != 0 || ss != 0) {
+    atc_print_char(sb, ':');
+    atc_print_uint16_pad2(sb, mm);
+  }
+  if (ss != 0) {
+    atc_print_char(sb, ':');
+    atc_print_uint16_pad2(sb, ss);
+  }
+}
+
+/**
+ * Convert the recurring rule into the date and time of a POSIX TZ string. The
+ * time is the wall time before the transition, using the DST offset of the
+ * prev rule. Returns false if the rule cannot be represented.
+ */
+static bool atc_tzif_create_rule(
+    AtcTzifRule *r,
+    const AtcZoneRule *rule,
+    int32_t std_offset_seconds,
+    int32_t prev_dst_offset_seconds)
+{
+  int32_t time = atc_zone_rule_at_seconds(rule);
+  uint8_t suffix = atc_zone_rule_at_suffix(rule);
+  if (suffix == kAtcSuffixU) {
+    time += std_offset_seconds + prev_dst_offset_seconds;
+  } else if (suffix == kAtcSuffixS) {
+    time += prev_dst_offset_seconds;
+  }
+
+  int8_t on_day_of_month = rule->on_day_of_month;
+  if (rule->on_day_of_week == 0) {
+    // A fixed day, counted without February 29.
+    if (rule->in_month == 2 && on_day_of_month == 29) return false;
+    r->kind = kAtcTzifRuleJulian;
+    r->day = on_day_of_month;
+    for (uint8_t month = 1; month < rule->in_month; month++) {
+      r->day += atc_plain_date_days_in_year_month(2001, month);
+    }
+  } else {
+    r->kind = kAtcTzifRuleMonth;
+    r->month = rule->in_month;
+    r->weekday = rule->on_day_of_week % 7;
+    if (on_day_of_month < 0) {
+      // "Sun<=25" is the same as "Sun>=19".
+      on_day_of_month = -on_day_of_month - 6;
+      if (on_day_of_month < 1) return false;
+    }
+    if (on_day_of_month == 0) {
+      r->week = 5;
+    } else {
+      // The week of "Sun>=9" starts on the 8th, so it is the Sunday after the
+      // second Saturday, which adds 24 hours to the time of the transition.
+      if (on_day_of_month > 28) return false;
+      uint8_t shift = (uint8_t) ((on_day_of_month - 1) % 7);
+      r->week = (uint8_t) ((on_day_of_month - 1) / 7 + 1);
+      r->weekday = (uint8_t) ((r->weekday + 7 - shift) % 7);
+      time += (int32_t) shift * 86400;
+    }
+  }
+
+  if (time < -kAtcTzifMaxRuleSeconds || time > kAtcTzifMaxRuleSeconds) {
+    return false;
+  }
+  r->time_seconds = time;
+  return true;
+}
+
+/** Print the rule as ",Jn[/time]" or ",Mm.w.d[/time]". */
+static void atc_tzif_print_rule(AtcStringBuffer *sb, const AtcTzifRule *r)
+{
+  atc_print_char(sb, ',');
+  if (r->kind == kAtcTzifRuleJulian) {
+    atc_print_char(sb, 'J');
+    atc_print_uint16(sb, r->day);
+  } else {
+    atc_print_char(sb, 'M');
+    atc_print_uint16(sb, r->month);
+    atc_print_char(sb, '.');
+    atc_print_uint16(sb, r->week);
+    atc_print_char(sb, '.');
+    atc_print_uint16(sb, r->weekday);
+  }
+  if (r->time_seconds != 7200) {
+    atc_print_char(sb, '/');
+    atc_tzif_print_hms(sb, r->time_seconds);
+  }
+}
+
+int8_t atc_tzif_create_footer(
+    char *dest,
+    uint8_t dest_size,
+    const AtcZoneInfo *zone_info,
+    int16_t *start_year)
+{
+  if (zone_info == NULL || zone_info->num_eras == 0) return kAtcErrGeneric;
+  const AtcZoneEra *era = &zone_info->eras[zone_info->num_eras - 1];
+  if (era->until_year != kAtcZoneInfoMaxUntilYear) return kAtcErrGeneric;
+
+  int16_t year = kAtcMinYear + 1;
+  if (zone_info->num_eras > 1) {
+    int16_t prev_until_year = zone_info->eras[zone_info->num_eras - 2].until_year;
+    if (prev_until_year + 1 > year) year = prev_until_year + 1;
+  }
+
+  // Find the 2 rules which never end, or the last rule of an expired policy.
+  const char * const *letters = zone_info->zone_context->letters;
+  int32_t std_offset_seconds = atc_zone_era_std_offset_seconds(era);
+  int32_t dst_offset_seconds = atc_zone_era_dst_offset_seconds(era);
+  const char *letter = "";
+  const AtcZoneRule *std_rule = NULL;
+  const AtcZoneRule *dst_rule = NULL;
+  const AtcZonePolicy *policy = era->zone_policy;
+  if (policy != NULL) {
+    uint8_t num_recurring = 0;
+    const AtcZoneRule *recurring[2];
+    const AtcZoneRule *last = NULL;
+    for (uint8_t i = 0; i < policy->num_rules; i++) {
+      const AtcZoneRule *rule = &policy->rules[i];
+      if (rule->to_year == kAtcZoneInfoMaxYear) {
+        if (num_recurring >= 2) return kAtcErrGeneric;
+        recurring[num_recurring++] = rule;
+        if (rule->from_year + 1 > year) year = rule->from_year + 1;
+      } else {
+        if (rule->to_year + 1 > year) year = rule->to_year + 1;
+        if (last == NULL || rule->to_year > last->to_year
+            || (rule->to_year == last->to_year
+                && rule->in_month > last->in_month)) {
+          last = rule;
+        }
+      }
+    }
+
+    if (num_recurring == 2) {
+      int32_t dst0 = atc_zone_rule_dst_offset_seconds(recurring[0]);
+      int32_t dst1 = atc_zone_rule_dst_offset_seconds(recurring[1]);
+      if (dst0 == 0 && dst1 != 0) {
+        std_rule = recurring[0];
+        dst_rule = recurring[1];
+      } else if (dst1 == 0 && dst0 != 0) {
+        std_rule = recurring[1];
+        dst_rule = recurring[0];
+      } else {
+        return kAtcErrGeneric;
+      }
+    } else if (num_recurring == 0) {
+      dst_offset_seconds = (last)
+          ? atc_zone_rule_dst_offset_seconds(last) : 0;
+      letter = (last) ? letters[last->letter_index] : "";
+    } else {
+      return kAtcErrGeneric;
+    }
+  }
+  if (year >= kAtcMaxYear) return kAtcErrGeneric;
+
+  AtcStringBuffer sb;
+  atc_buf_init(&sb, dest, dest_size);
+  char abbrev[kAtcAbbrevSize];
+  if (std_rule == NULL) {
+    atc_processor_create_abbreviation(abbrev, kAtcAbbrevSize, era->format,
+        std_offset_seconds, dst_offset_seconds, letter);
+    if (! atc_tzif_print_abbrev(&sb, abbrev)) return kAtcErrGeneric;
+    atc_tzif_print_hms(&sb, -(std_offset_seconds + dst_offset_seconds));
+  } else {
+    int32_t dst = atc_zone_rule_dst_offset_seconds(dst_rule);
+    atc_processor_create_abbreviation(abbrev, kAtcAbbrevSize, era->format,
+        std_offset_seconds, 0, letters[std_rule->letter_index]);
+    if (! atc_tzif_print_abbrev(&sb, abbrev)) return kAtcErrGeneric;
+    atc_tzif_print_hms(&sb, -std_offset_seconds);
+
+    atc_processor_create_abbreviation(abbrev, kAtcAbbrevSize, era->format,
+        std_offset_seconds, dst, letters[dst_rule->letter_index]);
+    if (! atc_tzif_print_abbrev(&sb, abbrev)) return kAtcErrGeneric;
+    if (dst != 3600) atc_tzif_print_hms(&sb, -(std_offset_seconds + dst));
+
+    AtcTzifRule start;
+    AtcTzifRule end;
+    if (! atc_tzif_create_rule(&start, dst_rule, std_offset_seconds, 0)
+        || ! atc_tzif_create_rule(&end, std_rule, std_offset_seconds, dst)) {
+      return kAtcErrGeneric;
+    }
+    atc_tzif_print_rule(&sb, &start);
+    atc_tzif_print_rule(&sb, &end);
+  }
+
+  // Check for truncation before closing the buffer.
+  if (sb.size >= sb.capacity) return kAtcErrGeneric;
+  atc_buf_close(&sb);
+  *start_year = year;
+  return kAtcErrOk;
+}
+
+//---------------------------------------------------------------------------
+// The TZif file.
+//---------------------------------------------------------------------------
+
+/** A local time type of the file. */
+typedef struct AtcTzifWriterType {
+  int32_t utoff;
+  uint8_t isdst;
+  /** Index of the abbreviation in the abbreviation bytes of the file. */
+  uint8_t desigidx;
+  char abbrev[kAtcAbbrevSize];
+} AtcTzifWriterType;
+
+/** State of atc_tzif_write(). */
+typedef struct AtcTzifWriter {
+  AtcTzifWriteCallback callback;
+  void *context;
+  /** kAtcErrGeneric after the first error, which stops the writer. */
+  int8_t err;
+  uint8_t num_types;
+  uint16_t buffer_size;
+  uint8_t buffer[kAtcTzifWriterBufferSize];
+  AtcTzifWriterType types[kAtcTzifWriterMaxTypes];
+} AtcTzifWriter;
+
+static void atc_tzif_writer_flush(AtcTzifWriter *w)
+{
+  if (w->err == kAtcErrOk && w->buffer_size > 0) {
+    w->err = w->callback(w->context, w->buffer, w->buffer_size);
+  }
+  w->buffer_size = 0;
+}
+
+static void atc_tzif_writer_put(AtcTzifWriter *w, const void *data, size_t size)
+{
+  const uint8_t *p = (const uint8_t *) data;
+  for (size_t i = 0; i < size; i++) {
+    if (w->buffer_size >= kAtcTzifWriterBufferSize) atc_tzif_writer_flush(w);
+    w->buffer[w->buffer_size++] = p[i];
+  }
+}
+
+static void atc_tzif_writer_put32(AtcTzifWriter *w, uint32_t n)
+{
+  uint8_t p[4] = {
+    (uint8_t) (n >> 24), (uint8_t) (n >> 16), (uint8_t) (n >> 8), (uint8_t) n
+  };
+  atc_tzif_writer_put(w, p, sizeof(p));
+}
+
+static void atc_tzif_writer_put64(AtcTzifWriter *w, int64_t n)
+{
+  uint64_t u = (uint64_t) n;
+  atc_tzif_writer_put32(w, (uint32_t) (u >> 32));
+  atc_tzif_writer_put32(w, (uint32_t) u);
+}
+
+/** Write the header of a data block with the given counts. */
+static void atc_tzif_writer_put_header(
+    AtcTzifWriter *w,
+    char version,
+    uint32_t timecnt,
+    uint32_t typecnt,
+    uint32_t charcnt)
+{
+  static const uint8_t zeros[15] = {0};
+  atc_tzif_writer_put(w, "TZif", 4);
+  atc_tzif_writer_put(w, &version, 1);
+  atc_tzif_writer_put(w, zeros, sizeof(zeros));
+  atc_tzif_writer_put32(w, 0); // isutcnt
+  atc_tzif_writer_put32(w, 0); // isstdcnt
+  atc_tzif_writer_put32(w, 0); // leapcnt
+  atc_tzif_writer_put32(w, timecnt);
+  atc_tzif_writer_put32(w, typecnt);
+  atc_tzif_writer_put32(w, charcnt);
+}
+
+static void atc_tzif_writer_put_type(
+    AtcTzifWriter *w,
+    const AtcTzifWriterType *type)
+{
+  atc_tzif_writer_put32(w, (uint32_t) type->utoff);
+  atc_tzif_writer_put(w, &type->isdst, 1);
+  atc_tzif_writer_put(w, &type->desigidx, 1);
+}
+
+/**
+ * Return the index of the local time type, adding it if `add` is true.
+ * Returns -1 if the type is not found, or if there are too many types.
+ */
+static int16_t atc_tzif_writer_find_type(
+    AtcTzifWriter *w,
+    int32_t utoff,
+    uint8_t isdst,
+    const char *abbrev,
+    bool add)
+{
+  for (uint8_t i = 0; i < w->num_types; i++) {
+    const AtcTzifWriterType *type = &w->types[i];
+    if (type->utoff == utoff && type->isdst == isdst
+        && strcmp(type->abbrev, abbrev) == 0) {
+      return i;
+    }
+  }
+  if (! add || w->num_types >= kAtcTzifWriterMaxTypes) return -1;
+
+  AtcTzifWriterType *type = &w->types[w->num_types];
+  type->utoff = utoff;
+  type->isdst = isdst;
+  type->desigidx = 0;
+  strncpy(type->abbrev, abbrev, kAtcAbbrevSize - 1);
+  type->abbrev[kAtcAbbrevSize - 1] = '\0';
+  return w->num_types++;
+}
+
+/**
+ * Find the next transition which changes the local time type from `*type`,
+ * and update `*type`. Returns false at the end of the transitions, or on
+ * error.
+ */
+static bool atc_tzif_writer_next(
+    AtcTzifWriter *w,
+    AtcTransitionIterator *it,
+    bool add,
+    uint8_t *type,
+    int64_t *unix_seconds)
+{
+  AtcZoneTransition t;
+  while (atc_transition_iterator_next(it, &t)) {
+    int16_t index = atc_tzif_writer_find_type(w,
+        t.std_offset_seconds + t.dst_offset_seconds,
+        t.dst_offset_seconds != 0,
+        t.abbrev,
+        add);
+    if (index < 0) {
+      w->err = kAtcErrGeneric;
+      return false;
+    }
+    if (index == *type) continue;
+    *type = (uint8_t) index;
+    *unix_seconds = t.start_unix_seconds;
+    return true;
+  }
+  return false;
+}
+
+/** Set the desigidx of the types, and return the size of the abbreviations. */
+static uint32_t atc_tzif_writer_index_abbrevs(AtcTzifWriter *w)
+{
+  uint32_t num_chars = 0;
+  for (uint8_t i = 0; i < w->num_types; i++) {
+    AtcTzifWriterType *type = &w->types[i];
+    uint8_t j = 0;
+    while (j < i && strcmp(w->types[j].abbrev, type->abbrev) != 0) j++;
+    if (j < i) {
+      type->desigidx = w->types[j].desigidx;
+    } else {
+      type->desigidx = (uint8_t) num_chars;
+      num_chars += strlen(type->abbrev) + 1;
+    }
+  }
+  return num_chars;
+}
+
+int8_t atc_tzif_write(
+    const AtcZoneInfo *zone_info,
+    AtcZoneProcessor *processor,
+    int16_t start_year,
+    int16_t until_year,
+    AtcTzifWriteCallback callback,
+    void *context)
+{
+  if (start_year <= kAtcMinYear || until_year > kAtcMaxYear
+      || start_year >= until_year) {
+    return kAtcErrGeneric;
+  }
+  int64_t start_unix_seconds = (int64_t) 86400
+      * atc_plain_date_to_unix_days(start_year, 1, 1);
+  // The year kAtcMaxYear is not a valid date, so use the day before.
+  int64_t until_unix_seconds = (int64_t) 86400
+      * (atc_plain_date_to_unix_days(until_year - 1, 12, 31) + 1);
+
+  AtcTzifWriter w;
+  w.callback = callback;
+  w.context = context;
+  w.err = kAtcErrOk;
+  w.num_types = 0;
+  w.buffer_size = 0;
+
+  // Type 0 is used before the first transition.
+  AtcFindResult result;
+  atc_processor_init_for_zone_info(processor, zone_info);
+  atc_processor_find_by_unix_seconds(processor, start_unix_seconds, &result);
+  if (result.type == kAtcFindResultNotFound) return kAtcErrGeneric;
+  atc_tzif_writer_find_type(&w, result.std_offset_seconds
+      + result.dst_offset_seconds, result.dst_offset_seconds != 0,
+      result.abbrev, true);
+
+  // Pass 1: collect the local time types, and count the transitions.
+  AtcTransitionIterator it;
+  uint8_t type = 0;
+  int64_t unix_seconds;
+  uint32_t num_transitions = 0;
+  atc_transition_iterator_init(&it, processor, zone_info,
+      start_unix_seconds, until_unix_seconds);
+  while (atc_tzif_writer_next(&w, &it, true, &type, &unix_seconds)) {
+    num_transitions++;
+  }
+  if (w.err) return w.err;
+  uint32_t num_chars = atc_tzif_writer_index_abbrevs(&w);
+
+  // The footer is valid only after all transitions of the table.
+  char footer[kAtcTzifFooterSize];
+  int16_t footer_year;
+  size_t footer_size = 0;
+  char version = '2';
+  if (atc_tzif_create_footer(footer, sizeof(footer), zone_info, &footer_year)
+        == kAtcErrOk
+      && until_year > footer_year) {
+    AtcTzifFooter parsed;
+    footer_size = strlen(footer);
+    if (atc_tzif_parse_footer(&parsed, footer, footer_size) != kAtcErrOk) {
+      footer_size = 0;
+    } else if (parsed.has_dst
+        && (parsed.start.time_seconds < 0
+            || parsed.start.time_seconds > 86400
+            || parsed.end.time_seconds < 0
+            || parsed.end.time_seconds > 86400)) {
+      version = '3';
+    }
+  }
+
+  // The version 1 data block, with only type 0.
+  const AtcTzifWriterType *type0 = &w.types[0];
+  uint32_t type0_chars = strlen(type0->abbrev) + 1;
+  atc_tzif_writer_put_header(&w, version, 0, 1, type0_chars);
+  AtcTzifWriterType v1_type = *type0;
+  v1_type.desigidx = 0;
+  atc_tzif_writer_put_type(&w, &v1_type);
+  atc_tzif_writer_put(&w, type0->abbrev, type0_chars);
+
+  // The version 2 data block.
+  atc_tzif_writer_put_header(
+      &w, version, num_transitions, w.num_types, num_chars);
+
+  // Pass 2: the transition times.
+  type = 0;
+  atc_transition_iterator_init(&it, processor, zone_info,
+      start_unix_seconds, until_unix_seconds);
+  while (atc_tzif_writer_next(&w, &it, false, &type, &unix_seconds)) {
+    atc_tzif_writer_put64(&w, unix_seconds);
+  }
+
+  // Pass 3: the local time types of the transitions.
+  type = 0;
+  atc_transition_iterator_init(&it, processor, zone_info,
+      start_unix_seconds, until_unix_seconds);
+  while (atc_tzif_writer_next(&w, &it, false, &type, &unix_seconds)) {
+    atc_tzif_writer_put(&w, &type, 1);
+  }
+
+  for (uint8_t i = 0; i < w.num_types; i++) {
+    atc_tzif_writer_put_type(&w, &w.types[i]);
+  }
+  uint32_t chars_size = 0;
+  for (uint8_t i = 0; i < w.num_types; i++) {
+    const AtcTzifWriterType *t = &w.types[i];
+    if (t->desigidx == chars_size) {
+      chars_size += strlen(t->abbrev) + 1;
+      atc_tzif_writer_put(&w, t->abbrev, strlen(t->abbrev) + 1);
+    }
+  }
+
+  atc_tzif_writer_put(&w, "\n", 1);
+  atc_tzif_writer_put(&w, footer, footer_size);
+  atc_tzif_writer_put(&w, "\n", 1);
+  atc_tzif_writer_flush(&w);
+  return w.err;
+}
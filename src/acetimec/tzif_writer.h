@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file tzif_writer.h
+ *
+ * A writer of the TZif files (RFC 8536) from the AtcZoneInfo of a compiled
+ * zonedb, so that the hosts which read /usr/share/zoneinfo can use exactly the
+ * same TZ data as the devices which use the zonedb.
+ *
+ * The file is streamed through a callback in small chunks, so that it is
+ * never held in memory. The transitions of the requested years are obtained
+ * from an AtcTransitionIterator, which calculates the transitions only of the
+ * years in which the eras and rules of the zone may produce one. The
+ * iteration is repeated 3 times, because the file stores the counts before
+ * the transitions, and all transition times before all their local time
+ * types, and the writer has no buffer to hold them.
+ *
+ * The file contains a minimal version 1 data block with only the first local
+ * time type, like the "-b slim" output of zic, then the version 2 (or 3) data
+ * block with 64-bit transition times, then the POSIX TZ string of the
+ * footer, created by atc_tzif_create_footer().
+ */
+
+#ifndef ACE_TIME_C_TZIF_WRITER_H
+#define ACE_TIME_C_TZIF_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // kAtcErrOk, kAtcErrGeneric
+#include "zone_processor.h" // AtcZoneProcessor
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  /** Recommended size of the buffer of atc_tzif_create_footer(). */
+  kAtcTzifFooterSize = 64,
+
+  /**
+   * Maximum number of distinct local time types {UTC offset, isdst,
+   * abbreviation} of a file written by atc_tzif_write().
+   */
+  kAtcTzifWriterMaxTypes = 32,
+};
+
+/**
+ * Receives the next `size` bytes of the file written by atc_tzif_write().
+ * Returns kAtcErrOk to continue, or kAtcErrGeneric to stop the writer.
+ */
+typedef int8_t (*AtcTzifWriteCallback)(
+    void *context,
+    const uint8_t *data,
+    size_t size);
+
+/**
+ * Create the POSIX TZ string (e.g. "PST8PDT,M3.2.0,M11.1.0") which describes
+ * the final ZoneEra of the zone, and set `start_year` to the first year from
+ * which the string is valid, after all other eras and non-recurring rules
+ * have expired. A rule on a day of week which is not the first of its week
+ * (e.g. "Sun>=9") is shifted to the previous weekday with a transition time
+ * beyond 24:00, which requires version 3 of TZif.
+ *
+ * Returns kAtcErrGeneric if the final era cannot be represented by a POSIX TZ
+ * string, i.e. if it ends, if its ZonePolicy has other than 0 or 2 rules
+ * which never end, or if neither of the 2 rules has a DST offset of 0.
+ */
+int8_t atc_tzif_create_footer(
+    char *dest,
+    uint8_t dest_size,
+    const AtcZoneInfo *zone_info,
+    int16_t *start_year);
+
+/**
+ * Write the TZif file of `zone_info` with the transitions in the years
+ * [start_year, until_year) UTC, using the given processor as a work space.
+ * The instants before start_year use the local time type in effect at
+ * start_year. The footer is written only if until_year is after the start
+ * year of atc_tzif_create_footer(), otherwise it is empty, like "zic -r", and
+ * readers use the last local time type after until_year.
+ *
+ * Returns kAtcErrGeneric if the years are outside of (kAtcMinYear,
+ * kAtcMaxYear], if the zone has more than kAtcTzifWriterMaxTypes local time
+ * types in those years, or if the callback fails.
+ */
+int8_t atc_tzif_write(
+    const AtcZoneInfo *zone_info,
+    AtcZoneProcessor *processor,
+    int16_t start_year,
+    int16_t until_year,
+    AtcTzifWriteCallback callback,
+    void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
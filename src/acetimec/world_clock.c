@@ -0,0 +1,277 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h> // memset()
+#include "../zoneinfo/zone_info_utils.h"
+#include "epoch.h" // atc_epoch_to_unix_seconds()
+#include "plain_date.h" // atc_plain_date_to_unix_days()
+#include "plain_date_time.h" // atc_plain_date_time_from_unix_seconds()
+#include "steady_state.h"
+#include "time_zone.h" // atc_time_zone_for_zone_info()
+#include "world_clock.h"
+
+/**
+ * The rule of a ZonePolicy in effect at the instant of the snapshot, for a
+ * given STD offset.
+ */
+typedef struct AtcWorldClockPolicy {
+  const AtcZonePolicy *policy;
+  int32_t std_offset_seconds;
+  /** True if the policy is used by the final era of the zone. */
+  bool is_final;
+  /** The rule in effect, or NULL if the zone requires the AtcZoneProcessor. */
+  const AtcZoneRule *rule;
+  /** The interval [from, until) of Unix seconds in which the rule applies. */
+  int64_t valid_from_unix_seconds;
+  int64_t valid_until_unix_seconds;
+} AtcWorldClockPolicy;
+
+/** A zone which was already calculated, stored in `extras[index]`. */
+typedef struct AtcWorldClockZone {
+  const AtcZoneInfo *info;
+  uint16_t index;
+} AtcWorldClockZone;
+
+/** The state of a single snapshot, on the stack of the caller. */
+typedef struct AtcWorldClock {
+  int64_t unix_seconds;
+  int16_t year;
+  /** The UTC year [year_start, year_until) in Unix seconds. */
+  int64_t year_start;
+  int64_t year_until;
+  AtcWorldClockPolicy policies[kAtcWorldClockPolicyCacheSize];
+  AtcWorldClockZone zones[kAtcWorldClockZoneCacheSize];
+} AtcWorldClock;
+
+static void atc_world_clock_set_extra(
+    AtcZonedExtra *extra,
+    int32_t std_offset_seconds,
+    int32_t dst_offset_seconds,
+    int64_t valid_from_unix_seconds,
+    int64_t valid_until_unix_seconds)
+{
+  extra->resolved = kAtcResolvedUnique;
+  extra->std_offset_seconds = std_offset_seconds;
+  extra->dst_offset_seconds = dst_offset_seconds;
+  extra->req_std_offset_seconds = std_offset_seconds;
+  extra->req_dst_offset_seconds = dst_offset_seconds;
+  extra->valid_from_unix_seconds = valid_from_unix_seconds;
+  extra->valid_until_unix_seconds = valid_until_unix_seconds;
+}
+
+/**
+ * Return the ZoneEra which is the only era of the given zone in the years
+ * [year - 1, year + 1], or NULL if the AtcZoneProcessor may see more than one
+ * era in its 14-month window around `year`.
+ */
+static const AtcZoneEra *atc_world_clock_find_era(
+    const AtcZoneInfo *info,
+    int16_t year)
+{
+  for (uint8_t i = 0; i < info->num_eras; i++) {
+    const AtcZoneEra *era = &info->eras[i];
+    if (era->until_year < year + 2) continue;
+    if (i > 0 && info->eras[i - 1].until_year + 2 > year) return NULL;
+    return era;
+  }
+  return NULL;
+}
+
+/**
+ * Return the last rule of the given policy, if all of its rules expired at
+ * least 2 years before `year`. Otherwise return NULL.
+ */
+static const AtcZoneRule *atc_world_clock_find_final_rule(
+    const AtcZonePolicy *policy,
+    int16_t year)
+{
+  const AtcZoneRule *final = NULL;
+  int32_t final_date = 0;
+  for (uint8_t i = 0; i < policy->num_rules; i++) {
+    const AtcZoneRule *rule = &policy->rules[i];
+    if (rule->to_year + 2 > year) return NULL;
+
+    // Order the rules by the date and time of their last transition.
+    AtcMonthDay md = atc_processor_calc_start_day_of_month(
+        rule->to_year, rule->in_month, rule->on_day_of_week,
+        rule->on_day_of_month);
+    int32_t date = ((int32_t) rule->to_year * 100 + md.month) * 100 + md.day;
+    if (final == NULL
+        || date > final_date
+        || (date == final_date
+            && atc_zone_rule_at_seconds(rule)
+                > atc_zone_rule_at_seconds(final))) {
+      final = rule;
+      final_date = date;
+    }
+  }
+  return final;
+}
+
+/**
+ * Return the cache entry containing the rule of the policy of `era` in effect
+ * at the instant of the snapshot, and its validity interval. The rule is NULL
+ * if not found. The caller has verified that `era` is the
+ * only era of the zone around the instant. The result then depends only on
+ * the policy, the STD offset, and whether the era is the final era (which is
+ * required by the AtcSteadyState), so it is shared by the zones with the same
+ * values.
+ */
+static const AtcWorldClockPolicy *atc_world_clock_find_rule(
+    AtcWorldClock *clock,
+    const AtcZoneInfo *info,
+    const AtcZoneEra *era)
+{
+  const AtcZonePolicy *policy = era->zone_policy;
+  int32_t std_offset_seconds = atc_zone_era_std_offset_seconds(era);
+  bool is_final = (era == &info->eras[info->num_eras - 1]);
+  uintptr_t h = (uintptr_t) policy / sizeof(void*)
+      ^ ((uint32_t) std_offset_seconds * 2654435761u);
+  AtcWorldClockPolicy *entry =
+      &clock->policies[(h ^ (h >> 16)) % kAtcWorldClockPolicyCacheSize];
+  if (entry->policy == policy
+      && entry->std_offset_seconds == std_offset_seconds
+      && entry->is_final == is_final) {
+    return entry;
+  }
+
+  AtcSteadyState state;
+  const AtcZoneRule *rule;
+  if (is_final
+      && atc_steady_state_init(&state, info) == kAtcErrOk
+      && atc_steady_state_is_valid_for_year(&state, clock->year)) {
+    AtcFindResult result;
+    atc_steady_state_find_by_unix_seconds(
+        &state, clock->unix_seconds, &result);
+    rule = (result.abbrev == state.abbrevs[0])
+        ? state.rules[0]
+        : state.rules[1];
+    entry->valid_from_unix_seconds = result.valid_from_unix_seconds;
+    entry->valid_until_unix_seconds = result.valid_until_unix_seconds;
+  } else {
+    // No rule of the policy changes within the UTC year.
+    rule = atc_world_clock_find_final_rule(policy, clock->year);
+    entry->valid_from_unix_seconds = clock->year_start;
+    entry->valid_until_unix_seconds = clock->year_until;
+  }
+  entry->policy = policy;
+  entry->std_offset_seconds = std_offset_seconds;
+  entry->is_final = is_final;
+  entry->rule = rule;
+  return entry;
+}
+
+/**
+ * Fill the `extra` of the given zone without the AtcZoneProcessor. Returns
+ * false if the zone is near a change of ZoneEra or ZoneRule which requires
+ * the AtcZoneProcessor.
+ */
+static bool atc_world_clock_find_direct(
+    AtcWorldClock *clock,
+    const AtcZoneInfo *info,
+    AtcZonedExtra *extra)
+{
+  const AtcZoneEra *era = atc_world_clock_find_era(info, clock->year);
+  if (era == NULL) return false;
+
+  int32_t std_offset_seconds = atc_zone_era_std_offset_seconds(era);
+  int32_t dst_offset_seconds;
+  const char *letter;
+  // The era covers the whole UTC year.
+  int64_t valid_from_unix_seconds = clock->year_start;
+  int64_t valid_until_unix_seconds = clock->year_until;
+  if (era->zone_policy == NULL) {
+    // Simple era, with an empty letter.
+    dst_offset_seconds = atc_zone_era_dst_offset_seconds(era);
+    letter = "";
+  } else {
+    const AtcWorldClockPolicy *entry =
+        atc_world_clock_find_rule(clock, info, era);
+    const AtcZoneRule *rule = entry->rule;
+    if (rule == NULL) return false;
+    dst_offset_seconds = atc_zone_rule_dst_offset_seconds(rule);
+    letter = info->zone_context->letters[rule->letter_index];
+    valid_from_unix_seconds = entry->valid_from_unix_seconds;
+    valid_until_unix_seconds = entry->valid_until_unix_seconds;
+  }
+
+  atc_processor_create_abbreviation(
+      extra->abbrev, kAtcAbbrevSize, era->format,
+      std_offset_seconds, dst_offset_seconds, letter);
+  atc_world_clock_set_extra(
+      extra, std_offset_seconds, dst_offset_seconds,
+      valid_from_unix_seconds, valid_until_unix_seconds);
+  return true;
+}
+
+int8_t atc_world_clock_from_epoch_seconds(
+    AtcZonedExtra *extras,
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    atc_time_t epoch_seconds,
+    AtcZoneProcessor *processor)
+{
+  int64_t unix_seconds = (epoch_seconds == kAtcInvalidEpochSeconds)
+      ? kAtcInvalidUnixSeconds
+      : atc_epoch_to_unix_seconds(processor->epoch, epoch_seconds);
+  return atc_world_clock_from_unix_seconds(
+      extras, registry, registry_size, unix_seconds, processor);
+}
+
+int8_t atc_world_clock_from_unix_seconds(
+    AtcZonedExtra *extras,
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    int64_t unix_seconds,
+    AtcZoneProcessor *processor)
+{
+  AtcPlainDateTime pdt;
+  if (unix_seconds != kAtcInvalidUnixSeconds) {
+    atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds);
+  }
+  if (unix_seconds == kAtcInvalidUnixSeconds
+      || atc_plain_date_time_is_error(&pdt)) {
+    for (uint16_t i = 0; i < registry_size; i++) {
+      atc_zoned_extra_set_error(&extras[i]);
+    }
+    return (registry_size > 0) ? kAtcErrGeneric : kAtcErrOk;
+  }
+
+  AtcWorldClock clock;
+  clock.unix_seconds = unix_seconds;
+  clock.year = pdt.year;
+  clock.year_start = (int64_t) 86400
+      * atc_plain_date_to_unix_days(pdt.year, 1, 1);
+  clock.year_until = clock.year_start
+      + (int64_t) 86400 * (atc_is_leap_year(pdt.year) ? 366 : 365);
+  memset(clock.policies, 0, sizeof(clock.policies));
+  memset(clock.zones, 0, sizeof(clock.zones));
+
+  int8_t err = kAtcErrOk;
+  for (uint16_t i = 0; i < registry_size; i++) {
+    const AtcZoneInfo *info = registry[i];
+    if (atc_zone_info_is_link(info)) info = info->target_info;
+
+    // Copy the result of a zone which was already calculated.
+    AtcWorldClockZone *zone =
+        &clock.zones[info->zone_id % kAtcWorldClockZoneCacheSize];
+    if (zone->info == info) {
+      extras[i] = extras[zone->index];
+      if (atc_zoned_extra_is_error(&extras[i])) err = kAtcErrGeneric;
+      continue;
+    }
+    zone->info = info;
+    zone->index = i;
+
+    if (! atc_world_clock_find_direct(&clock, info, &extras[i])) {
+      AtcTimeZone tz = atc_time_zone_for_zone_info(info, processor);
+      atc_zoned_extra_from_unix_seconds(&extras[i], unix_seconds, &tz);
+    }
+    if (atc_zoned_extra_is_error(&extras[i])) err = kAtcErrGeneric;
+  }
+  return err;
+}
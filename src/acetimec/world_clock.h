@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file world_clock.h
+ *
+ * A snapshot of a single instant in every zone of a zone registry, for
+ * example the current UTC offset and abbreviation of each city of a world
+ * clock. Equivalent to calling atc_zoned_extra_from_epoch_seconds() for each
+ * entry of the registry, but most zones do not need the AtcZoneProcessor:
+ *
+ * 1) A Link is resolved to its target zone, and a zone which appears more than
+ * once is calculated only once.
+ * 2) A zone whose ZoneEra at the instant has no ZonePolicy, or a ZonePolicy
+ * whose rules have all expired, has a constant UTC offset, which is read
+ * directly from the ZoneEra and its final rule.
+ * 3) A zone in its AtcSteadyState is calculated from its 2 recurring rules.
+ * Zones which share the same ZonePolicy and STD offset (e.g. most of Europe)
+ * share the evaluation of the rules.
+ *
+ * The other zones (near a change of ZoneEra, or in a year before the steady
+ * state) use the AtcZoneProcessor provided by the caller.
+ */
+
+#ifndef ACE_TIME_C_WORLD_CLOCK_H
+#define ACE_TIME_C_WORLD_CLOCK_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // atc_time_t
+#include "zone_processor.h" // AtcZoneProcessor
+#include "zoned_extra.h" // AtcZonedExtra
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  /** Number of (ZonePolicy, STD offset) pairs remembered during a snapshot. */
+  kAtcWorldClockPolicyCacheSize = 128,
+
+  /** Number of zones remembered during a snapshot to detect duplicates. */
+  kAtcWorldClockZoneCacheSize = 64,
+};
+
+/**
+ * Fill `extras[i]` with the AtcZonedExtra of `registry[i]` at the given
+ * epoch_seconds, for each of the `registry_size` entries. The epoch_seconds is
+ * relative to the epoch of the `processor`. The `processor` is used as scratch
+ * space for the zones which cannot be calculated directly.
+ *
+ * Entries which cannot be calculated are set to an error state (see
+ * atc_zoned_extra_is_error()), and the function returns kAtcErrGeneric.
+ * Otherwise returns kAtcErrOk.
+ */
+int8_t atc_world_clock_from_epoch_seconds(
+    AtcZonedExtra *extras,
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    atc_time_t epoch_seconds,
+    AtcZoneProcessor *processor);
+
+/**
+ * Same as atc_world_clock_from_epoch_seconds() but using the 64-bit Unix
+ * seconds.
+ */
+int8_t atc_world_clock_from_unix_seconds(
+    AtcZonedExtra *extras,
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    int64_t unix_seconds,
+    AtcZoneProcessor *processor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,723 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+// Required by open(), fstat() and mmap() with -std=c11.
+#if ! defined(_POSIX_C_SOURCE) && ! defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <string.h> // memcmp(), memcpy(), memset(), strlen()
+#include "../zoneinfo/zone_info_utils.h"
+#include "zone_db.h"
+
+#if ACE_TIME_C_HAS_MMAP
+#include <fcntl.h> // open()
+#include <stdlib.h> // malloc(), free()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h> // close()
+#endif
+
+static const char kAtcZoneDbMagic[4] = {'A', 'T', 'Z', 'D'};
+
+/** Round up to a multiple of kAtcZoneDbAlign. */
+static size_t atc_zone_db_align(size_t n)
+{
+  return (n + kAtcZoneDbAlign - 1) & ~((size_t) kAtcZoneDbAlign - 1);
+}
+
+//---------------------------------------------------------------------------
+// Writer. Records shared by several entries of the registry are identified by
+// their first occurrence, found by a linear search, so that no scratch memory
+// is needed. A later occurrence copies the index of the first one from the
+// records already written.
+//---------------------------------------------------------------------------
+
+/** Number of records in each section, other than the infos. */
+typedef struct AtcZoneDbCounts {
+  uint32_t num_contexts;
+  uint32_t num_eras;
+  uint32_t num_policies;
+  uint32_t num_rules;
+  uint32_t num_refs;
+  uint32_t strings_size;
+} AtcZoneDbCounts;
+
+/** Return the index of the first entry with the same eras as entry `i`. */
+static uint16_t atc_zone_db_first_eras(
+    const AtcZoneInfo * const *registry,
+    uint16_t i)
+{
+  for (uint16_t j = 0; j < i; j++) {
+    if (registry[j]->eras == registry[i]->eras) return j;
+  }
+  return i;
+}
+
+/** Return the index of the first entry with the same context as entry `i`. */
+static uint16_t atc_zone_db_first_context(
+    const AtcZoneInfo * const *registry,
+    uint16_t i)
+{
+  for (uint16_t j = 0; j < i; j++) {
+    if (registry[j]->zone_context == registry[i]->zone_context) return j;
+  }
+  return i;
+}
+
+/** Return the index of `info` in the registry, or registry_size. */
+static uint16_t atc_zone_db_find_info(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    const AtcZoneInfo *info)
+{
+  for (uint16_t j = 0; j < registry_size; j++) {
+    if (registry[j] == info) return j;
+  }
+  return registry_size;
+}
+
+/**
+ * Find the first era of the registry which uses the same policy as `era` (if
+ * `is_format` is false) or the same format (if true). Always succeeds, since
+ * `era` itself belongs to the registry.
+ */
+static void atc_zone_db_find_era(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    const AtcZoneEra *era,
+    bool is_format,
+    uint16_t *info_index,
+    uint8_t *era_index)
+{
+  for (uint16_t j = 0; j < registry_size; j++) {
+    const AtcZoneInfo *info = registry[j];
+    for (uint8_t k = 0; k < info->num_eras; k++) {
+      const AtcZoneEra *e = &info->eras[k];
+      if (is_format ? (e->format == era->format)
+          : (e->zone_policy == era->zone_policy)) {
+        *info_index = j;
+        *era_index = k;
+        return;
+      }
+    }
+  }
+}
+
+/** Return the number of bytes of the string, including the NUL. */
+static uint32_t atc_zone_db_string_size(const char *s)
+{
+  return (s == NULL) ? 0 : (uint32_t) strlen(s) + 1;
+}
+
+static bool atc_zone_db_count(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    AtcZoneDbCounts *counts)
+{
+  memset(counts, 0, sizeof(*counts));
+  for (uint16_t i = 0; i < registry_size; i++) {
+    const AtcZoneInfo *info = registry[i];
+    counts->strings_size += atc_zone_db_string_size(info->name);
+    if (info->target_info != NULL
+        && atc_zone_db_find_info(registry, registry_size, info->target_info)
+            == registry_size) {
+      return false;
+    }
+
+    if (atc_zone_db_first_context(registry, i) == i) {
+      const AtcZoneContext *context = info->zone_context;
+      counts->num_contexts++;
+      counts->num_refs += context->num_fragments + context->num_letters;
+      counts->strings_size += atc_zone_db_string_size(context->tz_version);
+      for (uint8_t k = 0; k < context->num_fragments; k++) {
+        counts->strings_size += atc_zone_db_string_size(context->fragments[k]);
+      }
+      for (uint8_t k = 0; k < context->num_letters; k++) {
+        counts->strings_size += atc_zone_db_string_size(context->letters[k]);
+      }
+    }
+
+    if (atc_zone_db_first_eras(registry, i) != i) continue;
+    for (uint8_t k = 0; k < info->num_eras; k++) {
+      const AtcZoneEra *era = &info->eras[k];
+      uint16_t j;
+      uint8_t m;
+      counts->num_eras++;
+      atc_zone_db_find_era(registry, registry_size, era, true, &j, &m);
+      if (j == i && m == k) {
+        counts->strings_size += atc_zone_db_string_size(era->format);
+      }
+      if (era->zone_policy == NULL) continue;
+      atc_zone_db_find_era(registry, registry_size, era, false, &j, &m);
+      if (j == i && m == k) {
+        counts->num_policies++;
+        counts->num_rules += era->zone_policy->num_rules;
+      }
+    }
+  }
+  return true;
+}
+
+/** Set the offset of each section and the size of the file. */
+static bool atc_zone_db_layout(
+    const AtcZoneDbCounts *counts,
+    uint16_t num_infos,
+    AtcZoneDbHeader *header)
+{
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, kAtcZoneDbMagic, sizeof(kAtcZoneDbMagic));
+  header->byte_order = kAtcZoneDbByteOrder;
+  header->version = kAtcZoneDbVersion;
+  header->resolution = ACE_TIME_C_ZONEDB_RES;
+  header->rule_size = sizeof(AtcZoneRule);
+
+  struct {
+    AtcZoneDbSection *section;
+    uint32_t count;
+    size_t record_size;
+  } sections[] = {
+    {&header->contexts, counts->num_contexts, sizeof(AtcZoneDbContext)},
+    {&header->infos, num_infos, sizeof(AtcZoneDbInfo)},
+    {&header->eras, counts->num_eras, sizeof(AtcZoneDbEra)},
+    {&header->policies, counts->num_policies, sizeof(AtcZoneDbPolicy)},
+    {&header->rules, counts->num_rules, sizeof(AtcZoneRule)},
+    {&header->refs, counts->num_refs, sizeof(uint32_t)},
+    {&header->strings, counts->strings_size, 1},
+  };
+  size_t offset = atc_zone_db_align(sizeof(AtcZoneDbHeader));
+  for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++) {
+    sections[i].section->offset = (uint32_t) offset;
+    sections[i].section->count = sections[i].count;
+    offset = atc_zone_db_align(
+        offset + (size_t) sections[i].count * sections[i].record_size);
+    if (offset > UINT32_MAX) return false;
+  }
+  header->file_size = (uint32_t) offset;
+  return true;
+}
+
+size_t atc_zone_db_write_size(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size)
+{
+  AtcZoneDbCounts counts;
+  AtcZoneDbHeader header;
+  if (! atc_zone_db_count(registry, registry_size, &counts)) return 0;
+  if (! atc_zone_db_layout(&counts, registry_size, &header)) return 0;
+  return header.file_size;
+}
+
+/** Append the string to the strings section, return its offset. */
+static uint32_t atc_zone_db_put_string(
+    uint8_t *out,
+    uint32_t *end,
+    const char *s)
+{
+  if (s == NULL) return kAtcZoneDbNull;
+  uint32_t offset = *end;
+  uint32_t size = atc_zone_db_string_size(s);
+  memcpy(out + offset, s, size);
+  *end += size;
+  return offset;
+}
+
+/** Copy the scalar fields of the era into its file record. */
+static void atc_zone_db_put_era(AtcZoneDbEra *record, const AtcZoneEra *era)
+{
+  record->offset_code = era->offset_code;
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+  record->offset_remainder = era->offset_remainder;
+  record->delta = (uint8_t) era->delta_minutes;
+#else
+  record->offset_remainder = 0;
+  record->delta = era->delta_code;
+#endif
+  record->until_year = era->until_year;
+  record->until_month = era->until_month;
+  record->until_day = era->until_day;
+  record->until_time_code = era->until_time_code;
+  record->until_time_modifier = era->until_time_modifier;
+}
+
+size_t atc_zone_db_write(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    void *buffer,
+    size_t buffer_size)
+{
+  AtcZoneDbCounts counts;
+  AtcZoneDbHeader header;
+  if (! atc_zone_db_count(registry, registry_size, &counts)) return 0;
+  if (! atc_zone_db_layout(&counts, registry_size, &header)) return 0;
+  if (header.file_size > buffer_size
+      || (uintptr_t) buffer % kAtcZoneDbAlign != 0) {
+    return 0;
+  }
+
+  uint8_t *out = (uint8_t *) buffer;
+  memset(out, 0, header.file_size);
+  AtcZoneDbContext *contexts =
+      (AtcZoneDbContext *) (out + header.contexts.offset);
+  AtcZoneDbInfo *infos = (AtcZoneDbInfo *) (out + header.infos.offset);
+  AtcZoneDbEra *eras = (AtcZoneDbEra *) (out + header.eras.offset);
+  AtcZoneDbPolicy *policies =
+      (AtcZoneDbPolicy *) (out + header.policies.offset);
+  AtcZoneRule *rules = (AtcZoneRule *) (out + header.rules.offset);
+  uint32_t *refs = (uint32_t *) (out + header.refs.offset);
+  uint32_t strings_end = header.strings.offset;
+  memset(&counts, 0, sizeof(counts));
+
+  for (uint16_t i = 0; i < registry_size; i++) {
+    const AtcZoneInfo *info = registry[i];
+    AtcZoneDbInfo *record = &infos[i];
+    record->name = atc_zone_db_put_string(out, &strings_end, info->name);
+    record->zone_id = info->zone_id;
+    record->num_eras = info->num_eras;
+    if (info->target_info != NULL) {
+      record->target = 1u + atc_zone_db_find_info(
+          registry, registry_size, info->target_info);
+    }
+
+    uint16_t first = atc_zone_db_first_context(registry, i);
+    if (first != i) {
+      record->context = infos[first].context;
+    } else {
+      const AtcZoneContext *context = info->zone_context;
+      AtcZoneDbContext *c = &contexts[counts.num_contexts];
+      record->context = counts.num_contexts++;
+      c->start_year = context->start_year;
+      c->until_year = context->until_year;
+      c->start_year_accurate = context->start_year_accurate;
+      c->until_year_accurate = context->until_year_accurate;
+      c->max_transitions = context->max_transitions;
+      c->num_fragments = context->num_fragments;
+      c->num_letters = context->num_letters;
+      c->tz_version =
+          atc_zone_db_put_string(out, &strings_end, context->tz_version);
+      c->fragments = counts.num_refs;
+      for (uint8_t k = 0; k < context->num_fragments; k++) {
+        refs[counts.num_refs++] = atc_zone_db_put_string(
+            out, &strings_end, context->fragments[k]);
+      }
+      c->letters = counts.num_refs;
+      for (uint8_t k = 0; k < context->num_letters; k++) {
+        refs[counts.num_refs++] = atc_zone_db_put_string(
+            out, &strings_end, context->letters[k]);
+      }
+    }
+
+    first = atc_zone_db_first_eras(registry, i);
+    if (first != i) {
+      record->eras = infos[first].eras;
+      continue;
+    }
+    record->eras = counts.num_eras;
+    for (uint8_t k = 0; k < info->num_eras; k++) {
+      const AtcZoneEra *era = &info->eras[k];
+      AtcZoneDbEra *e = &eras[counts.num_eras++];
+      atc_zone_db_put_era(e, era);
+
+      uint16_t j;
+      uint8_t m;
+      atc_zone_db_find_era(registry, registry_size, era, true, &j, &m);
+      if (j == i && m == k) {
+        e->format = atc_zone_db_put_string(out, &strings_end, era->format);
+      } else {
+        e->format = eras[infos[j].eras + m].format;
+      }
+
+      const AtcZonePolicy *policy = era->zone_policy;
+      if (policy == NULL) continue;
+      atc_zone_db_find_era(registry, registry_size, era, false, &j, &m);
+      if (j == i && m == k) {
+        AtcZoneDbPolicy *p = &policies[counts.num_policies++];
+        p->rules = counts.num_rules;
+        p->num_rules = policy->num_rules;
+        memcpy(&rules[counts.num_rules], policy->rules,
+            policy->num_rules * sizeof(AtcZoneRule));
+        counts.num_rules += policy->num_rules;
+        e->policy = counts.num_policies;
+      } else {
+        e->policy = eras[infos[j].eras + m].policy;
+      }
+    }
+  }
+
+  memcpy(out, &header, sizeof(header));
+  return header.file_size;
+}
+
+//---------------------------------------------------------------------------
+// Loader
+//---------------------------------------------------------------------------
+
+static const AtcZoneDbHeader *atc_zone_db_header(const AtcZoneDb *db)
+{
+  return (const AtcZoneDbHeader *) db->data;
+}
+
+static bool atc_zone_db_is_valid_section(
+    const AtcZoneDbHeader *header,
+    const AtcZoneDbSection *section,
+    size_t record_size)
+{
+  return section->offset % kAtcZoneDbAlign == 0
+      && section->offset >= sizeof(AtcZoneDbHeader)
+      && (uint64_t) section->offset + (uint64_t) section->count * record_size
+          <= header->file_size;
+}
+
+int8_t atc_zone_db_init(AtcZoneDb *db, const void *data, size_t size)
+{
+  memset(db, 0, sizeof(*db));
+  const AtcZoneDbHeader *header = (const AtcZoneDbHeader *) data;
+  if (size < sizeof(AtcZoneDbHeader)
+      || (uintptr_t) data % kAtcZoneDbAlign != 0
+      || memcmp(header->magic, kAtcZoneDbMagic, sizeof(kAtcZoneDbMagic)) != 0
+      || header->byte_order != kAtcZoneDbByteOrder
+      || header->version != kAtcZoneDbVersion
+      || header->resolution != ACE_TIME_C_ZONEDB_RES
+      || header->rule_size != sizeof(AtcZoneRule)
+      || header->file_size > size) {
+    return kAtcErrGeneric;
+  }
+
+  if (! atc_zone_db_is_valid_section(
+          header, &header->contexts, sizeof(AtcZoneDbContext))
+      || ! atc_zone_db_is_valid_section(
+          header, &header->infos, sizeof(AtcZoneDbInfo))
+      || ! atc_zone_db_is_valid_section(
+          header, &header->eras, sizeof(AtcZoneDbEra))
+      || ! atc_zone_db_is_valid_section(
+          header, &header->policies, sizeof(AtcZoneDbPolicy))
+      || ! atc_zone_db_is_valid_section(
+          header, &header->rules, sizeof(AtcZoneRule))
+      || ! atc_zone_db_is_valid_section(
+          header, &header->refs, sizeof(uint32_t))
+      || ! atc_zone_db_is_valid_section(header, &header->strings, 1)
+      || header->infos.count > UINT16_MAX) {
+    return kAtcErrGeneric;
+  }
+
+  // The last string must be terminated, so that every string offset within
+  // the section is a valid C string.
+  const uint8_t *bytes = (const uint8_t *) data;
+  if (header->strings.count > 0
+      && bytes[header->strings.offset + header->strings.count - 1] != '\0') {
+    return kAtcErrGeneric;
+  }
+
+  db->data = bytes;
+  db->size = header->file_size;
+  return kAtcErrOk;
+}
+
+/** Layout of the linked records in the arena. */
+typedef struct AtcZoneDbArena {
+  AtcZoneContext *contexts;
+  AtcZonePolicy *policies;
+  AtcZoneEra *eras;
+  AtcZoneInfo *infos;
+  const AtcZoneInfo **registry;
+  const char **refs;
+} AtcZoneDbArena;
+
+/**
+ * Compute the offsets of the arrays of the linked records in the arena, in
+ * the order of the fields of AtcZoneDbArena. Returns the size of the arena.
+ */
+static size_t atc_zone_db_arena_offsets(
+    const AtcZoneDbHeader *header,
+    size_t offsets[6])
+{
+  size_t sizes[6] = {
+    header->contexts.count * sizeof(AtcZoneContext),
+    header->policies.count * sizeof(AtcZonePolicy),
+    header->eras.count * sizeof(AtcZoneEra),
+    header->infos.count * sizeof(AtcZoneInfo),
+    header->infos.count * sizeof(const AtcZoneInfo *),
+    header->refs.count * sizeof(const char *),
+  };
+  size_t offset = 0;
+  for (uint8_t i = 0; i < 6; i++) {
+    offsets[i] = offset;
+    offset = atc_zone_db_align(offset + sizes[i]);
+  }
+  return offset;
+}
+
+size_t atc_zone_db_arena_size(const AtcZoneDb *db)
+{
+  if (db->data == NULL) return 0;
+  size_t offsets[6];
+  return atc_zone_db_arena_offsets(atc_zone_db_header(db), offsets);
+}
+
+/**
+ * Resolve a string offset into a pointer into the data. Sets `*valid` to
+ * false if the offset is outside of the strings section.
+ */
+static const char *atc_zone_db_string(
+    const AtcZoneDb *db,
+    uint32_t offset,
+    bool *valid)
+{
+  const AtcZoneDbHeader *header = atc_zone_db_header(db);
+  if (offset == kAtcZoneDbNull) return NULL;
+  if (offset < header->strings.offset
+      || offset - header->strings.offset >= header->strings.count) {
+    *valid = false;
+    return NULL;
+  }
+  return (const char *) (db->data + offset);
+}
+
+/** Return true if the suffix is one of 'w', 's' or 'u'. */
+static bool atc_zone_db_is_valid_suffix(uint8_t suffix)
+{
+  return suffix == kAtcSuffixW || suffix == kAtcSuffixS
+      || suffix == kAtcSuffixU;
+}
+
+/**
+ * Return true if the fields of the rule are within the ranges of the TZDB
+ * files, which are assumed by the AtcZoneProcessor. The letter_index is
+ * checked against the context of each zone which uses the rule.
+ */
+static bool atc_zone_db_is_valid_rule(const AtcZoneRule *rule)
+{
+  int32_t at_seconds = atc_zone_rule_at_seconds(rule);
+  return rule->from_year <= rule->to_year
+      && rule->in_month >= 1 && rule->in_month <= 12
+      && rule->on_day_of_week <= 7
+      && rule->on_day_of_month >= -31 && rule->on_day_of_month <= 31
+      && (rule->on_day_of_week != 0 || rule->on_day_of_month >= 1)
+      && at_seconds >= 0 && at_seconds <= 25 * 3600
+      && atc_zone_db_is_valid_suffix(atc_zone_rule_at_suffix(rule));
+}
+
+/** Return true if the until fields of the era are valid. */
+static bool atc_zone_db_is_valid_era(const AtcZoneDbEra *e)
+{
+  return e->until_month >= 1 && e->until_month <= 12
+      && e->until_day >= 1 && e->until_day <= 31
+      && atc_zone_db_is_valid_suffix(e->until_time_modifier & 0xf0);
+}
+
+/**
+ * Return true if the letter_index of every rule of the eras is one of the
+ * letters of the context.
+ */
+static bool atc_zone_db_has_valid_letters(
+    const AtcZoneEra *eras,
+    uint8_t num_eras,
+    const AtcZoneContext *context)
+{
+  for (uint8_t k = 0; k < num_eras; k++) {
+    const AtcZonePolicy *policy = eras[k].zone_policy;
+    if (policy == NULL) continue;
+    for (uint8_t m = 0; m < policy->num_rules; m++) {
+      if (policy->rules[m].letter_index >= context->num_letters) return false;
+    }
+  }
+  return true;
+}
+
+int8_t atc_zone_db_link(AtcZoneDb *db, void *arena, size_t arena_size)
+{
+  if (db->data == NULL
+      || arena_size < atc_zone_db_arena_size(db)
+      || (uintptr_t) arena % sizeof(void *) != 0) {
+    return kAtcErrGeneric;
+  }
+
+  const AtcZoneDbHeader *header = atc_zone_db_header(db);
+  size_t offsets[6];
+  atc_zone_db_arena_offsets(header, offsets);
+  uint8_t *base = (uint8_t *) arena;
+  AtcZoneDbArena a = {
+    (AtcZoneContext *) (base + offsets[0]),
+    (AtcZonePolicy *) (base + offsets[1]),
+    (AtcZoneEra *) (base + offsets[2]),
+    (AtcZoneInfo *) (base + offsets[3]),
+    (const AtcZoneInfo **) (base + offsets[4]),
+    (const char **) (base + offsets[5]),
+  };
+  bool valid = true;
+
+  for (uint32_t i = 0; i < header->refs.count; i++) {
+    const uint32_t *refs = (const uint32_t *) (db->data + header->refs.offset);
+    a.refs[i] = atc_zone_db_string(db, refs[i], &valid);
+  }
+
+  const AtcZoneDbContext *contexts =
+      (const AtcZoneDbContext *) (db->data + header->contexts.offset);
+  for (uint32_t i = 0; i < header->contexts.count; i++) {
+    const AtcZoneDbContext *c = &contexts[i];
+    if ((uint64_t) c->fragments + c->num_fragments > header->refs.count
+        || (uint64_t) c->letters + c->num_letters > header->refs.count) {
+      return kAtcErrGeneric;
+    }
+    AtcZoneContext *context = &a.contexts[i];
+    context->start_year = c->start_year;
+    context->until_year = c->until_year;
+    context->start_year_accurate = c->start_year_accurate;
+    context->until_year_accurate = c->until_year_accurate;
+    context->max_transitions = c->max_transitions;
+    context->tz_version = atc_zone_db_string(db, c->tz_version, &valid);
+    context->num_fragments = c->num_fragments;
+    context->num_letters = c->num_letters;
+    context->fragments = &a.refs[c->fragments];
+    context->letters = &a.refs[c->letters];
+  }
+
+  // The records below have const fields, so they are initialized on the stack
+  // and copied into the arena.
+  const AtcZoneRule *rules =
+      (const AtcZoneRule *) (db->data + header->rules.offset);
+  const AtcZoneDbPolicy *policies =
+      (const AtcZoneDbPolicy *) (db->data + header->policies.offset);
+  for (uint32_t i = 0; i < header->policies.count; i++) {
+    const AtcZoneDbPolicy *p = &policies[i];
+    if ((uint64_t) p->rules + p->num_rules > header->rules.count) {
+      return kAtcErrGeneric;
+    }
+    for (uint8_t k = 0; k < p->num_rules; k++) {
+      if (! atc_zone_db_is_valid_rule(&rules[p->rules + k])) {
+        return kAtcErrGeneric;
+      }
+    }
+    AtcZonePolicy policy = {&rules[p->rules], p->num_rules};
+    memcpy(&a.policies[i], &policy, sizeof(policy));
+  }
+
+  const AtcZoneDbEra *eras =
+      (const AtcZoneDbEra *) (db->data + header->eras.offset);
+  for (uint32_t i = 0; i < header->eras.count; i++) {
+    const AtcZoneDbEra *e = &eras[i];
+    if (e->policy > header->policies.count
+        || e->format == kAtcZoneDbNull
+        || ! atc_zone_db_is_valid_era(e)) {
+      return kAtcErrGeneric;
+    }
+    const AtcZonePolicy *policy = (e->policy == kAtcZoneDbNull)
+        ? NULL
+        : &a.policies[e->policy - 1];
+    const char *format = atc_zone_db_string(db, e->format, &valid);
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+    AtcZoneEra era = {
+      policy,
+      format,
+      e->offset_code,
+      e->offset_remainder,
+      (int8_t) e->delta,
+      e->until_year,
+      e->until_month,
+      e->until_day,
+      e->until_time_code,
+      e->until_time_modifier,
+    };
+#else
+    AtcZoneEra era = {
+      policy,
+      format,
+      (int8_t) e->offset_code,
+      e->delta,
+      e->until_year,
+      e->until_month,
+      e->until_day,
+      (uint8_t) e->until_time_code,
+      e->until_time_modifier,
+    };
+#endif
+    memcpy(&a.eras[i], &era, sizeof(era));
+  }
+
+  const AtcZoneDbInfo *infos =
+      (const AtcZoneDbInfo *) (db->data + header->infos.offset);
+  for (uint32_t i = 0; i < header->infos.count; i++) {
+    const AtcZoneDbInfo *r = &infos[i];
+    if (r->context >= header->contexts.count
+        || (uint64_t) r->eras + r->num_eras > header->eras.count
+        || r->target > header->infos.count
+        || r->name == kAtcZoneDbNull
+        || ! atc_zone_db_has_valid_letters(
+            &a.eras[r->eras], r->num_eras, &a.contexts[r->context])) {
+      return kAtcErrGeneric;
+    }
+    const AtcZoneInfo *target = (r->target == kAtcZoneDbNull)
+        ? NULL
+        : &a.infos[r->target - 1];
+    AtcZoneInfo info = {
+      atc_zone_db_string(db, r->name, &valid),
+      r->zone_id,
+      &a.contexts[r->context],
+      r->num_eras,
+      &a.eras[r->eras],
+      target,
+    };
+    memcpy(&a.infos[i], &info, sizeof(info));
+    a.registry[i] = &a.infos[i];
+  }
+
+  if (! valid) return kAtcErrGeneric;
+  db->registry = a.registry;
+  db->registry_size = (uint16_t) header->infos.count;
+  db->arena = arena;
+  return kAtcErrOk;
+}
+
+//---------------------------------------------------------------------------
+
+#if ACE_TIME_C_HAS_MMAP
+
+int8_t atc_zone_db_open_file(AtcZoneDb *db, const char *path)
+{
+  memset(db, 0, sizeof(*db));
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return kAtcErrGeneric;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return kAtcErrGeneric;
+  }
+  size_t size = (size_t) st.st_size;
+  void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) return kAtcErrGeneric;
+
+  void *arena = NULL;
+  int8_t err = atc_zone_db_init(db, data, size);
+  if (! err) {
+    size_t arena_size = atc_zone_db_arena_size(db);
+    arena = malloc(arena_size > 0 ? arena_size : 1);
+    err = (arena == NULL)
+        ? kAtcErrGeneric
+        : atc_zone_db_link(db, arena, arena_size);
+  }
+  if (err) {
+    free(arena);
+    munmap(data, size);
+    memset(db, 0, sizeof(*db));
+    return err;
+  }
+
+  // munmap() needs the size of the mapping, which may exceed the file_size.
+  db->size = size;
+  db->is_mapped = true;
+  return kAtcErrOk;
+}
+
+void atc_zone_db_close_file(AtcZoneDb *db)
+{
+  if (db->is_mapped) {
+    free(db->arena);
+    munmap((void *) db->data, db->size);
+  }
+  memset(db, 0, sizeof(*db));
+}
+
+#endif
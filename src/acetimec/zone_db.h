@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file zone_db.h
+ *
+ * A binary file format for a zone database, so that the TZ data can be updated
+ * without recompiling the program. The file contains the same records as the
+ * zonedb C files (contexts, infos, eras, policies, rules, letters, formats and
+ * names), with every pointer replaced by an index into a record array or an
+ * offset from the start of the file to a NUL-terminated string. It does not
+ * depend on the address where it is loaded, so it can be mapped read-only into
+ * memory and shared by several processes through the page cache.
+ *
+ * The rules are stored in the native layout of AtcZoneRule and the strings are
+ * used in place, without copying. The AtcZoneInfo, AtcZoneEra, AtcZonePolicy
+ * and AtcZoneContext records contain pointers, so they are linked once in a
+ * caller-provided arena, in a single pass over the records without any
+ * parsing. The result is a registry of AtcZoneInfo which can be given to the
+ * AtcZoneRegistrar or the AtcTimeZone functions like a compiled zonedb.
+ *
+ * The records use the byte order, and the rules use the resolution
+ * (ACE_TIME_C_ZONEDB_RES), of the program which wrote the file. A file with a
+ * different byte order or resolution is rejected.
+ */
+
+#ifndef ACE_TIME_C_ZONE_DB_H
+#define ACE_TIME_C_ZONE_DB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h" // kAtcErrOk, kAtcErrGeneric, ACE_TIME_C_HAS_MMAP
+#include "../zoneinfo/zone_info.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  /** Version of the file format. */
+  kAtcZoneDbVersion = 1,
+
+  /** Value of AtcZoneDbHeader.byte_order in the byte order of the writer. */
+  kAtcZoneDbByteOrder = 0x0102,
+
+  /** Alignment of the sections, and of the start of the file in memory. */
+  kAtcZoneDbAlign = 8,
+
+  /** Value of the index and offset fields which represent a NULL pointer. */
+  kAtcZoneDbNull = 0,
+};
+
+/** The location of an array of records within the file. */
+typedef struct AtcZoneDbSection {
+  /** Offset of the first record from the start of the file. */
+  uint32_t offset;
+  /** Number of records, or number of bytes for the strings. */
+  uint32_t count;
+} AtcZoneDbSection;
+
+/** The header at the start of the file. */
+typedef struct AtcZoneDbHeader {
+  /** "ATZD" */
+  char magic[4];
+  /** Set to kAtcZoneDbByteOrder. */
+  uint16_t byte_order;
+  /** Set to kAtcZoneDbVersion. */
+  uint8_t version;
+  /** The ACE_TIME_C_ZONEDB_RES of the rules. */
+  uint8_t resolution;
+  /** Total size of the file. */
+  uint32_t file_size;
+  /** sizeof(AtcZoneRule) of the writer. */
+  uint16_t rule_size;
+  uint16_t reserved;
+
+  /** AtcZoneDbContext records. */
+  AtcZoneDbSection contexts;
+  /** AtcZoneDbInfo records, in the order of the registry which was written. */
+  AtcZoneDbSection infos;
+  /** AtcZoneDbEra records. */
+  AtcZoneDbSection eras;
+  /** AtcZoneDbPolicy records. */
+  AtcZoneDbSection policies;
+  /** AtcZoneRule records, in the native layout. */
+  AtcZoneDbSection rules;
+  /** uint32_t string offsets, for the letters and fragments of the contexts. */
+  AtcZoneDbSection refs;
+  /** NUL-terminated strings. The count is the number of bytes. */
+  AtcZoneDbSection strings;
+} AtcZoneDbHeader;
+
+/** File record of an AtcZoneContext. */
+typedef struct AtcZoneDbContext {
+  int16_t start_year;
+  int16_t until_year;
+  int16_t start_year_accurate;
+  int16_t until_year_accurate;
+  int16_t max_transitions;
+  uint8_t num_fragments;
+  uint8_t num_letters;
+  /** String offset of the TZ Database version. */
+  uint32_t tz_version;
+  /** Index of the first fragment in the refs. */
+  uint32_t fragments;
+  /** Index of the first letter in the refs. */
+  uint32_t letters;
+} AtcZoneDbContext;
+
+/** File record of an AtcZoneInfo. */
+typedef struct AtcZoneDbInfo {
+  /** String offset of the name. */
+  uint32_t name;
+  uint32_t zone_id;
+  /** Index of the context. */
+  uint32_t context;
+  /** Index of the first era. Shared by a Link and its target. */
+  uint32_t eras;
+  /** Index + 1 of the target of a Link, or kAtcZoneDbNull for a Zone. */
+  uint32_t target;
+  uint8_t num_eras;
+  uint8_t reserved[3];
+} AtcZoneDbInfo;
+
+/**
+ * File record of an AtcZoneEra. The fields are wide enough for both the
+ * highres and the midres AtcZoneEra.
+ */
+typedef struct AtcZoneDbEra {
+  /** Index + 1 of the policy, or kAtcZoneDbNull. */
+  uint32_t policy;
+  /** String offset of the format. */
+  uint32_t format;
+  int16_t offset_code;
+  /** Always 0 in midres. */
+  uint8_t offset_remainder;
+  /** The delta_minutes (highres) or the delta_code (midres). */
+  uint8_t delta;
+  int16_t until_year;
+  uint8_t until_month;
+  uint8_t until_day;
+  uint16_t until_time_code;
+  uint8_t until_time_modifier;
+  uint8_t reserved;
+} AtcZoneDbEra;
+
+/** File record of an AtcZonePolicy. */
+typedef struct AtcZoneDbPolicy {
+  /** Index of the first rule. */
+  uint32_t rules;
+  uint8_t num_rules;
+  uint8_t reserved[3];
+} AtcZoneDbPolicy;
+
+/** A zone database loaded from a file or from a buffer in memory. */
+typedef struct AtcZoneDb {
+  /** The content of the file. */
+  const uint8_t *data;
+
+  /** Size of the data. */
+  size_t size;
+
+  /** The linked AtcZoneInfo records, in the order of the file. */
+  const AtcZoneInfo * const *registry;
+
+  /** Number of zones and links in the registry. */
+  uint16_t registry_size;
+
+  /** Memory of the linked records, owned by the AtcZoneDb if is_mapped. */
+  void *arena;
+
+  /** True if the data was mapped by atc_zone_db_open_file(). */
+  bool is_mapped;
+} AtcZoneDb;
+
+/**
+ * Return the size of the file which contains the zones and links of the
+ * registry, or 0 if the registry cannot be written, e.g. because the target
+ * of a Link is not in the registry.
+ */
+size_t atc_zone_db_write_size(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size);
+
+/**
+ * Write the zones and links of the registry into the buffer, which must be
+ * aligned to kAtcZoneDbAlign. The eras, policies, contexts and formats shared
+ * by several zones are written once. Returns the number of bytes written, or
+ * 0 if the buffer is too small or the registry cannot be written.
+ */
+size_t atc_zone_db_write(
+    const AtcZoneInfo * const *registry,
+    uint16_t registry_size,
+    void *buffer,
+    size_t buffer_size);
+
+/**
+ * Initialize the AtcZoneDb with the content of a file, which must be aligned
+ * to kAtcZoneDbAlign and remain valid while the AtcZoneDb is used. Validates
+ * the header and the bounds of the sections. Returns kAtcErrGeneric if the
+ * data is not a valid file for this program.
+ */
+int8_t atc_zone_db_init(AtcZoneDb *db, const void *data, size_t size);
+
+/** Return the size of the arena required by atc_zone_db_link(). */
+size_t atc_zone_db_arena_size(const AtcZoneDb *db);
+
+/**
+ * Create the AtcZoneInfo records of the file in the arena, which must be
+ * aligned for pointers, and set `db->registry`. Every index and string offset
+ * is checked before use, and so are the fields of the rules and eras which are
+ * used as indexes or dates by the AtcZoneProcessor (e.g. the letter_index of
+ * each rule against the letters of its context, and the months and days).
+ * Returns kAtcErrGeneric if the arena is too small or the file contains an
+ * invalid reference or field.
+ */
+int8_t atc_zone_db_link(AtcZoneDb *db, void *arena, size_t arena_size);
+
+#if ACE_TIME_C_HAS_MMAP
+
+/**
+ * Map the file at `path` read-only into memory, validate it, and link it into
+ * an arena allocated on the heap. Returns kAtcErrGeneric on failure, with
+ * nothing left to release.
+ */
+int8_t atc_zone_db_open_file(AtcZoneDb *db, const char *path);
+
+/** Release the mapping and the arena of atc_zone_db_open_file(). */
+void atc_zone_db_close_file(AtcZoneDb *db);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include <string.h> // strcmp()
+#include "zone_hash.h"
+
+enum {
+  /** Maximum number of zones in a bucket. */
+  kAtcZoneHashMaxBucketSize = 16,
+
+  /**
+   * Marks a bucket which is not placed yet, with its size in the lower bits.
+   * The seeds are smaller than this value.
+   */
+  kAtcZoneHashUnplaced = 0x8000,
+};
+
+/** The finalizer of MurmurHash3, which spreads the bits of the zone_id. */
+static uint32_t atc_zone_hash_mix(uint32_t h)
+{
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+/** Map the hash into [0, n) using a multiplication instead of a division. */
+static uint16_t atc_zone_hash_reduce(uint32_t h, uint16_t n)
+{
+  return (uint16_t) (((uint64_t) h * n) >> 32);
+}
+
+static uint16_t atc_zone_hash_bucket(uint32_t h, uint16_t num_buckets)
+{
+  return atc_zone_hash_reduce(h, num_buckets);
+}
+
+static uint16_t atc_zone_hash_slot(uint32_t h, uint16_t seed, uint16_t size)
+{
+  uint32_t x = h ^ ((uint32_t) (seed + 1) * 0x9e3779b9);
+  return atc_zone_hash_reduce(atc_zone_hash_mix(x), size);
+}
+
+/**
+ * Find the seed which places all zones of the bucket into free slots, and
+ * fill their slots. Returns false if there is none.
+ */
+static bool atc_zone_hash_place_bucket(
+    AtcZoneHash *hash,
+    uint16_t *seeds,
+    uint16_t *indexes,
+    uint16_t bucket,
+    const uint16_t *keys,
+    uint8_t num_keys)
+{
+  uint16_t slots[kAtcZoneHashMaxBucketSize];
+  for (uint16_t seed = 0; seed < kAtcZoneHashUnplaced; seed++) {
+    bool ok = true;
+    for (uint8_t i = 0; i < num_keys && ok; i++) {
+      uint32_t h = atc_zone_hash_mix(hash->registry[keys[i]]->zone_id);
+      uint16_t slot = atc_zone_hash_slot(h, seed, hash->size);
+      if (indexes[slot] != UINT16_MAX) ok = false;
+      for (uint8_t j = 0; j < i && ok; j++) {
+        if (slots[j] == slot) ok = false;
+      }
+      slots[i] = slot;
+    }
+    if (ok) {
+      for (uint8_t i = 0; i < num_keys; i++) indexes[slots[i]] = keys[i];
+      seeds[bucket] = seed;
+      return true;
+    }
+  }
+  return false;
+}
+
+int8_t atc_zone_hash_init(
+    AtcZoneHash *hash,
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *seeds,
+    uint16_t num_buckets,
+    uint16_t *indexes)
+{
+  hash->registry = registry;
+  hash->size = size;
+  hash->num_buckets = num_buckets;
+  hash->seeds = seeds;
+  hash->indexes = indexes;
+  if (size == 0) return kAtcErrOk;
+  if (num_buckets == 0 || size == UINT16_MAX) return kAtcErrGeneric;
+
+  // Count the zones of each bucket into its seed.
+  for (uint16_t b = 0; b < num_buckets; b++) seeds[b] = kAtcZoneHashUnplaced;
+  for (uint16_t i = 0; i < size; i++) indexes[i] = UINT16_MAX;
+  uint8_t max_bucket_size = 0;
+  for (uint16_t i = 0; i < size; i++) {
+    uint32_t h = atc_zone_hash_mix(registry[i]->zone_id);
+    uint16_t b = atc_zone_hash_bucket(h, num_buckets);
+    uint8_t bucket_size = (uint8_t) (seeds[b] - kAtcZoneHashUnplaced) + 1;
+    if (bucket_size > kAtcZoneHashMaxBucketSize) return kAtcErrGeneric;
+    if (bucket_size > max_bucket_size) max_bucket_size = bucket_size;
+    seeds[b]++;
+  }
+
+  // Place the largest buckets first, while most slots are free.
+  for (uint8_t bucket_size = max_bucket_size; bucket_size > 0; bucket_size--) {
+    for (uint16_t b = 0; b < num_buckets; b++) {
+      if (seeds[b] != kAtcZoneHashUnplaced + bucket_size) continue;
+
+      uint16_t keys[kAtcZoneHashMaxBucketSize];
+      uint8_t num_keys = 0;
+      for (uint16_t i = 0; i < size; i++) {
+        uint32_t zone_id = registry[i]->zone_id;
+        uint32_t h = atc_zone_hash_mix(zone_id);
+        if (atc_zone_hash_bucket(h, num_buckets) != b) continue;
+        // Duplicate zone_ids are always in the same bucket.
+        for (uint8_t j = 0; j < num_keys; j++) {
+          if (registry[keys[j]]->zone_id == zone_id) return kAtcErrGeneric;
+        }
+        keys[num_keys++] = i;
+      }
+      if (! atc_zone_hash_place_bucket(
+          hash, seeds, indexes, b, keys, num_keys)) {
+        return kAtcErrGeneric;
+      }
+    }
+  }
+
+  // The empty buckets are never used.
+  for (uint16_t b = 0; b < num_buckets; b++) {
+    if (seeds[b] == kAtcZoneHashUnplaced) seeds[b] = 0;
+  }
+  return kAtcErrOk;
+}
+
+uint16_t atc_zone_hash_find_index(const AtcZoneHash *hash, uint32_t zone_id)
+{
+  if (hash->size == 0) return UINT16_MAX;
+  uint32_t h = atc_zone_hash_mix(zone_id);
+  uint16_t seed = hash->seeds[atc_zone_hash_bucket(h, hash->num_buckets)];
+  uint16_t index = hash->indexes[atc_zone_hash_slot(h, seed, hash->size)];
+  return (hash->registry[index]->zone_id == zone_id) ? index : UINT16_MAX;
+}
+
+const AtcZoneInfo *atc_zone_hash_find_by_id(
+    const AtcZoneHash *hash,
+    uint32_t zone_id)
+{
+  uint16_t index = atc_zone_hash_find_index(hash, zone_id);
+  return (index == UINT16_MAX) ? NULL : hash->registry[index];
+}
+
+const AtcZoneInfo *atc_zone_hash_find_by_name(
+    const AtcZoneHash *hash,
+    const char *name)
+{
+  const AtcZoneInfo *info = atc_zone_hash_find_by_id(hash, atc_djb2(name));
+  if (info == NULL) return NULL;
+
+  // Verify that the name actually matches, in case of hash collision.
+  return (strcmp(name, info->name) == 0) ? info : NULL;
+}
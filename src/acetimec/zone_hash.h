@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file zone_hash.h
+ *
+ * A minimal perfect hash over the zone_id of the zones of a registry, so that
+ * a zone is found by its zone_id (or its name) with a single probe, instead of
+ * a binary search which reads the AtcZoneInfo of every level.
+ *
+ * The hash uses the "hash and displace" method. Each zone_id is mixed, then
+ * assigned to one of `num_buckets` buckets. Each bucket has a 16-bit seed,
+ * chosen by atc_zone_hash_init() so that the zone_ids of all the buckets are
+ * mixed with their seed into distinct slots of [0, size). The slot holds the
+ * index of the zone in the registry. A lookup reads one seed, one index, and
+ * the AtcZoneInfo which is compared with the zone_id. The tables use
+ * 2 * (num_buckets + size) bytes.
+ *
+ * The tables of the registries of each zonedb are precomputed in its
+ * `zone_hash.h` file (e.g. kAtcZonedb2025ZoneAndLinkHash) by
+ * tools/zone_hash_generator, so that they can be stored in flash.
+ */
+
+#ifndef ACE_TIME_C_ZONE_HASH_H
+#define ACE_TIME_C_ZONE_HASH_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // kAtcErrOk, kAtcErrGeneric
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Number of buckets of a registry of the given size, 1 bucket for every 3
+ * zones on average.
+ */
+#define ATC_ZONE_HASH_NUM_BUCKETS(size) (((size) + 2) / 3)
+
+/** A minimal perfect hash of the zone_ids of a registry. */
+typedef struct AtcZoneHash {
+  /** An array of pointers to AtcZoneInfo. */
+  const AtcZoneInfo * const *registry;
+
+  /** Size of the registry, and of the indexes. */
+  uint16_t size;
+
+  /** Number of buckets, and of the seeds. */
+  uint16_t num_buckets;
+
+  /** The seed of each bucket. */
+  const uint16_t *seeds;
+
+  /** The index in the registry of the zone of each slot. */
+  const uint16_t *indexes;
+} AtcZoneHash;
+
+/**
+ * Build the minimal perfect hash of the registry into the `seeds` array of
+ * `num_buckets` elements, usually ATC_ZONE_HASH_NUM_BUCKETS(size), and the
+ * `indexes` array of `size` elements, which must remain valid while the hash
+ * is used. The registry does not need to be sorted.
+ *
+ * Returns kAtcErrGeneric if the registry contains duplicate zone_ids, or if
+ * no seed is found for a bucket, which happens only if num_buckets is much
+ * smaller than the recommended value.
+ */
+int8_t atc_zone_hash_init(
+    AtcZoneHash *hash,
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *seeds,
+    uint16_t num_buckets,
+    uint16_t *indexes);
+
+/**
+ * Return the index in the registry of the zone with the given zone_id, or
+ * UINT16_MAX if not found.
+ */
+uint16_t atc_zone_hash_find_index(const AtcZoneHash *hash, uint32_t zone_id);
+
+/** Return the zone with the given zone_id, or NULL if not found. */
+const AtcZoneInfo *atc_zone_hash_find_by_id(
+    const AtcZoneHash *hash,
+    uint32_t zone_id);
+
+/**
+ * Return the zone with the given name, or NULL if not found. The name is
+ * hashed into its zone_id with atc_djb2(), then verified with strcmp().
+ */
+const AtcZoneInfo *atc_zone_hash_find_by_name(
+    const AtcZoneHash *hash,
+    const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stddef.h> // NULL
+#include "common.h" // kAtcErrOk
+#include "zone_manager.h"
+
+void atc_zone_manager_init(
+    AtcZoneManager *manager,
+    const AtcZoneRegistrar *registrar,
+    AtcZoneManagerSlot *slots,
+    uint16_t num_slots)
+{
+  manager->registrar = registrar;
+  manager->slots = slots;
+  manager->num_slots = num_slots;
+  for (uint16_t i = 0; i < num_slots; i++) {
+    atc_processor_init(&slots[i].processor);
+  }
+  atc_zone_manager_clear(manager);
+}
+
+void atc_zone_manager_clear(AtcZoneManager *manager)
+{
+  for (uint16_t i = 0; i < manager->num_slots; i++) {
+    manager->slots[i].bucket_head = kAtcZoneManagerNoSlot;
+  }
+  manager->num_used = 0;
+  manager->lru_head = kAtcZoneManagerNoSlot;
+  manager->lru_tail = kAtcZoneManagerNoSlot;
+  manager->num_hits = 0;
+  manager->num_misses = 0;
+  manager->num_evictions = 0;
+}
+
+static uint16_t atc_zone_manager_hash(
+    const AtcZoneManager *manager,
+    uint32_t zone_id)
+{
+  uint32_t h = zone_id * 2654435761u;
+  return (uint16_t) ((h ^ (h >> 16)) % manager->num_slots);
+}
+
+/** Remove the slot from the LRU list. */
+static void atc_zone_manager_lru_remove(AtcZoneManager *manager, uint16_t i)
+{
+  AtcZoneManagerSlot *slot = &manager->slots[i];
+  if (slot->lru_prev != kAtcZoneManagerNoSlot) {
+    manager->slots[slot->lru_prev].lru_next = slot->lru_next;
+  } else {
+    manager->lru_head = slot->lru_next;
+  }
+  if (slot->lru_next != kAtcZoneManagerNoSlot) {
+    manager->slots[slot->lru_next].lru_prev = slot->lru_prev;
+  } else {
+    manager->lru_tail = slot->lru_prev;
+  }
+}
+
+/** Insert the slot at the front (most recently used) of the LRU list. */
+static void atc_zone_manager_lru_push_front(
+    AtcZoneManager *manager,
+    uint16_t i)
+{
+  AtcZoneManagerSlot *slot = &manager->slots[i];
+  slot->lru_prev = kAtcZoneManagerNoSlot;
+  slot->lru_next = manager->lru_head;
+  if (manager->lru_head != kAtcZoneManagerNoSlot) {
+    manager->slots[manager->lru_head].lru_prev = i;
+  } else {
+    manager->lru_tail = i;
+  }
+  manager->lru_head = i;
+}
+
+/** Remove the slot from the hash chain of its zone_id. */
+static void atc_zone_manager_hash_remove(AtcZoneManager *manager, uint16_t i)
+{
+  AtcZoneManagerSlot *slot = &manager->slots[i];
+  uint16_t *link = &manager->slots[
+      atc_zone_manager_hash(manager, slot->zone_id)].bucket_head;
+  while (*link != i) {
+    link = &manager->slots[*link].hash_next;
+  }
+  *link = slot->hash_next;
+}
+
+AtcZoneProcessor *atc_zone_manager_get_processor(
+    AtcZoneManager *manager,
+    uint32_t zone_id)
+{
+  if (manager->num_slots == 0) return NULL;
+
+  // Search the hash chain.
+  uint16_t *head = &manager->slots[
+      atc_zone_manager_hash(manager, zone_id)].bucket_head;
+  for (uint16_t i = *head; i != kAtcZoneManagerNoSlot;
+      i = manager->slots[i].hash_next) {
+    AtcZoneManagerSlot *slot = &manager->slots[i];
+    if (slot->zone_id == zone_id) {
+      manager->num_hits++;
+      if (manager->lru_head != i) {
+        atc_zone_manager_lru_remove(manager, i);
+        atc_zone_manager_lru_push_front(manager, i);
+      }
+      // Rebind the processor, in case an AtcTimeZone kept from a previous
+      // call has used it for another zone.
+      atc_processor_init_for_zone_info(&slot->processor, slot->zone_info);
+      return &slot->processor;
+    }
+  }
+
+  const AtcZoneInfo *info = atc_registrar_find_by_id(
+      manager->registrar, zone_id);
+  if (info == NULL) return NULL;
+  manager->num_misses++;
+
+  // Use an unused slot, or evict the least recently used zone.
+  uint16_t i;
+  if (manager->num_used < manager->num_slots) {
+    i = manager->num_used++;
+  } else {
+    i = manager->lru_tail;
+    atc_zone_manager_lru_remove(manager, i);
+    atc_zone_manager_hash_remove(manager, i);
+    manager->num_evictions++;
+  }
+
+  AtcZoneManagerSlot *slot = &manager->slots[i];
+  slot->zone_info = info;
+  slot->zone_id = zone_id;
+  slot->hash_next = *head;
+  *head = i;
+  atc_zone_manager_lru_push_front(manager, i);
+  atc_processor_init_for_zone_info(&slot->processor, info);
+  return &slot->processor;
+}
+
+int8_t atc_zone_manager_time_zone_for_id(
+    AtcZoneManager *manager,
+    uint32_t zone_id,
+    AtcTimeZone *tz)
+{
+  AtcZoneProcessor *processor = atc_zone_manager_get_processor(
+      manager, zone_id);
+  if (processor == NULL) return kAtcErrGeneric;
+  *tz = atc_time_zone_for_zone_info(processor->zone_info, processor);
+  return kAtcErrOk;
+}
+
+int8_t atc_zone_manager_time_zone_for_name(
+    AtcZoneManager *manager,
+    const char *name,
+    AtcTimeZone *tz)
+{
+  const AtcZoneInfo *info = atc_registrar_find_by_name(
+      manager->registrar, name);
+  if (info == NULL) return kAtcErrGeneric;
+  return atc_zone_manager_time_zone_for_id(manager, info->zone_id, tz);
+}
@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file zone_manager.h
+ *
+ * A pool of AtcZoneProcessor objects keyed by zone_id, for applications which
+ * use many more time zones than they can afford processors (e.g. a server
+ * with a time zone per user). The zones are found in an AtcZoneRegistrar. The
+ * pool has a fixed number of slots provided by the caller. When all slots are
+ * used, the least recently used zone is evicted. Recently used zones keep
+ * their processor, so that their transitions are not regenerated.
+ *
+ * The slots are found using a hash table with chaining, whose buckets are
+ * stored in the slots themselves, and the LRU order is a doubly-linked list,
+ * so a lookup takes constant time, independent of the number of slots.
+ */
+
+#ifndef ACE_TIME_C_ZONE_MANAGER_H
+#define ACE_TIME_C_ZONE_MANAGER_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "zone_processor.h" // AtcZoneProcessor
+#include "zone_registrar.h" // AtcZoneRegistrar
+#include "time_zone.h" // AtcTimeZone
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  /** Index of a slot which does not exist. */
+  kAtcZoneManagerNoSlot = UINT16_MAX,
+};
+
+/** A slot of the AtcZoneManager. */
+typedef struct AtcZoneManagerSlot {
+  /** The processor of the zone, bound to its AtcZoneInfo if the slot is used. */
+  AtcZoneProcessor processor;
+
+  /** The zone in this slot. */
+  const AtcZoneInfo *zone_info;
+
+  /** The zone_id of the zone in this slot. */
+  uint32_t zone_id;
+
+  /** First slot of the hash chain of the bucket with the index of this slot. */
+  uint16_t bucket_head;
+
+  /** Next slot in the same hash chain. */
+  uint16_t hash_next;
+
+  /** More recently used slot. */
+  uint16_t lru_prev;
+
+  /** Less recently used slot. */
+  uint16_t lru_next;
+} AtcZoneManagerSlot;
+
+/** A pool of AtcZoneProcessor, keyed by zone_id, with LRU eviction. */
+typedef struct AtcZoneManager {
+  /** The registrar used to find the zones. */
+  const AtcZoneRegistrar *registrar;
+
+  /** Array of slots. */
+  AtcZoneManagerSlot *slots;
+
+  /** Number of slots. */
+  uint16_t num_slots;
+
+  /** Number of slots in use. Slots [0, num_used) are used. */
+  uint16_t num_used;
+
+  /** Most recently used slot. */
+  uint16_t lru_head;
+
+  /** Least recently used slot, evicted next. */
+  uint16_t lru_tail;
+
+  /** Number of lookups which found the zone in a slot. */
+  uint32_t num_hits;
+
+  /** Number of lookups which assigned a slot to the zone. */
+  uint32_t num_misses;
+
+  /** Number of zones which were evicted to free a slot. */
+  uint32_t num_evictions;
+} AtcZoneManager;
+
+/**
+ * Initialize the manager with the given registrar and array of slots. The
+ * registrar and the slots must outlive the manager.
+ */
+void atc_zone_manager_init(
+    AtcZoneManager *manager,
+    const AtcZoneRegistrar *registrar,
+    AtcZoneManagerSlot *slots,
+    uint16_t num_slots);
+
+/** Evict all zones, and reset the counters. */
+void atc_zone_manager_clear(AtcZoneManager *manager);
+
+/**
+ * Return the AtcZoneProcessor bound to the zone with the given zone_id, evicting
+ * the least recently used zone if necessary. Returns NULL if the zone_id is
+ * not in the registry, or if the manager has no slots.
+ *
+ * The processor belongs to the zone until it is evicted by a later call, so it
+ * should not be kept across calls.
+ */
+AtcZoneProcessor *atc_zone_manager_get_processor(
+    AtcZoneManager *manager,
+    uint32_t zone_id);
+
+/**
+ * Set `tz` to the AtcTimeZone of the given zone_id, using a processor of the
+ * pool. Returns kAtcErrGeneric if the zone is not found. The `tz` has the same
+ * lifetime as the processor of atc_zone_manager_get_processor().
+ */
+int8_t atc_zone_manager_time_zone_for_id(
+    AtcZoneManager *manager,
+    uint32_t zone_id,
+    AtcTimeZone *tz);
+
+/**
+ * Same as atc_zone_manager_time_zone_for_id() using the name of the zone,
+ * e.g. "America/Los_Angeles".
+ */
+int8_t atc_zone_manager_time_zone_for_name(
+    AtcZoneManager *manager,
+    const char *name,
+    AtcTimeZone *tz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include <stdbool.h>
+#include "registry_sort.h"
+#include "zone_name_index.h"
+
+/** Fold the case, and map '_' to ' '. */
+static unsigned char normalize(char c)
+{
+  if (c == '_') return ' ';
+  if (c >= 'A' && c <= 'Z') return (unsigned char) (c - 'A' + 'a');
+  return (unsigned char) c;
+}
+
+int atc_zone_name_compare(const char *a, const char *b)
+{
+  while (1) {
+    unsigned char ca = normalize(*a++);
+    unsigned char cb = normalize(*b++);
+    if (ca != cb) return (int) ca - (int) cb;
+    if (ca == '\0') return 0;
+  }
+}
+
+/**
+ * Compare the name with the prefix, ignoring the characters of the name after
+ * the length of the prefix, so that 0 means that the name starts with it.
+ */
+static int compare_prefix(const char *name, const char *prefix)
+{
+  while (*prefix) {
+    unsigned char cn = normalize(*name++);
+    unsigned char cp = normalize(*prefix++);
+    if (cn != cp) return (int) cn - (int) cp;
+  }
+  return 0;
+}
+
+static const char *name_at(const AtcZoneNameIndex *index, uint16_t i)
+{
+  return index->registry[index->order[i]]->name;
+}
+
+static int compare_name(const AtcZoneInfo *a, const AtcZoneInfo *b)
+{
+  return atc_zone_name_compare(a->name, b->name);
+}
+
+int8_t atc_zone_name_index_init(
+    AtcZoneNameIndex *index,
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *order)
+{
+  atc_registry_sort_indexes(registry, size, order, compare_name);
+
+  index->registry = registry;
+  index->size = size;
+  index->order = order;
+  return kAtcErrOk;
+}
+
+/**
+ * Return the first position whose name is not less than the key, or whose
+ * prefix is greater than the key if `after` is true.
+ */
+static uint16_t lower_bound(
+    const AtcZoneNameIndex *index,
+    const char *key,
+    bool is_prefix,
+    bool after)
+{
+  uint16_t a = 0;
+  uint16_t b = index->size;
+  while (a < b) {
+    uint16_t c = a + (b - a) / 2;
+    const char *name = name_at(index, c);
+    int cmp = is_prefix
+        ? compare_prefix(name, key)
+        : atc_zone_name_compare(name, key);
+    if (cmp < 0 || (after && cmp == 0)) {
+      a = c + 1;
+    } else {
+      b = c;
+    }
+  }
+  return a;
+}
+
+const AtcZoneInfo *atc_zone_name_index_find(
+    const AtcZoneNameIndex *index,
+    const char *name)
+{
+  uint16_t i = lower_bound(index, name, false /*is_prefix*/, false /*after*/);
+  if (i == index->size) return NULL;
+  if (atc_zone_name_compare(name_at(index, i), name) != 0) return NULL;
+  return index->registry[index->order[i]];
+}
+
+uint16_t atc_zone_name_index_find_prefix(
+    const AtcZoneNameIndex *index,
+    const char *prefix,
+    uint16_t *start)
+{
+  uint16_t begin = lower_bound(index, prefix, true /*is_prefix*/, false);
+  uint16_t end = lower_bound(index, prefix, true /*is_prefix*/, true);
+  *start = begin;
+  return end - begin;
+}
+
+const AtcZoneInfo *atc_zone_name_index_at(
+    const AtcZoneNameIndex *index,
+    uint16_t i)
+{
+  return index->registry[index->order[i]];
+}
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file zone_name_index.h
+ *
+ * An index of the zone names of a registry, sorted without regard to case and
+ * with '_' and ' ' treated as the same character, so that "america/new york"
+ * finds "America/New_York". The index supports the exact match of a name, and
+ * the enumeration of all names which start with a prefix (e.g. for the
+ * autocompletion of a user interface), both with a binary search in
+ * O(log(N)) time, and without memory allocation.
+ *
+ * The index is a permutation of the registry, an array of `size` uint16_t
+ * provided by the caller.
+ */
+
+#ifndef ACE_TIME_C_ZONE_NAME_INDEX_H
+#define ACE_TIME_C_ZONE_NAME_INDEX_H
+
+#include <stdint.h>
+#include "../zoneinfo/zone_info.h"
+#include "common.h" // kAtcErrOk
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** An index of the zone names of a registry. */
+typedef struct AtcZoneNameIndex {
+  /** An array of pointers to AtcZoneInfo. */
+  const AtcZoneInfo * const *registry;
+
+  /** Size of the registry, and of the order. */
+  uint16_t size;
+
+  /** The indexes of the registry, sorted by name. */
+  const uint16_t *order;
+} AtcZoneNameIndex;
+
+/**
+ * Compare 2 zone names without regard to case, with '_' equal to ' '. Returns
+ * a negative value, 0, or a positive value, like strcmp().
+ */
+int atc_zone_name_compare(const char *a, const char *b);
+
+/**
+ * Build the index of the names of the registry into the `order` array of
+ * `size` elements, which must remain valid while the index is used. The
+ * registry does not need to be sorted. Returns kAtcErrOk.
+ */
+int8_t atc_zone_name_index_init(
+    AtcZoneNameIndex *index,
+    const AtcZoneInfo * const *registry,
+    uint16_t size,
+    uint16_t *order);
+
+/**
+ * Return the zone of the given name, compared with atc_zone_name_compare(),
+ * or NULL if not found.
+ */
+const AtcZoneInfo *atc_zone_name_index_find(
+    const AtcZoneNameIndex *index,
+    const char *name);
+
+/**
+ * Find the zones whose names start with `prefix`, compared like
+ * atc_zone_name_compare(). Returns the number of matches, which are the zones
+ * at positions [*start, *start + count) of atc_zone_name_index_at(), sorted by
+ * name. An empty prefix matches every zone.
+ */
+uint16_t atc_zone_name_index_find_prefix(
+    const AtcZoneNameIndex *index,
+    const char *prefix,
+    uint16_t *start);
+
+/** Return the zone at position i (< size) of the order sorted by name. */
+const AtcZoneInfo *atc_zone_name_index_at(
+    const AtcZoneNameIndex *index,
+    uint16_t i);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
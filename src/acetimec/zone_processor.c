@@ -4,13 +4,14 @@
  */
 
 #include <stdbool.h>
-#include <string.h> // memcpy(), strncpy()
+#include <string.h> // memcpy(), strcmp(), strncpy()
 #include "../zoneinfo/zone_info_utils.h"
 #include "common.h" // atc_copy_replace_string()
-#include "epoch.h" // atc_get_current_epoch_year()
+#include "epoch.h" // atc_epoch_get_year()
 #include "plain_date.h" // atc_plain_date_days_in_year_month()
 #include "date_tuple.h" // AtcDateTuple
 #include "transition.h" // AtcTransition, AtcTransitionStorage
+#include "policy_cache.h" // atc_policy_cache_get_transition_time()
 #include "zone_processor.h"
 
 //---------------------------------------------------------------------------
@@ -235,22 +236,34 @@ void atc_processor_get_transition_time(
   dt->suffix = atc_zone_rule_at_suffix(rule);
 }
 
-void atc_processor_create_transition_for_year(
+/** Set the fields of the Transition other than its transition_time. */
+static void atc_processor_set_transition_rule(
     AtcTransition *t,
-    int16_t year,
-    const AtcZoneRule *rule /*nullable*/,
+    const AtcZoneRule *rule,
     const AtcMatchingEra *match,
-    const char * const *letters /*nullable*/)
+    const char * const *letters)
 {
   t->match = match;
   t->rule = rule;
   t->offset_seconds = atc_zone_era_std_offset_seconds(match->era);
+  t->delta_seconds = atc_zone_rule_dst_offset_seconds(rule);
+  t->letter = letters[rule->letter_index];
+}
 
+void atc_processor_create_transition_for_year(
+    AtcTransition *t,
+    int16_t year,
+    const AtcZoneRule *rule /*nullable*/,
+    const AtcMatchingEra *match,
+    const char * const *letters /*nullable*/)
+{
   if (rule) {
     atc_processor_get_transition_time(year, rule, &t->transition_time);
-    t->delta_seconds = atc_zone_rule_dst_offset_seconds(rule);
-    t->letter = letters[rule->letter_index];
+    atc_processor_set_transition_rule(t, rule, match, letters);
   } else {
+    t->match = match;
+    t->rule = rule;
+    t->offset_seconds = atc_zone_era_std_offset_seconds(match->era);
     // Create a Transition using the MatchingEra for the transitionTime.
     // Used for simple MatchingEra.
     t->transition_time = match->start_dt;
@@ -259,11 +272,31 @@ void atc_processor_create_transition_for_year(
   }
 }
 
+/**
+ * Same as atc_transition_storage_get_free_agent(), but also counts the free
+ * agent in the AtcProcessorStats of the storage.
+ */
+static AtcTransition *atc_processor_get_free_agent(AtcTransitionStorage *ts)
+{
+#if ACE_TIME_C_PROCESSOR_STATS
+  AtcProcessorStats *stats = ts->stats;
+  if (stats) {
+    stats->num_transitions++;
+    if (ts->index_free >= kAtcTransitionStorageSize) {
+      stats->num_storage_overflows++;
+    } else if (ts->index_free < ts->alloc_size) {
+      stats->num_free_agent_reuses++;
+    }
+  }
+#endif
+  return atc_transition_storage_get_free_agent(ts);
+}
+
 void atc_processor_create_transitions_from_simple_match(
     AtcTransitionStorage *ts,
     AtcMatchingEra *match)
 {
-  AtcTransition *free_agent = atc_transition_storage_get_free_agent(ts);
+  AtcTransition *free_agent = atc_processor_get_free_agent(ts);
   atc_processor_create_transition_for_year(
       free_agent, 0 /*year*/, NULL /*rule*/, match, NULL /*letters*/);
   free_agent->match_status = kAtcCompareExactMatch;
@@ -276,6 +309,28 @@ void atc_processor_create_transitions_from_simple_match(
 // Step 2B: Pass 1
 //---------------------------------------------------------------------------
 
+/**
+ * Same as atc_processor_create_transition_for_year() for a rule, but reads the
+ * transition time from the AtcPolicyCache of the TransitionStorage if it has
+ * one.
+ */
+static void atc_processor_create_transition_for_rule(
+    AtcTransitionStorage *ts,
+    AtcTransition *t,
+    int16_t year,
+    const AtcZoneRule *rule,
+    const AtcMatchingEra *match,
+    const char * const *letters)
+{
+  if (ts->policy_cache == NULL
+      || ! atc_policy_cache_get_transition_time(
+          ts->policy_cache, match->era->zone_policy, rule, year,
+          &t->transition_time)) {
+    atc_processor_get_transition_time(year, rule, &t->transition_time);
+  }
+  atc_processor_set_transition_rule(t, rule, match, letters);
+}
+
 uint8_t atc_processor_calc_interior_years(
     int16_t* interior_years,
     uint8_t max_interior_years,
@@ -324,6 +379,25 @@ void atc_processor_find_candidate_transitions(
   AtcTransition **prior = atc_transition_storage_reserve_prior(ts);
   (*prior)->is_valid_prior = false;
   const char* const* letters = ts->zone_info->zone_context->letters;
+
+  // The most recent transition of the rules before start_year depends only on
+  // the policy, so it is read from the policy cache if available, instead of
+  // calculating the prior transition of every rule.
+  bool has_cached_prior = false;
+  const AtcZoneRule *cached_prior_rule = NULL;
+  AtcDateTuple cached_prior_time;
+  if (ts->policy_cache) {
+    const AtcPolicyCacheEntry *entry = atc_policy_cache_get(
+        ts->policy_cache, policy, start_year);
+    if (entry) {
+      has_cached_prior = true;
+      if (entry->prior_rule_index != kAtcPolicyCacheNoRule) {
+        cached_prior_rule = &policy->rules[entry->prior_rule_index];
+        cached_prior_time = entry->prior_time;
+      }
+    }
+  }
+
   for (uint8_t r = 0; r < num_rules; r++) {
     const AtcZoneRule *rule = &policy->rules[r];
 
@@ -338,8 +412,9 @@ void atc_processor_find_candidate_transitions(
         end_year);
     for (uint8_t y = 0; y < num_years; y++) {
       int16_t year = interior_years[y];
-      AtcTransition *t = atc_transition_storage_get_free_agent(ts);
-      atc_processor_create_transition_for_year(t, year, rule, match, letters);
+      AtcTransition *t = atc_processor_get_free_agent(ts);
+      atc_processor_create_transition_for_rule(
+          ts, t, year, rule, match, letters);
       uint8_t status = atc_transition_compare_to_match_fuzzy(t, match);
       if (status == kAtcComparePrior) {
         atc_transition_storage_set_free_agent_as_prior_if_valid(ts);
@@ -352,17 +427,25 @@ void atc_processor_find_candidate_transitions(
     }
 
     // Add Transition for prior year
+    if (has_cached_prior) continue;
     int16_t prior_year = atc_processor_get_most_recent_prior_year(
         rule->from_year, rule->to_year,
         start_year, end_year);
     if (prior_year != kAtcInvalidYear) {
-      AtcTransition *t = atc_transition_storage_get_free_agent(ts);
+      AtcTransition *t = atc_processor_get_free_agent(ts);
       atc_processor_create_transition_for_year(
           t, prior_year, rule, match, letters);
       atc_transition_storage_set_free_agent_as_prior_if_valid(ts);
     }
   }
 
+  if (cached_prior_rule) {
+    AtcTransition *t = atc_processor_get_free_agent(ts);
+    t->transition_time = cached_prior_time;
+    atc_processor_set_transition_rule(t, cached_prior_rule, match, letters);
+    atc_transition_storage_set_free_agent_as_prior_if_valid(ts);
+  }
+
   // Add the reserved prior into the Candidate pool only if 'isValidPrior' is
   // true.
   if ((*prior)->is_valid_prior) {
@@ -483,7 +566,8 @@ void atc_processor_create_transitions(
 //---------------------------------------------------------------------------
 void atc_processor_generate_start_until_times(
     AtcTransition **begin,
-    AtcTransition **end)
+    AtcTransition **end,
+    const AtcEpoch *epoch)
 {
   AtcTransition *prev = *begin;
   bool is_after_first = false;
@@ -523,9 +607,15 @@ void atc_processor_generate_start_until_times(
     const AtcDateTuple *st = &t->start_dt;
     const atc_time_t offset_seconds = (atc_time_t)
         (st->seconds - (t->offset_seconds + t->delta_seconds));
-    atc_time_t epoch_seconds = (atc_time_t) 86400
-        * atc_plain_date_to_epoch_days(st->year, st->month, st->day);
-    t->start_epoch_seconds = epoch_seconds + offset_seconds;
+    int32_t unix_days =
+        atc_plain_date_to_unix_days(st->year, st->month, st->day);
+    if (unix_days == kAtcInvalidUnixDays) {
+      t->start_unix_seconds = kAtcInvalidUnixSeconds;
+    } else {
+      t->start_unix_seconds = (int64_t) 86400 * unix_days + offset_seconds;
+    }
+    t->start_epoch_seconds =
+        atc_epoch_from_unix_seconds(epoch, t->start_unix_seconds);
 
     prev = t;
     is_after_first = true;
@@ -638,9 +728,17 @@ void atc_processor_calc_abbreviations(
 void atc_processor_init(AtcZoneProcessor *processor)
 {
   processor->zone_info = NULL;
+  processor->epoch = NULL;
   processor->epoch_year = kAtcInvalidYear;
   processor->year = kAtcInvalidYear;
   processor->num_matches = 0;
+  processor->steady_state.start_year = kAtcInvalidYear;
+  processor->policy_cache = NULL;
+#if ACE_TIME_C_PROCESSOR_STATS
+  processor->step_callback = NULL;
+  processor->step_context = NULL;
+  atc_processor_reset_stats(processor);
+#endif
 }
 
 void atc_processor_init_for_zone_info(
@@ -648,16 +746,118 @@ void atc_processor_init_for_zone_info(
   const AtcZoneInfo *zone_info)
 {
   if (processor->zone_info == zone_info) return;
+  const AtcEpoch *epoch = processor->epoch;
+  AtcPolicyCache *policy_cache = processor->policy_cache;
+#if ACE_TIME_C_PROCESSOR_STATS
+  AtcProcessorStats stats = processor->stats;
+  AtcProcessorStepCallback step_callback = processor->step_callback;
+  void *step_context = processor->step_context;
+#endif
   atc_processor_init(processor);
   processor->zone_info = zone_info;
+  processor->epoch = epoch;
+  processor->policy_cache = policy_cache;
+#if ACE_TIME_C_PROCESSOR_STATS
+  processor->stats = stats;
+  processor->step_callback = step_callback;
+  processor->step_context = step_context;
+#endif
+  atc_steady_state_init(&processor->steady_state, zone_info);
+}
+
+void atc_processor_set_epoch(
+  AtcZoneProcessor *processor,
+  const AtcEpoch *epoch)
+{
+  processor->epoch = epoch;
+  processor->year = kAtcInvalidYear;
 }
 
-static bool atc_processor_is_valid_for_year(
+void atc_processor_set_policy_cache(
   AtcZoneProcessor *processor,
+  AtcPolicyCache *policy_cache)
+{
+  processor->policy_cache = policy_cache;
+}
+
+void atc_processor_disable_steady_state(AtcZoneProcessor *processor)
+{
+  processor->steady_state.start_year = kAtcInvalidYear;
+}
+
+void atc_processor_set_step_callback(
+  AtcZoneProcessor *processor,
+  AtcProcessorStepCallback callback,
+  void *context)
+{
+#if ACE_TIME_C_PROCESSOR_STATS
+  processor->step_callback = callback;
+  processor->step_context = context;
+#else
+  (void) processor;
+  (void) callback;
+  (void) context;
+#endif
+}
+
+/** Set all the counters to 0. */
+static void atc_processor_clear_stats(AtcProcessorStats *stats)
+{
+  stats->num_year_hits = 0;
+  stats->num_year_misses = 0;
+  stats->num_matches = 0;
+  stats->num_transitions = 0;
+  stats->num_free_agent_reuses = 0;
+  stats->num_active_transitions = 0;
+  stats->num_storage_overflows = 0;
+  stats->max_transitions = 0;
+  stats->max_matches = 0;
+}
+
+void atc_processor_get_stats(
+  const AtcZoneProcessor *processor,
+  AtcProcessorStats *stats)
+{
+#if ACE_TIME_C_PROCESSOR_STATS
+  *stats = processor->stats;
+#else
+  (void) processor;
+  atc_processor_clear_stats(stats);
+#endif
+}
+
+void atc_processor_reset_stats(AtcZoneProcessor *processor)
+{
+#if ACE_TIME_C_PROCESSOR_STATS
+  atc_processor_clear_stats(&processor->stats);
+#else
+  (void) processor;
+#endif
+}
+
+/** Call the step callback of the processor, if stats are enabled. */
+static void atc_processor_notify_step(
+  const AtcZoneProcessor *processor,
+  uint8_t step,
+  bool is_end)
+{
+#if ACE_TIME_C_PROCESSOR_STATS
+  if (processor->step_callback) {
+    processor->step_callback(processor->step_context, step, is_end);
+  }
+#else
+  (void) processor;
+  (void) step;
+  (void) is_end;
+#endif
+}
+
+bool atc_processor_is_valid_for_year(
+  const AtcZoneProcessor *processor,
   int16_t year)
 {
   return (year == processor->year)
-      && (processor->epoch_year == atc_get_current_epoch_year());
+      && (processor->epoch_year == atc_epoch_get_year(processor->epoch));
 }
 
 int8_t atc_processor_init_for_year(
@@ -670,43 +870,86 @@ int8_t atc_processor_init_for_year(
     return kAtcErrGeneric;
   }
 
-  if (atc_processor_is_valid_for_year(processor, year)) return kAtcErrOk;
+  if (atc_processor_is_valid_for_year(processor, year)) {
+#if ACE_TIME_C_PROCESSOR_STATS
+    processor->stats.num_year_hits++;
+#endif
+    return kAtcErrOk;
+  }
 
-  processor->epoch_year = atc_get_current_epoch_year();
+  processor->epoch_year = atc_epoch_get_year(processor->epoch);
   processor->year = year;
   processor->num_matches = 0;
   atc_transition_storage_init(
     &processor->transition_storage, processor->zone_info);
+  processor->transition_storage.policy_cache = processor->policy_cache;
+#if ACE_TIME_C_PROCESSOR_STATS
+  processor->transition_storage.stats = &processor->stats;
+  processor->stats.num_year_misses++;
+#endif
 
   // Fill transitions over a 14-month window straddling the given year.
   AtcYearMonth start_ym = { year - 1, 12 };
   AtcYearMonth until_ym = { year + 1, 2 };
 
   // Step 1: Find matches.
+  atc_processor_notify_step(processor, kAtcProcessorStepFindMatches, false);
   uint8_t num_matches = atc_processor_find_matches(
     processor->zone_info,
     start_ym,
     until_ym,
     processor->matches,
     kAtcMaxMatches);
+  atc_processor_notify_step(processor, kAtcProcessorStepFindMatches, true);
 
   // Step 2: Create Transitions.
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepCreateTransitions, false);
   atc_processor_create_transitions(
     &processor->transition_storage,
     processor->matches,
     num_matches);
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepCreateTransitions, true);
 
-  // Step 3: Fix transition times of active transitions.
   AtcTransitionStorage *ts = &processor->transition_storage;
+#if ACE_TIME_C_PROCESSOR_STATS
+  AtcProcessorStats *stats = &processor->stats;
+  stats->num_matches += num_matches;
+  stats->num_active_transitions += ts->index_prior;
+  if (ts->alloc_size > stats->max_transitions) {
+    stats->max_transitions = ts->alloc_size;
+  }
+  if (num_matches > stats->max_matches) {
+    stats->max_matches = num_matches;
+  }
+#endif
+
+  // Step 3: Fix transition times of active transitions.
   AtcTransition **begin = &ts->transitions[0];
   AtcTransition **end = &ts->transitions[ts->index_prior];
+  atc_processor_notify_step(processor, kAtcProcessorStepFixTimes, false);
   atc_transition_fix_times(begin, end);
+  atc_processor_notify_step(processor, kAtcProcessorStepFixTimes, true);
 
   // Step 4: Generate start and until times.
-  atc_processor_generate_start_until_times(begin, end);
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepGenerateStartUntilTimes, false);
+  atc_processor_generate_start_until_times(begin, end, processor->epoch);
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepGenerateStartUntilTimes, true);
 
   // Step 5: Calc abbreviations.
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepCalcAbbreviations, false);
   atc_processor_calc_abbreviations(begin, end);
+  atc_processor_notify_step(
+    processor, kAtcProcessorStepCalcAbbreviations, true);
+
+#if ACE_TIME_C_TRANSITION_KEYS
+  // Copy the search keys of the active transitions.
+  atc_transition_keys_init(&processor->transition_keys, ts);
+#endif
 
   return kAtcErrOk;
 }
@@ -714,9 +957,17 @@ int8_t atc_processor_init_for_year(
 int8_t atc_processor_init_for_epoch_seconds(
   AtcZoneProcessor *processor,
   atc_time_t epoch_seconds)
+{
+  return atc_processor_init_for_unix_seconds(
+      processor, atc_epoch_to_unix_seconds(processor->epoch, epoch_seconds));
+}
+
+int8_t atc_processor_init_for_unix_seconds(
+  AtcZoneProcessor *processor,
+  int64_t unix_seconds)
 {
   AtcPlainDateTime pdt;
-  atc_plain_date_time_from_epoch_seconds(&pdt, epoch_seconds);
+  atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds);
   if (atc_plain_date_time_is_error(&pdt)) return kAtcErrGeneric;
   return atc_processor_init_for_year(processor, pdt.year);
 }
@@ -731,14 +982,124 @@ void atc_processor_find_by_epoch_seconds(
     atc_time_t epoch_seconds,
     AtcFindResult *result)
 {
-  int8_t err = atc_processor_init_for_epoch_seconds(processor, epoch_seconds);
+  atc_processor_find_by_unix_seconds(
+      processor,
+      atc_epoch_to_unix_seconds(processor->epoch, epoch_seconds),
+      result);
+}
+
+void atc_processor_find_by_unix_seconds(
+    AtcZoneProcessor *processor,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+  // Years in the steady state are calculated without the transitions.
+  atc_steady_state_find_by_unix_seconds(
+      &processor->steady_state, unix_seconds, result);
+  if (result->type != kAtcFindResultNotFound) return;
+
+  int8_t err = atc_processor_init_for_unix_seconds(processor, unix_seconds);
   if (err) {
     result->type = kAtcFindResultNotFound;
     return;
   }
+  atc_processor_search_by_unix_seconds(processor, unix_seconds, result);
+}
+
+void atc_processor_search_by_epoch_seconds(
+    const AtcZoneProcessor *processor,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result)
+{
+  atc_processor_search_by_unix_seconds(
+      processor,
+      atc_epoch_to_unix_seconds(processor->epoch, epoch_seconds),
+      result);
+}
+
+/** Return true if the transitions have the same offsets and abbreviation. */
+static bool atc_processor_is_same_state(
+    const AtcTransition *a,
+    const AtcTransition *b)
+{
+  return a->offset_seconds == b->offset_seconds
+      && a->delta_seconds == b->delta_seconds
+      && strcmp(a->abbrev, b->abbrev) == 0;
+}
+
+/**
+ * Set the validity interval of `result` to the span of the transition `t` and
+ * of its neighbors in the transition storage with the same offsets and
+ * abbreviation. The until time of the last transition is the end of the
+ * window of the current year, or the until time of its ZoneEra.
+ */
+static void atc_processor_set_valid_interval(
+    const AtcZoneProcessor *processor,
+    const AtcTransition *t,
+    AtcFindResult *result)
+{
+  const AtcTransitionStorage *ts = &processor->transition_storage;
+  uint8_t n = ts->index_free;
+  uint8_t first = 0;
+  while (first < n && ts->transitions[first] != t) first++;
+  uint8_t last = first;
+  while (first > 0
+      && atc_processor_is_same_state(ts->transitions[first - 1], t)) {
+    first--;
+  }
+  while (last + 1 < n
+      && atc_processor_is_same_state(ts->transitions[last + 1], t)) {
+    last++;
+  }
+
+  // The first transition starts at the start of the window of the year,
+  // converted with a guessed UTC offset, so it may be an hour or so too early.
+  // Clamp it to the last day of the previous year, which is after the start of
+  // the window, and before the start of the year, in any UTC offset.
+  result->valid_from_unix_seconds = ts->transitions[first]->start_unix_seconds;
+  if (first == 0) {
+    int64_t last_day = (int64_t) 86400
+        * (atc_plain_date_to_unix_days(processor->year, 1, 1) - 1);
+    if (result->valid_from_unix_seconds < last_day) {
+      result->valid_from_unix_seconds = last_day;
+    }
+  }
+  if (last + 1 < n) {
+    result->valid_until_unix_seconds =
+        ts->transitions[last + 1]->start_unix_seconds;
+    return;
+  }
+
+  // The until_dt is expressed in the UTC offset of the last transition. The
+  // window of the year 9999 ends after the year kAtcMaxYear, which is not a
+  // valid date, so clamp it to the start of that year.
+  const AtcTransition *u = ts->transitions[last];
+  const AtcDateTuple *until = &u->until_dt;
+  int32_t unix_days =
+      atc_plain_date_to_unix_days(until->year, until->month, until->day);
+  if (unix_days == kAtcInvalidUnixDays) {
+    result->valid_until_unix_seconds = (int64_t) 86400
+        * (atc_plain_date_to_unix_days(kAtcMaxYear - 1, 12, 31) + 1);
+  } else {
+    result->valid_until_unix_seconds = (int64_t) 86400 * unix_days
+        + until->seconds - (u->offset_seconds + u->delta_seconds);
+  }
+}
 
-  AtcTransitionForSeconds tfs = atc_transition_storage_find_for_seconds(
-      &processor->transition_storage, epoch_seconds);
+void atc_processor_search_by_unix_seconds(
+    const AtcZoneProcessor *processor,
+    int64_t unix_seconds,
+    AtcFindResult *result)
+{
+#if ACE_TIME_C_TRANSITION_KEYS
+  AtcTransitionForSeconds tfs = atc_transition_keys_find_for_unix_seconds(
+      &processor->transition_keys,
+      &processor->transition_storage,
+      unix_seconds);
+#else
+  AtcTransitionForSeconds tfs = atc_transition_storage_find_for_unix_seconds(
+      &processor->transition_storage, unix_seconds);
+#endif
   const AtcTransition *t = tfs.curr;
   if (! t) {
     result->type = kAtcFindResultNotFound;
@@ -750,6 +1111,7 @@ void atc_processor_find_by_epoch_seconds(
   result->req_std_offset_seconds = t->offset_seconds;
   result->req_dst_offset_seconds = t->delta_seconds;
   result->abbrev = t->abbrev;
+  atc_processor_set_valid_interval(processor, t, result);
   result->fold = tfs.fold;
   if (tfs.num == 2) {
     result->type = kAtcFindResultOverlap;
@@ -766,15 +1128,32 @@ void atc_processor_find_by_plain_date_time(
     uint8_t disambiguate,
     AtcFindResult *result)
 {
+  // Years in the steady state are calculated without the transitions.
+  atc_steady_state_find_by_plain_date_time(
+      &processor->steady_state, pdt, disambiguate, result);
+  if (result->type != kAtcFindResultNotFound) return;
 
   int8_t err = atc_processor_init_for_year(processor, pdt->year);
   if (err) {
     result->type = kAtcFindResultNotFound;
     return;
   }
+  atc_processor_search_by_plain_date_time(processor, pdt, disambiguate, result);
+}
 
+void atc_processor_search_by_plain_date_time(
+    const AtcZoneProcessor *processor,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result)
+{
+#if ACE_TIME_C_TRANSITION_KEYS
+  AtcTransitionForDateTime tfd = atc_transition_keys_find_for_date_time(
+      &processor->transition_keys, &processor->transition_storage, pdt);
+#else
   AtcTransitionForDateTime tfd = atc_transition_storage_find_for_date_time(
       &processor->transition_storage, pdt);
+#endif
 
     // Extract the target Transition, depending on the requested fold
     // and the tfd.num.
@@ -838,4 +1217,5 @@ void atc_processor_find_by_plain_date_time(
     result->std_offset_seconds = transition->offset_seconds;
     result->dst_offset_seconds = transition->delta_seconds;
     result->abbrev = transition->abbrev;
+    atc_processor_set_valid_interval(processor, transition, result);
 }
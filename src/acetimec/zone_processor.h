@@ -18,9 +18,11 @@
 #include <stdbool.h>
 #include "common.h" // atc_time_t
 #include "../zoneinfo/zone_info.h"
+#include "epoch.h" // AtcEpoch
 #include "plain_date_time.h" // AtcPlainDateTime
 #include "date_tuple.h" // AtcDateTuple
 #include "transition.h" // AtcTransition, AtcTransitionStorage
+#include "steady_state.h" // AtcSteadyState
 
 #ifdef __cplusplus
 extern "C" {
@@ -103,6 +105,63 @@ uint8_t atc_processor_calc_interior_years(
 // matching Transitions at a gien epoch_seconds or PlainDatetime.
 //---------------------------------------------------------------------------
 
+/**
+ * Counters of the work done by an AtcZoneProcessor, accumulated across calls
+ * and zones until atc_processor_reset_stats(). Updated only if
+ * ACE_TIME_C_PROCESSOR_STATS is enabled, otherwise always 0.
+ */
+typedef struct AtcProcessorStats {
+  /** Calls to atc_processor_init_for_year() which reused the cached year. */
+  uint32_t num_year_hits;
+
+  /** Calls to atc_processor_init_for_year() which regenerated the cache. */
+  uint32_t num_year_misses;
+
+  /** Number of AtcMatchingEra found in Step 1. */
+  uint32_t num_matches;
+
+  /** Number of transitions calculated into the free agent in Step 2. */
+  uint32_t num_transitions;
+
+  /**
+   * Number of free agents which reused an AtcTransition discarded earlier in
+   * the same year, instead of a new one from the pool.
+   */
+  uint32_t num_free_agent_reuses;
+
+  /** Number of active transitions at the end of Step 2. */
+  uint32_t num_active_transitions;
+
+  /**
+   * Number of free agents requested when the pool was full. Any non-zero
+   * value means that kAtcTransitionStorageSize is too small.
+   */
+  uint32_t num_storage_overflows;
+
+  /** Most AtcTransition used in a single year, up to kAtcTransitionStorageSize. */
+  uint8_t max_transitions;
+
+  /** Most AtcMatchingEra in a single year, up to kAtcMaxMatches. */
+  uint8_t max_matches;
+} AtcProcessorStats;
+
+/** Steps of atc_processor_init_for_year(), passed to AtcProcessorStepCallback. */
+enum {
+  kAtcProcessorStepFindMatches = 1,
+  kAtcProcessorStepCreateTransitions = 2,
+  kAtcProcessorStepFixTimes = 3,
+  kAtcProcessorStepGenerateStartUntilTimes = 4,
+  kAtcProcessorStepCalcAbbreviations = 5,
+};
+
+/**
+ * Called before (`is_end` false) and after (`is_end` true) each step of
+ * atc_processor_init_for_year() if ACE_TIME_C_PROCESSOR_STATS is enabled, so
+ * that the application can time the steps with its own clock.
+ */
+typedef void (*AtcProcessorStepCallback)(
+    void *context, uint8_t step, bool is_end);
+
 /**
  * Zone processor work space. One of these should be created for each active
  * timezone. It can be reused among multiple timezones but a change of timezone
@@ -112,6 +171,12 @@ typedef struct AtcZoneProcessor {
   /** The time zone attached to this Processor workspace. */
   const AtcZoneInfo *zone_info;
 
+  /**
+   * The epoch used to interpret epoch seconds, or NULL to use the current
+   * epoch year of the library. Set by atc_processor_set_epoch().
+   */
+  const AtcEpoch *epoch;
+
   /**
    * Epoch year used to generate the internal cache. The
    * atc_processor_init_for_year() function invalidates and regenerates the
@@ -130,6 +195,31 @@ typedef struct AtcZoneProcessor {
 
   /** Pool of transitions relevant for the current zone and year */
   AtcTransitionStorage transition_storage;
+
+#if ACE_TIME_C_TRANSITION_KEYS
+  /** Search keys of the active transitions in transition_storage. */
+  AtcTransitionKeys transition_keys;
+#endif
+
+  /** Steady-state rules of the zone, used instead of transition_storage. */
+  AtcSteadyState steady_state;
+
+  /**
+   * Cache of the transition times of the ZonePolicy rules, shared with other
+   * processors, or NULL. Set by atc_processor_set_policy_cache().
+   */
+  AtcPolicyCache *policy_cache;
+
+#if ACE_TIME_C_PROCESSOR_STATS
+  /** Counters of the work done. */
+  AtcProcessorStats stats;
+
+  /** Step callback, or NULL. Set by atc_processor_set_step_callback(). */
+  AtcProcessorStepCallback step_callback;
+
+  /** Context passed to step_callback. */
+  void *step_context;
+#endif
 } AtcZoneProcessor;
 
 /** Values of the the AtcFindResult.type field. */
@@ -179,6 +269,24 @@ typedef struct AtcFindResult {
    * copied by the calling code as soon as possible.
    */
   const char *abbrev;
+
+  /**
+   * Start of the interval [valid_from, valid_until) of Unix seconds in which
+   * std_offset_seconds, dst_offset_seconds and abbrev do not change, so the
+   * caller can reuse them for any instant in the interval. The interval
+   * contains the instant of the lookup (after normalization, for a gap). It
+   * may be narrower than the actual interval, because it is limited to the
+   * transitions known to the processor for the current year. The type and
+   * fold may still differ within the interval, near an overlap. Set to
+   * INT64_MIN for a time zone with a fixed offset.
+   */
+  int64_t valid_from_unix_seconds;
+
+  /**
+   * End (exclusive) of the validity interval, see valid_from_unix_seconds.
+   * Set to INT64_MAX for a time zone with a fixed offset.
+   */
+  int64_t valid_until_unix_seconds;
 } AtcFindResult;
 
 //---------------------------------------------------------------------------
@@ -210,6 +318,57 @@ typedef struct AtcFindResult {
  */
 void atc_processor_init(AtcZoneProcessor *processor);
 
+/**
+ * Bind the AtcZoneProcessor to an explicit epoch, instead of the current epoch
+ * year of the library (if `epoch` is NULL). The AtcEpoch must outlive the
+ * processor, and must not be modified while bound. The binding survives
+ * atc_processor_init_for_zone_info(), but not atc_processor_init().
+ */
+void atc_processor_set_epoch(
+  AtcZoneProcessor *processor,
+  const AtcEpoch *epoch);
+
+/**
+ * Attach an AtcPolicyCache which is shared with other processors, or detach it
+ * if `policy_cache` is NULL. The cache must outlive the processor. Processors
+ * sharing a cache must be used by the same thread. The binding survives
+ * atc_processor_init_for_zone_info(), but not atc_processor_init().
+ */
+void atc_processor_set_policy_cache(
+  AtcZoneProcessor *processor,
+  AtcPolicyCache *policy_cache);
+
+/**
+ * Disable the AtcSteadyState of the zone, so that every lookup searches the
+ * transitions of the year, e.g. to measure or verify the steady state against
+ * the transitions. The steady state is compiled again by the next
+ * atc_processor_init_for_zone_info() with a different zone.
+ */
+void atc_processor_disable_steady_state(AtcZoneProcessor *processor);
+
+/**
+ * Set the callback which is called around each step of
+ * atc_processor_init_for_year(), or remove it if `callback` is NULL. Has no
+ * effect unless ACE_TIME_C_PROCESSOR_STATS is enabled. The callback survives
+ * atc_processor_init_for_zone_info(), but not atc_processor_init().
+ */
+void atc_processor_set_step_callback(
+  AtcZoneProcessor *processor,
+  AtcProcessorStepCallback callback,
+  void *context);
+
+/**
+ * Copy the counters of the processor into `stats`. The counters survive
+ * atc_processor_init_for_zone_info(), so they cover all the zones used by the
+ * processor. Always 0 unless ACE_TIME_C_PROCESSOR_STATS is enabled.
+ */
+void atc_processor_get_stats(
+  const AtcZoneProcessor *processor,
+  AtcProcessorStats *stats);
+
+/** Reset the counters of the processor to 0. */
+void atc_processor_reset_stats(AtcZoneProcessor *processor);
+
 /**
  * Initialize AtcZoneProcessor for the given zone_info. This allows an
  * AtcZoneProcessor to be re-used with different zone info.
@@ -239,6 +398,15 @@ int8_t atc_processor_init_for_year(
   AtcZoneProcessor *processor,
   int16_t year);
 
+/**
+ * Return true if the transitions of the given year are already cached by the
+ * processor, using the current epoch year. In other words, a call to
+ * atc_processor_init_for_year() would be a no-op.
+ */
+bool atc_processor_is_valid_for_year(
+  const AtcZoneProcessor *processor,
+  int16_t year);
+
 /**
  * Initialize AtcZoneProcessor for the given epoch seconds. This calls
  * `atc_processor_init_for_year()` using the UTC year corresponding to the given
@@ -253,6 +421,14 @@ int8_t atc_processor_init_for_epoch_seconds(
   AtcZoneProcessor *processor,
   atc_time_t epoch_seconds);
 
+/**
+ * Same as atc_processor_init_for_epoch_seconds() using 64-bit unix seconds,
+ * which covers the years [1,9999] without depending on the epoch.
+ */
+int8_t atc_processor_init_for_unix_seconds(
+  AtcZoneProcessor *processor,
+  int64_t unix_seconds);
+
 /**
  * Find the AtcFindResult at the given epoch_seconds, with the result status in
  * `result.type`.
@@ -262,6 +438,15 @@ void atc_processor_find_by_epoch_seconds(
     atc_time_t epoch_seconds,
     AtcFindResult *result);
 
+/**
+ * Find the AtcFindResult at the given 64-bit unix_seconds. The epoch of the
+ * processor is not used, so any year in [1,9999] can be found.
+ */
+void atc_processor_find_by_unix_seconds(
+    AtcZoneProcessor *processor,
+    int64_t unix_seconds,
+    AtcFindResult *result);
+
 /**
  * Find the AtcFindResult at the given PlainDateTime and fold. The fold
  * parameter is used only when PlainDateTime falls in a gap or an overlap.
@@ -273,6 +458,36 @@ void atc_processor_find_by_plain_date_time(
     uint8_t disambiguate,
     AtcFindResult *result);
 
+/**
+ * Same as atc_processor_find_by_epoch_seconds() but searches only the
+ * transitions which were already generated by atc_processor_init_for_year()
+ * for the UTC year of epoch_seconds. The processor is not modified, so
+ * multiple threads may search the same processor concurrently.
+ */
+void atc_processor_search_by_epoch_seconds(
+    const AtcZoneProcessor *processor,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result);
+
+/**
+ * Same as atc_processor_search_by_epoch_seconds() using 64-bit unix seconds.
+ */
+void atc_processor_search_by_unix_seconds(
+    const AtcZoneProcessor *processor,
+    int64_t unix_seconds,
+    AtcFindResult *result);
+
+/**
+ * Same as atc_processor_find_by_plain_date_time() but searches only the
+ * transitions which were already generated by atc_processor_init_for_year()
+ * for `pdt.year`. The processor is not modified.
+ */
+void atc_processor_search_by_plain_date_time(
+    const AtcZoneProcessor *processor,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result);
+
 //---------------------------------------------------------------------------
 // Functions and data structures related to the creation of the active
 // Transitions of the given time zone at the given year.
@@ -371,10 +586,15 @@ void atc_processor_create_transitions_from_named_match(
     AtcTransitionStorage *ts,
     AtcMatchingEra *match);
 
-/** Update the start and until times of the specified transitions. */
+/**
+ * Update the start and until times of the specified transitions. The
+ * start_epoch_seconds are relative to the given epoch (NULL for the current
+ * epoch year).
+ */
 void atc_processor_generate_start_until_times(
     AtcTransition **begin,
-    AtcTransition **end);
+    AtcTransition **end,
+    const AtcEpoch *epoch);
 
 /** Compute the time zone abbreviation of the specified transitions. */
 void atc_processor_calc_abbreviations(
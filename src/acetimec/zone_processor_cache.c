@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+#include "common.h"
+#include "plain_date_time.h" // atc_plain_date_time_from_epoch_seconds()
+#include "zone_processor.h"
+#include "zone_processor_cache.h"
+
+void atc_processor_cache_init(AtcZoneProcessorCache *cache)
+{
+  cache->zone_info = NULL;
+  cache->clock = 0;
+  for (uint8_t i = 0; i < kAtcProcessorCacheSize; i++) {
+    cache->last_used[i] = 0;
+    atc_processor_init(&cache->processors[i]);
+  }
+}
+
+void atc_processor_cache_init_for_zone_info(
+    AtcZoneProcessorCache *cache,
+    const AtcZoneInfo *zone_info)
+{
+  if (cache->zone_info == zone_info) return;
+  atc_processor_cache_init(cache);
+  cache->zone_info = zone_info;
+  for (uint8_t i = 0; i < kAtcProcessorCacheSize; i++) {
+    atc_processor_init_for_zone_info(&cache->processors[i], zone_info);
+  }
+}
+
+AtcZoneProcessor *atc_processor_cache_get_for_year(
+    AtcZoneProcessorCache *cache,
+    int16_t year)
+{
+  cache->clock++;
+
+  // Look for a hit, while keeping track of the least recently used slot.
+  uint8_t lru = 0;
+  for (uint8_t i = 0; i < kAtcProcessorCacheSize; i++) {
+    if (atc_processor_is_valid_for_year(&cache->processors[i], year)) {
+      cache->last_used[i] = cache->clock;
+      return &cache->processors[i];
+    }
+    if (cache->last_used[i] < cache->last_used[lru]) {
+      lru = i;
+    }
+  }
+
+  // Miss: regenerate the transitions in the least recently used slot.
+  AtcZoneProcessor *processor = &cache->processors[lru];
+  int8_t err = atc_processor_init_for_year(processor, year);
+  if (err) return NULL;
+  cache->last_used[lru] = cache->clock;
+  return processor;
+}
+
+void atc_processor_cache_find_by_epoch_seconds(
+    AtcZoneProcessorCache *cache,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result)
+{
+  // Use the same UTC year as atc_processor_init_for_epoch_seconds().
+  AtcPlainDateTime pdt;
+  atc_plain_date_time_from_epoch_seconds(&pdt, epoch_seconds);
+  if (atc_plain_date_time_is_error(&pdt)) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+
+  AtcZoneProcessor *processor = atc_processor_cache_get_for_year(
+      cache, pdt.year);
+  if (! processor) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+  atc_processor_find_by_epoch_seconds(processor, epoch_seconds, result);
+}
+
+void atc_processor_cache_find_by_plain_date_time(
+    AtcZoneProcessorCache *cache,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result)
+{
+  AtcZoneProcessor *processor = atc_processor_cache_get_for_year(
+      cache, pdt->year);
+  if (! processor) {
+    result->type = kAtcFindResultNotFound;
+    return;
+  }
+  atc_processor_find_by_plain_date_time(processor, pdt, disambiguate, result);
+}
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ * Copyright (c) 2026 Brian T. Park
+ */
+
+/**
+ * @file zone_processor_cache.h
+ *
+ * A variant of the AtcZoneProcessor which keeps the transitions of several
+ * years at the same time, for applications which alternate between a small
+ * number of different years (e.g. timestamps which straddle a New Year, or
+ * queries by epoch seconds which use the UTC year, mixed with queries by
+ * PlainDateTime which use the local year). A single AtcZoneProcessor would
+ * regenerate its transitions on every change of year.
+ */
+
+#ifndef ACE_TIME_C_ZONE_PROCESSOR_CACHE_H
+#define ACE_TIME_C_ZONE_PROCESSOR_CACHE_H
+
+#include <stdint.h>
+#include "common.h" // atc_time_t
+#include "../zoneinfo/zone_info.h"
+#include "plain_date_time.h" // AtcPlainDateTime
+#include "zone_processor.h" // AtcZoneProcessor, AtcFindResult
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef ACE_TIME_C_PROCESSOR_CACHE_SIZE
+/**
+ * Number of years cached by an AtcZoneProcessorCache. Can be overridden at
+ * compile time, but the library and the client application must be compiled
+ * with the same value because it determines the size of the struct.
+ */
+#define ACE_TIME_C_PROCESSOR_CACHE_SIZE 4
+#endif
+
+enum {
+  /** Number of AtcZoneProcessor instances in an AtcZoneProcessorCache. */
+  kAtcProcessorCacheSize = ACE_TIME_C_PROCESSOR_CACHE_SIZE,
+};
+
+/**
+ * A set of AtcZoneProcessor objects, one per cached year, all bound to the
+ * same AtcZoneInfo. When a year is requested which is not in the cache, the
+ * least recently used year is evicted.
+ */
+typedef struct AtcZoneProcessorCache {
+  /** The time zone attached to all processors of this cache. */
+  const AtcZoneInfo *zone_info;
+
+  /** Monotonic counter used to track the most recent use of each slot. */
+  uint32_t clock;
+
+  /** Value of 'clock' when the corresponding processor was last used. */
+  uint32_t last_used[kAtcProcessorCacheSize];
+
+  /** Processors, each caching the transitions of a single year. */
+  AtcZoneProcessor processors[kAtcProcessorCacheSize];
+} AtcZoneProcessorCache;
+
+/**
+ * Initialize the AtcZoneProcessorCache. This needs to be called only once for
+ * each instance.
+ */
+void atc_processor_cache_init(AtcZoneProcessorCache *cache);
+
+/**
+ * Bind the AtcZoneProcessorCache to the given zone_info. The cached years are
+ * invalidated only if the zone_info is different from the previous one.
+ */
+void atc_processor_cache_init_for_zone_info(
+    AtcZoneProcessorCache *cache,
+    const AtcZoneInfo *zone_info);
+
+/**
+ * Return the AtcZoneProcessor which holds the transitions of the given year,
+ * generating them in the least recently used slot if necessary. Returns NULL
+ * if the year is out of range.
+ */
+AtcZoneProcessor *atc_processor_cache_get_for_year(
+    AtcZoneProcessorCache *cache,
+    int16_t year);
+
+/**
+ * Find the AtcFindResult at the given epoch_seconds. Same semantics as
+ * atc_processor_find_by_epoch_seconds().
+ */
+void atc_processor_cache_find_by_epoch_seconds(
+    AtcZoneProcessorCache *cache,
+    atc_time_t epoch_seconds,
+    AtcFindResult *result);
+
+/**
+ * Find the AtcFindResult at the given PlainDateTime. Same semantics as
+ * atc_processor_find_by_plain_date_time().
+ */
+void atc_processor_cache_find_by_plain_date_time(
+    AtcZoneProcessorCache *cache,
+    const AtcPlainDateTime *pdt,
+    uint8_t disambiguate,
+    AtcFindResult *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
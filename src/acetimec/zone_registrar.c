@@ -4,6 +4,7 @@
  */
 
 #include <string.h>
+#include "registry_sort.h"
 #include "zone_registrar.h"
 
 void atc_registrar_init(
@@ -14,6 +15,91 @@ void atc_registrar_init(
   registrar->registry = registry;
   registrar->size = size;
   registrar->is_sorted = atc_registrar_is_registry_sorted(registry, size);
+  registrar->hash = NULL;
+  registrar->index_keys = NULL;
+  registrar->index_positions = NULL;
+}
+
+int8_t atc_registrar_set_hash(
+    AtcZoneRegistrar *registrar,
+    const AtcZoneHash *hash)
+{
+  if (hash->registry != registrar->registry || hash->size != registrar->size) {
+    return kAtcErrGeneric;
+  }
+  registrar->hash = hash;
+  return kAtcErrOk;
+}
+
+/** Compare the zone_ids, which may not fit in an int. */
+static int compare_zone_id(const AtcZoneInfo *a, const AtcZoneInfo *b)
+{
+  return (a->zone_id > b->zone_id) - (a->zone_id < b->zone_id);
+}
+
+/**
+ * Search the 1-based Eytzinger tree `keys[k - 1]` of `size` nodes, without
+ * branches except for the loop. Return the 0-based position of zone_id, or
+ * UINT16_MAX if not found.
+ */
+static uint16_t eytzinger_search(
+    const uint32_t *keys,
+    uint16_t size,
+    uint32_t zone_id)
+{
+  uint32_t k = 1;
+  while (k <= size) {
+    k = 2 * k + (keys[k - 1] < zone_id);
+  }
+  // Go back up to the last node where the search went left, which is the
+  // smallest key >= zone_id.
+  while (k & 1) k >>= 1;
+  k >>= 1;
+  if (k == 0 || keys[k - 1] != zone_id) return UINT16_MAX;
+  return (uint16_t) (k - 1);
+}
+
+int8_t atc_registrar_build_index(
+    AtcZoneRegistrar *registrar,
+    uint32_t *keys,
+    uint16_t *positions)
+{
+  const AtcZoneInfo * const * registry = registrar->registry;
+  uint16_t size = registrar->size;
+
+  // Sort the registry indexes temporarily into 'positions'.
+  atc_registry_sort_indexes(registry, size, positions, compare_zone_id);
+  for (uint16_t i = 1; i < size; i++) {
+    if (registry[positions[i]]->zone_id
+        == registry[positions[i - 1]]->zone_id) {
+      return kAtcErrGeneric;
+    }
+  }
+
+  // The in-order traversal of the tree visits the keys in sorted order.
+  uint32_t k = 1;
+  while (2 * k <= size) k = 2 * k;
+  for (uint16_t i = 0; i < size; i++) {
+    keys[k - 1] = registry[positions[i]]->zone_id;
+    if (2 * k + 1 <= size) {
+      // Next is the leftmost node of the right subtree.
+      k = 2 * k + 1;
+      while (2 * k <= size) k = 2 * k;
+    } else {
+      // Next is the first ancestor whose left subtree is done.
+      while (k & 1) k >>= 1;
+      k >>= 1;
+    }
+  }
+
+  // Then find the position of each zone in the tree.
+  for (uint16_t i = 0; i < size; i++) {
+    positions[eytzinger_search(keys, size, registry[i]->zone_id)] = i;
+  }
+
+  registrar->index_keys = keys;
+  registrar->index_positions = positions;
+  return kAtcErrOk;
 }
 
 bool atc_registrar_is_registry_sorted(
@@ -87,9 +173,20 @@ const AtcZoneInfo *atc_registrar_find_by_id(
     const AtcZoneRegistrar *registrar,
     uint32_t zone_id)
 {
-  uint16_t index = (registrar->is_sorted)
-      ? binary_search(registrar->registry, registrar->size, zone_id)
-      : linear_search(registrar->registry, registrar->size, zone_id);
+  if (registrar->hash) {
+    return atc_zone_hash_find_by_id(registrar->hash, zone_id);
+  }
+
+  uint16_t index;
+  if (registrar->index_keys) {
+    index = eytzinger_search(registrar->index_keys, registrar->size, zone_id);
+    if (index == UINT16_MAX) return NULL;
+    index = registrar->index_positions[index];
+  } else if (registrar->is_sorted) {
+    index = binary_search(registrar->registry, registrar->size, zone_id);
+  } else {
+    index = linear_search(registrar->registry, registrar->size, zone_id);
+  }
   if (index == UINT16_MAX) return NULL;
   const AtcZoneInfo *match = registrar->registry[index];
   return match;
@@ -17,6 +17,7 @@
 #include <stdbool.h>
 #include "../zoneinfo/zone_info.h"
 #include "common.h"
+#include "zone_hash.h" // AtcZoneHash
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,18 @@ typedef struct AtcZoneRegistrar {
 
   /** True if the registry is sorted according by zone_id. */
   bool is_sorted;
+
+  /** The optional perfect hash of the registry, NULL if not used. */
+  const AtcZoneHash *hash;
+
+  /**
+   * The optional zone_ids of the registry in Eytzinger order, NULL if not
+   * used. See atc_registrar_build_index().
+   */
+  const uint32_t *index_keys;
+
+  /** The index in the registry of each element of index_keys. */
+  const uint16_t *index_positions;
 } AtcZoneRegistrar;
 
 /**Initialize the given registrar data structure with the given registry. */
@@ -40,6 +53,33 @@ void atc_registrar_init(
     const AtcZoneInfo * const * registry,
     uint16_t size);
 
+/**
+ * Use the perfect hash of the registry (e.g. kAtcZonedb2025ZoneAndLinkHash
+ * for kAtcZonedb2025ZoneAndLinkRegistry) for the lookups by name and by ID,
+ * instead of the binary search. Returns kAtcErrGeneric, and keeps the
+ * previous search, if the hash was built for a different registry.
+ */
+int8_t atc_registrar_set_hash(
+    AtcZoneRegistrar *registrar,
+    const AtcZoneHash *hash);
+
+/**
+ * Build an index of the zone_ids of the registry into the caller-provided
+ * `keys` and `positions` arrays of `registrar->size` elements (6 bytes per
+ * zone), which must remain valid while the registrar is used. The search by
+ * name or by ID then reads only this contiguous array, in the Eytzinger
+ * (breadth-first) order of a binary tree, instead of one AtcZoneInfo per level
+ * of the binary search. The registry does not need to be sorted, so this also
+ * replaces the linear search of an unsorted custom registry.
+ *
+ * Returns kAtcErrGeneric, and keeps the previous search, if the registry
+ * contains duplicate zone_ids.
+ */
+int8_t atc_registrar_build_index(
+    AtcZoneRegistrar *registrar,
+    uint32_t *keys,
+    uint16_t *positions);
+
 /** Determine if the registry is sorted by zone id. */
 bool atc_registrar_is_registry_sorted(
     const AtcZoneInfo * const * registry,
@@ -3,7 +3,7 @@
  * Copyright (c) 2022 Brian T. Park
  */
 
-#include "epoch.h" // atc_epoch_seconds_from_unix_seconds()
+#include "epoch.h" // atc_epoch_from_unix_seconds()
 #include "plain_date.h"
 #include "plain_date_time.h"
 #include "zone_processor.h"
@@ -23,7 +23,11 @@ bool atc_zoned_date_time_is_error(const AtcZonedDateTime *zdt)
 atc_time_t atc_zoned_date_time_to_epoch_seconds(const AtcZonedDateTime *zdt)
 {
   // ZonedDateTime memory layout must be same as OffsetDateTime.
-  return atc_offset_date_time_to_epoch_seconds((const AtcOffsetDateTime*) zdt);
+  int64_t unix_seconds =
+      atc_offset_date_time_to_unix_seconds((const AtcOffsetDateTime*) zdt);
+  if (unix_seconds == kAtcInvalidUnixSeconds) return kAtcInvalidEpochSeconds;
+  return atc_epoch_from_unix_seconds(
+      atc_time_zone_get_epoch(&zdt->tz), unix_seconds);
 }
 
 void atc_zoned_date_time_from_epoch_seconds(
@@ -57,8 +61,11 @@ void atc_zoned_date_time_from_unix_seconds(
     atc_zoned_date_time_set_error(zdt);
     return;
   }
-  atc_time_t epoch_seconds = atc_epoch_seconds_from_unix_seconds(unix_seconds);
-  atc_zoned_date_time_from_epoch_seconds(zdt, epoch_seconds, tz);
+
+  zdt->tz = *tz;
+  // ZonedDateTime memory layout must be same as OffsetDateTime.
+  atc_time_zone_offset_date_time_from_unix_seconds(
+      tz, unix_seconds, (AtcOffsetDateTime *) zdt);
 }
 
 void atc_zoned_date_time_from_plain_date_time(
@@ -78,12 +85,13 @@ void atc_zoned_date_time_convert(
     const AtcTimeZone *to_tz,
     AtcZonedDateTime *to)
 {
-  atc_time_t epoch_seconds = atc_zoned_date_time_to_epoch_seconds(from);
-  if (epoch_seconds == kAtcInvalidEpochSeconds) {
+  // Use unix seconds, because the 2 time zones may use different epochs.
+  int64_t unix_seconds = atc_zoned_date_time_to_unix_seconds(from);
+  if (unix_seconds == kAtcInvalidUnixSeconds) {
     atc_zoned_date_time_set_error(to);
     return;
   }
-  atc_zoned_date_time_from_epoch_seconds(to, epoch_seconds, to_tz);
+  atc_zoned_date_time_from_unix_seconds(to, unix_seconds, to_tz);
 }
 
 // The current implementation looks up the PlainDateTime using
@@ -3,7 +3,6 @@
  * Copyright (c) 2022 Brian T. Park
  */
 
-#include "epoch.h"
 #include "time_zone.h"
 #include "zoned_extra.h"
 
@@ -30,8 +29,7 @@ void atc_zoned_extra_from_unix_seconds(
     int64_t unix_seconds,
     const AtcTimeZone *tz)
 {
-  atc_time_t epoch_seconds = atc_epoch_seconds_from_unix_seconds(unix_seconds);
-  atc_time_zone_zoned_extra_from_epoch_seconds(tz, epoch_seconds, extra);
+  atc_time_zone_zoned_extra_from_unix_seconds(tz, unix_seconds, extra);
 }
 
 void atc_zoned_extra_from_plain_date_time(
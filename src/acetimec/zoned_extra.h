@@ -52,6 +52,16 @@ typedef struct AtcZonedExtra {
 
   /** DST offset of the requested PlainDateTime or epoch_seconds */
   int32_t req_dst_offset_seconds;
+
+  /**
+   * Start of the interval [valid_from, valid_until) of Unix seconds in which
+   * std_offset_seconds, dst_offset_seconds and abbrev remain the same. See
+   * AtcFindResult.valid_from_unix_seconds. INT64_MIN for a fixed offset.
+   */
+  int64_t valid_from_unix_seconds;
+
+  /** End (exclusive) of the validity interval. INT64_MAX for a fixed offset. */
+  int64_t valid_until_unix_seconds;
 } AtcZonedExtra;
 
 /**
@@ -0,0 +1,25 @@
+// This file was generated by tools/zone_hash_generator from the
+// registries of zone_registry.h.
+//
+// DO NOT EDIT
+
+#ifndef ACE_TIME_C_ZONEDB_ZONEDB2000_ZONE_HASH_H
+#define ACE_TIME_C_ZONEDB_ZONEDB2000_ZONE_HASH_H
+
+#include "../acetimec/zone_hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Zones
+extern const AtcZoneHash kAtcZonedb2000ZoneHash;
+
+// Zones and Links
+extern const AtcZoneHash kAtcZonedb2000ZoneAndLinkHash;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
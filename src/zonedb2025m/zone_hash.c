@@ -0,0 +1,169 @@
+// This file was generated by tools/zone_hash_generator from the
+// registries of zone_registry.h.
+//
+// DO NOT EDIT
+
+#include "zone_registry.h"
+#include "zone_hash.h"
+
+//---------------------------------------------------------------------------
+// Zones
+//---------------------------------------------------------------------------
+
+static const uint16_t kZoneHashSeeds[114] = {
+  4, 18, 6, 0, 1, 2, 19, 66, 38, 90,
+  0, 6, 0, 11, 0, 39, 23, 28, 0, 2,
+  32, 4, 97, 0, 0, 1, 21, 0, 4, 0,
+  0, 0, 3, 13, 9, 2, 12, 33, 3, 24,
+  19, 0, 0, 0, 0, 8, 4, 52, 114, 1,
+  7, 42, 14, 1, 76, 0, 21, 13, 126, 106,
+  5, 129, 359, 4, 4, 32, 97, 0, 0, 194,
+  6, 8, 147, 5, 11, 5, 3, 0, 18, 41,
+  14, 1, 117, 6, 0, 250, 11, 109, 56, 0,
+  0, 187, 209, 600, 98, 25, 20, 21, 2, 31,
+  413, 0, 529, 103, 0, 528, 37, 11, 42, 5,
+  252, 11, 99, 77,
+};
+
+static const uint16_t kZoneHashIndexes[340] = {
+  72, 260, 276, 248, 130, 335, 285, 153, 254, 245,
+  325, 69, 128, 120, 154, 282, 269, 132, 31, 208,
+  103, 14, 65, 287, 268, 220, 320, 192, 188, 34,
+  167, 241, 225, 247, 138, 159, 70, 86, 184, 99,
+  302, 332, 207, 306, 295, 4, 234, 74, 178, 273,
+  10, 87, 224, 244, 253, 54, 197, 62, 95, 290,
+  318, 90, 334, 121, 118, 51, 109, 293, 191, 24,
+  141, 279, 199, 134, 204, 147, 23, 33, 271, 187,
+  139, 278, 171, 88, 162, 304, 250, 50, 161, 238,
+  186, 337, 177, 38, 206, 297, 336, 59, 319, 140,
+  329, 56, 232, 156, 240, 333, 265, 328, 129, 32,
+  27, 223, 179, 202, 151, 160, 83, 107, 97, 15,
+  79, 237, 281, 262, 19, 71, 258, 41, 45, 300,
+  257, 331, 327, 75, 308, 93, 198, 324, 18, 182,
+  275, 214, 13, 137, 264, 102, 195, 317, 212, 266,
+  114, 17, 115, 230, 2, 100, 259, 105, 228, 307,
+  64, 274, 227, 77, 143, 68, 236, 242, 286, 42,
+  146, 96, 338, 150, 321, 157, 36, 305, 280, 221,
+  155, 37, 35, 339, 63, 6, 133, 288, 165, 330,
+  222, 218, 46, 168, 277, 113, 29, 67, 8, 47,
+  216, 291, 166, 314, 21, 322, 116, 200, 163, 196,
+  1, 135, 3, 180, 43, 108, 169, 174, 73, 189,
+  251, 246, 176, 48, 125, 213, 243, 52, 194, 16,
+  0, 316, 270, 294, 117, 98, 152, 40, 25, 303,
+  301, 298, 7, 219, 170, 299, 203, 61, 149, 284,
+  183, 92, 142, 311, 252, 217, 12, 55, 193, 173,
+  57, 205, 89, 76, 106, 283, 315, 126, 249, 210,
+  5, 164, 272, 215, 226, 172, 313, 309, 136, 144,
+  39, 256, 101, 82, 323, 81, 80, 263, 190, 85,
+  58, 30, 289, 131, 26, 296, 124, 111, 53, 229,
+  211, 104, 66, 20, 312, 209, 231, 84, 235, 233,
+  239, 60, 175, 123, 292, 28, 261, 201, 145, 181,
+  11, 185, 310, 91, 158, 127, 112, 255, 110, 119,
+  122, 44, 78, 49, 9, 326, 94, 148, 22, 267,
+};
+
+const AtcZoneHash kAtcZonedb2025ZoneHash = {
+  kAtcZonedb2025ZoneRegistry /*registry*/,
+  340 /*size*/,
+  114 /*num_buckets*/,
+  kZoneHashSeeds /*seeds*/,
+  kZoneHashIndexes /*indexes*/,
+};
+
+//---------------------------------------------------------------------------
+// Zones and Links
+//---------------------------------------------------------------------------
+
+static const uint16_t kZoneAndLinkHashSeeds[199] = {
+  1, 2, 24, 13, 1, 44, 0, 2, 0, 3,
+  1, 10, 27, 0, 36, 2, 11, 36, 0, 0,
+  24, 3, 5, 2, 0, 38, 63, 17, 32, 36,
+  56, 0, 6, 0, 1, 31, 1, 17, 18, 0,
+  1, 37, 5, 0, 21, 0, 4, 15, 44, 154,
+  1, 0, 76, 0, 24, 1, 36, 23, 26, 2,
+  42, 18, 20, 2, 41, 8, 12, 3, 2, 0,
+  9, 22, 1, 12, 3, 2, 5, 0, 4, 16,
+  3, 4, 74, 28, 20, 13, 5, 10, 2, 25,
+  65, 64, 34, 4, 13, 63, 0, 2, 9, 51,
+  100, 11, 14, 100, 82, 0, 114, 3, 0, 53,
+  33, 26, 42, 56, 19, 16, 70, 1, 13, 12,
+  180, 14, 2, 16, 2, 8, 317, 71, 14, 35,
+  61, 5, 62, 75, 11, 26, 5, 8, 2, 50,
+  216, 1, 1, 75, 1, 46, 0, 0, 3, 74,
+  72, 1, 17, 24, 82, 0, 4, 8, 0, 58,
+  26, 177, 105, 40, 1, 52, 53, 88, 153, 7,
+  9, 525, 22, 56, 36, 75, 0, 27, 0, 8,
+  36, 160, 28, 6, 47, 26, 100, 13, 266, 42,
+  8, 0, 4, 465, 0, 10, 389, 253, 1157,
+};
+
+static const uint16_t kZoneAndLinkHashIndexes[597] = {
+  86, 459, 410, 94, 464, 352, 7, 402, 82, 486,
+  147, 173, 155, 534, 296, 566, 240, 36, 309, 115,
+  260, 278, 153, 326, 311, 458, 18, 223, 41, 145,
+  192, 16, 356, 504, 541, 219, 396, 135, 343, 580,
+  294, 480, 0, 468, 437, 447, 247, 242, 473, 507,
+  418, 359, 499, 212, 209, 164, 225, 523, 333, 253,
+  132, 302, 288, 578, 248, 127, 199, 266, 441, 106,
+  217, 519, 76, 322, 561, 196, 362, 528, 474, 304,
+  411, 111, 55, 183, 186, 340, 52, 305, 276, 161,
+  484, 143, 424, 577, 498, 357, 429, 533, 197, 514,
+  564, 398, 371, 177, 374, 428, 552, 179, 232, 570,
+  268, 496, 590, 214, 126, 327, 592, 184, 377, 306,
+  282, 158, 159, 66, 258, 339, 12, 323, 417, 481,
+  34, 129, 138, 270, 2, 47, 70, 353, 112, 430,
+  237, 301, 165, 250, 231, 443, 97, 559, 308, 241,
+  425, 315, 185, 329, 385, 292, 355, 420, 551, 15,
+  465, 431, 137, 291, 84, 19, 95, 364, 187, 285,
+  190, 494, 17, 74, 461, 591, 118, 452, 575, 128,
+  438, 515, 33, 521, 293, 280, 286, 393, 579, 478,
+  53, 263, 537, 67, 102, 351, 31, 513, 440, 373,
+  416, 368, 550, 119, 89, 39, 198, 171, 110, 427,
+  44, 77, 63, 43, 172, 92, 218, 568, 321, 262,
+  175, 244, 448, 358, 540, 8, 530, 378, 439, 284,
+  30, 121, 596, 298, 229, 585, 91, 267, 224, 166,
+  365, 271, 28, 502, 542, 332, 376, 211, 350, 206,
+  539, 406, 80, 96, 273, 182, 501, 495, 226, 210,
+  202, 457, 462, 375, 546, 236, 249, 545, 277, 101,
+  405, 123, 35, 180, 450, 200, 134, 476, 391, 390,
+  139, 83, 469, 45, 392, 401, 220, 576, 517, 26,
+  32, 442, 3, 527, 283, 24, 310, 174, 144, 434,
+  510, 108, 29, 491, 58, 526, 554, 404, 299, 239,
+  415, 22, 162, 382, 493, 46, 467, 466, 463, 482,
+  512, 72, 337, 562, 557, 20, 124, 178, 470, 511,
+  549, 25, 388, 483, 490, 532, 233, 565, 93, 587,
+  100, 75, 203, 256, 341, 141, 274, 508, 88, 529,
+  334, 346, 409, 130, 104, 194, 50, 307, 454, 479,
+  583, 421, 230, 222, 133, 485, 414, 380, 344, 11,
+  394, 221, 449, 524, 342, 589, 290, 318, 520, 279,
+  383, 303, 122, 573, 10, 6, 451, 444, 150, 201,
+  216, 319, 386, 87, 336, 289, 330, 455, 403, 62,
+  488, 586, 195, 389, 116, 582, 555, 475, 51, 272,
+  328, 148, 69, 314, 59, 412, 460, 563, 65, 297,
+  181, 335, 497, 189, 295, 21, 509, 163, 505, 275,
+  324, 384, 81, 5, 73, 243, 4, 538, 413, 347,
+  423, 379, 259, 265, 252, 188, 320, 98, 567, 492,
+  543, 114, 349, 54, 558, 446, 595, 422, 213, 471,
+  354, 316, 433, 215, 269, 191, 472, 553, 366, 109,
+  167, 78, 381, 205, 487, 489, 254, 588, 477, 387,
+  261, 399, 281, 193, 300, 436, 176, 71, 432, 456,
+  535, 68, 169, 345, 245, 574, 246, 536, 156, 251,
+  569, 584, 363, 140, 107, 317, 14, 38, 547, 113,
+  572, 234, 37, 131, 170, 235, 154, 338, 445, 146,
+  157, 516, 125, 120, 257, 105, 594, 49, 407, 325,
+  312, 40, 57, 331, 369, 142, 208, 27, 61, 152,
+  9, 581, 593, 56, 204, 453, 149, 503, 370, 426,
+  227, 518, 360, 435, 361, 85, 560, 136, 23, 419,
+  264, 117, 207, 408, 548, 42, 571, 500, 313, 372,
+  544, 348, 13, 60, 522, 79, 64, 395, 48, 238,
+  160, 556, 1, 531, 400, 99, 255, 151, 397, 506,
+  168, 90, 525, 367, 228, 287, 103,
+};
+
+const AtcZoneHash kAtcZonedb2025ZoneAndLinkHash = {
+  kAtcZonedb2025ZoneAndLinkRegistry /*registry*/,
+  597 /*size*/,
+  199 /*num_buckets*/,
+  kZoneAndLinkHashSeeds /*seeds*/,
+  kZoneAndLinkHashIndexes /*indexes*/,
+};
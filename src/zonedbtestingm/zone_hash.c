@@ -0,0 +1,49 @@
+// This file was generated by tools/zone_hash_generator from the
+// registries of zone_registry.h.
+//
+// DO NOT EDIT
+
+#include "zone_registry.h"
+#include "zone_hash.h"
+
+//---------------------------------------------------------------------------
+// Zones
+//---------------------------------------------------------------------------
+
+static const uint16_t kZoneHashSeeds[6] = {
+  6, 2, 0, 14, 34, 156,
+};
+
+static const uint16_t kZoneHashIndexes[16] = {
+  7, 3, 2, 14, 10, 4, 5, 8, 12, 15,
+  1, 0, 11, 9, 6, 13,
+};
+
+const AtcZoneHash kAtcTestingZoneHash = {
+  kAtcTestingZoneRegistry /*registry*/,
+  16 /*size*/,
+  6 /*num_buckets*/,
+  kZoneHashSeeds /*seeds*/,
+  kZoneHashIndexes /*indexes*/,
+};
+
+//---------------------------------------------------------------------------
+// Zones and Links
+//---------------------------------------------------------------------------
+
+static const uint16_t kZoneAndLinkHashSeeds[6] = {
+  1, 1, 0, 0, 17, 321,
+};
+
+static const uint16_t kZoneAndLinkHashIndexes[17] = {
+  16, 4, 11, 14, 5, 6, 2, 12, 1, 9,
+  7, 0, 10, 8, 13, 15, 3,
+};
+
+const AtcZoneHash kAtcTestingZoneAndLinkHash = {
+  kAtcTestingZoneAndLinkRegistry /*registry*/,
+  17 /*size*/,
+  6 /*num_buckets*/,
+  kZoneAndLinkHashSeeds /*seeds*/,
+  kZoneAndLinkHashIndexes /*indexes*/,
+};
@@ -36,6 +36,13 @@ const char *atc_zone_info_short_name(const AtcZoneInfo *info)
   return begin;
 }
 
+bool atc_zone_info_is_fixed_offset(const AtcZoneInfo *info)
+{
+  return info->num_eras == 1
+      && info->eras[0].zone_policy == NULL
+      && info->eras[0].until_year == kAtcZoneInfoMaxUntilYear;
+}
+
 //---------------------------------------------------------------------------
 
 #if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
@@ -42,6 +42,13 @@ const char *atc_zone_info_zone_name(const AtcZoneInfo *info);
  */
 const char *atc_zone_info_short_name(const AtcZoneInfo *info);
 
+/**
+ * Return true if the zone has a single era without a RULES policy, which
+ * never ends. The UTC offset and the abbreviation of such a zone never
+ * change, so they can be calculated without an AtcZoneProcessor.
+ */
+bool atc_zone_info_is_fixed_offset(const AtcZoneInfo *info);
+
 /** Return the standard offset of the given era in seconds. */
 int32_t atc_zone_era_std_offset_seconds(const AtcZoneEra *era);
 
@@ -0,0 +1,252 @@
+/*
+ * Unit tests for date_time_columns.c.
+ */
+
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+enum { kNumRows = 512 };
+
+static int16_t years[kNumRows];
+static uint8_t months[kNumRows];
+static uint8_t days[kNumRows];
+static uint8_t hours[kNumRows];
+static uint8_t minutes[kNumRows];
+static uint8_t seconds[kNumRows];
+static int32_t offsets[kNumRows];
+static atc_time_t epoch_seconds[kNumRows];
+static atc_time_t round_trip[kNumRows];
+
+static AtcDateTimeColumns columns = {
+  years, months, days, hours, minutes, seconds, offsets,
+};
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_date_time_columns_from_epoch_seconds)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+
+  // 2022-11-06 01:30 PDT, then 01:30 PST one hour later, then an error
+  AtcPlainDateTime pdt = {2022, 11, 6, 8, 30, 0};
+  epoch_seconds[0] = atc_plain_date_time_to_epoch_seconds(&pdt);
+  epoch_seconds[1] = epoch_seconds[0] + 3600;
+  epoch_seconds[2] = kAtcInvalidEpochSeconds;
+  int8_t err = atc_date_time_columns_from_epoch_seconds(
+      &columns, epoch_seconds, 3, &tz);
+  ACU_ASSERT(err == kAtcErrGeneric);
+
+  ACU_ASSERT(years[0] == 2022);
+  ACU_ASSERT(months[0] == 11);
+  ACU_ASSERT(days[0] == 6);
+  ACU_ASSERT(hours[0] == 1);
+  ACU_ASSERT(minutes[0] == 30);
+  ACU_ASSERT(seconds[0] == 0);
+  ACU_ASSERT(offsets[0] == -7*3600);
+
+  ACU_ASSERT(years[1] == 2022);
+  ACU_ASSERT(hours[1] == 1);
+  ACU_ASSERT(minutes[1] == 30);
+  ACU_ASSERT(offsets[1] == -8*3600);
+
+  ACU_ASSERT(months[2] == 0);
+}
+
+ACU_TEST(test_atc_date_time_columns_to_epoch_seconds)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+
+  // 2022-03-13 01:59:59 PST, 02:30 (gap), 03:00 PDT, and an invalid date
+  int16_t y[] = {2022, 2022, 2022, 2022};
+  uint8_t mo[] = {3, 3, 3, 2};
+  uint8_t d[] = {13, 13, 13, 30};
+  uint8_t h[] = {1, 2, 3, 0};
+  uint8_t mi[] = {59, 30, 0, 0};
+  uint8_t s[] = {59, 0, 0, 0};
+  AtcDateTimeColumns input = {y, mo, d, h, mi, s, NULL};
+  atc_time_t es[4];
+  int8_t err = atc_date_time_columns_to_epoch_seconds(
+      &input, 4, &tz, kAtcDisambiguateCompatible, es);
+  ACU_ASSERT(err == kAtcErrGeneric);
+
+  int64_t unix_seconds = 1647165600; // 2022-03-13 02:00 PST
+  ACU_ASSERT(es[0] == atc_epoch_seconds_from_unix_seconds(unix_seconds - 1));
+  // 02:30 PST is 03:30 PDT in compatible mode
+  ACU_ASSERT(es[1] == atc_epoch_seconds_from_unix_seconds(unix_seconds + 1800));
+  ACU_ASSERT(es[2] == atc_epoch_seconds_from_unix_seconds(unix_seconds));
+  ACU_ASSERT(es[3] == kAtcInvalidEpochSeconds);
+
+  // 02:30 is 01:30 PDT in earlier mode
+  err = atc_date_time_columns_to_epoch_seconds(
+      &input, 3, &tz, kAtcDisambiguateEarlier, es);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(es[1] == atc_epoch_seconds_from_unix_seconds(unix_seconds - 1800));
+}
+
+ACU_TEST(test_atc_date_time_columns_fixed)
+{
+  AtcTimeZone tz = atc_time_zone_fixed(5*3600 + 1800);
+  epoch_seconds[0] = 0;
+  epoch_seconds[1] = 86400 - 5*3600 - 1800;
+  int8_t err = atc_date_time_columns_from_epoch_seconds(
+      &columns, epoch_seconds, 2, &tz);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(hours[0] == 5);
+  ACU_ASSERT(minutes[0] == 30);
+  ACU_ASSERT(offsets[0] == 5*3600 + 1800);
+  ACU_ASSERT(hours[1] == 0);
+  ACU_ASSERT(minutes[1] == 0);
+
+  err = atc_date_time_columns_to_epoch_seconds(
+      &columns, 2, &tz, kAtcDisambiguateCompatible, round_trip);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(round_trip[0] == epoch_seconds[0]);
+  ACU_ASSERT(round_trip[1] == epoch_seconds[1]);
+}
+
+//---------------------------------------------------------------------------
+
+static const uint8_t disambiguates[] = {
+  kAtcDisambiguateCompatible,
+  kAtcDisambiguateEarlier,
+  kAtcDisambiguateLater,
+  kAtcDisambiguateReversed,
+};
+
+// Verify that the batch conversion of `epoch_seconds` returns the same fields
+// as atc_zoned_date_time_from_epoch_seconds().
+static void assert_from_epoch_seconds_matches(
+    AcuContext *acu_context,
+    const AtcTimeZone *tz,
+    const AtcTimeZone *scalar_tz,
+    uint32_t num)
+{
+  atc_date_time_columns_from_epoch_seconds(&columns, epoch_seconds, num, tz);
+  for (uint32_t i = 0; i < num; i++) {
+    AtcZonedDateTime zdt;
+    atc_zoned_date_time_from_epoch_seconds(&zdt, epoch_seconds[i], scalar_tz);
+    ACU_ASSERT(years[i] == zdt.year);
+    ACU_ASSERT(months[i] == zdt.month);
+    ACU_ASSERT(days[i] == zdt.day);
+    ACU_ASSERT(hours[i] == zdt.hour);
+    ACU_ASSERT(minutes[i] == zdt.minute);
+    ACU_ASSERT(seconds[i] == zdt.second);
+    ACU_ASSERT(offsets[i] == zdt.offset_seconds);
+  }
+}
+
+// Verify that the batch conversion of `columns` returns the same epoch seconds
+// as atc_zoned_date_time_from_plain_date_time(), for each disambiguate mode.
+static void assert_to_epoch_seconds_matches(
+    AcuContext *acu_context,
+    const AtcTimeZone *tz,
+    const AtcTimeZone *scalar_tz,
+    uint32_t num)
+{
+  for (uint8_t d = 0; d < 4; d++) {
+    atc_date_time_columns_to_epoch_seconds(
+        &columns, num, tz, disambiguates[d], round_trip);
+    for (uint32_t i = 0; i < num; i++) {
+      AtcPlainDateTime pdt = {
+        years[i], months[i], days[i], hours[i], minutes[i], seconds[i],
+      };
+      AtcZonedDateTime zdt;
+      atc_zoned_date_time_from_plain_date_time(
+          &zdt, &pdt, scalar_tz, disambiguates[d]);
+      ACU_ASSERT(round_trip[i] == atc_zoned_date_time_to_epoch_seconds(&zdt));
+    }
+  }
+}
+
+// Verify that the batch conversions return the same results as the scalar
+// conversions of AtcZonedDateTime, for every zone, using rows which jump
+// between years, and rows which sweep across each transition.
+ACU_TEST(test_atc_date_time_columns_matches_zoned_date_time)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcZoneProcessor scalar_processor;
+  atc_processor_init(&scalar_processor);
+  AtcZoneProcessor transitions_processor;
+  atc_processor_init(&transitions_processor);
+
+  for (uint16_t z = 0; z < kAtcZonedb2025ZoneRegistrySize; z++) {
+    const AtcZoneInfo *info = kAtcZonedb2025ZoneRegistry[z];
+    AtcTimeZone tz = atc_time_zone_for_zone_info(info, &processor);
+    AtcTimeZone scalar_tz = atc_time_zone_for_zone_info(
+        info, &scalar_processor);
+
+    // Runs of 16 sorted rows 7h13m apart, then a jump of a few years.
+    AtcPlainDateTime start_pdt = {1990, 1, 1, 0, 0, 0};
+    atc_time_t start = atc_plain_date_time_to_epoch_seconds(&start_pdt);
+    for (uint32_t i = 0; i < kNumRows; i++) {
+      epoch_seconds[i] = start + (atc_time_t) (i % 16) * 25980
+          + (atc_time_t) (i / 16 * 37 % 50) * 31556952;
+    }
+    ACU_ASSERT_NO_FATAL_FAILURE(assert_from_epoch_seconds_matches(
+        acu_context, &tz, &scalar_tz, kNumRows));
+    ACU_ASSERT_NO_FATAL_FAILURE(assert_to_epoch_seconds_matches(
+        acu_context, &tz, &scalar_tz, kNumRows));
+
+    // Rows every 15 minutes across each transition. The local times use the
+    // UTC offset before the transition, so they fall into the gaps and
+    // overlaps.
+    atc_processor_init_for_zone_info(&transitions_processor, info);
+    for (int16_t year = 1980; year < 2040; year++) {
+      atc_processor_init_for_year(&transitions_processor, year);
+      const AtcTransitionStorage *ts =
+          &transitions_processor.transition_storage;
+      uint32_t num = 0;
+      for (uint8_t j = 1; j < ts->index_free; j++) {
+        int64_t unix_seconds = ts->transitions[j]->start_unix_seconds;
+        for (int32_t delta = -7200; delta <= 7200; delta += 900) {
+          epoch_seconds[num++] =
+              atc_epoch_seconds_from_unix_seconds(unix_seconds + delta);
+        }
+      }
+      ACU_ASSERT_NO_FATAL_FAILURE(assert_from_epoch_seconds_matches(
+          acu_context, &tz, &scalar_tz, num));
+
+      num = 0;
+      for (uint8_t j = 1; j < ts->index_free; j++) {
+        const AtcTransition *prev = ts->transitions[j - 1];
+        int64_t unix_seconds = ts->transitions[j]->start_unix_seconds
+            + prev->offset_seconds + prev->delta_seconds;
+        for (int32_t delta = -7200; delta <= 7200; delta += 900) {
+          AtcPlainDateTime pdt;
+          atc_plain_date_time_from_unix_seconds(&pdt, unix_seconds + delta);
+          years[num] = pdt.year;
+          months[num] = pdt.month;
+          days[num] = pdt.day;
+          hours[num] = pdt.hour;
+          minutes[num] = pdt.minute;
+          seconds[num] = pdt.second;
+          num++;
+        }
+      }
+      ACU_ASSERT_NO_FATAL_FAILURE(assert_to_epoch_seconds_matches(
+          acu_context, &tz, &scalar_tz, num));
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_date_time_columns_from_epoch_seconds);
+  ACU_RUN_TEST(test_atc_date_time_columns_to_epoch_seconds);
+  ACU_RUN_TEST(test_atc_date_time_columns_fixed);
+  ACU_RUN_TEST(test_atc_date_time_columns_matches_zoned_date_time);
+  ACU_SUMMARY();
+}
@@ -17,6 +17,57 @@ ACU_TEST(test_atc_epoch_seconds_from_unix_seconds)
   ACU_ASSERT(epoch_seconds == -1577923200);
 }
 
+ACU_TEST(test_atc_epoch)
+{
+  AtcEpoch epoch;
+  atc_epoch_init(&epoch, 2000);
+  ACU_ASSERT(atc_epoch_get_year(&epoch) == 2000);
+  ACU_ASSERT(atc_epoch_to_unix_seconds(&epoch, 0) == 946684800);
+  ACU_ASSERT(atc_epoch_from_unix_seconds(&epoch, 946684800) == 0);
+  ACU_ASSERT(atc_epoch_to_unix_seconds(&epoch, kAtcInvalidEpochSeconds)
+      == kAtcInvalidUnixSeconds);
+  ACU_ASSERT(atc_epoch_from_unix_seconds(&epoch, kAtcInvalidUnixSeconds)
+      == kAtcInvalidEpochSeconds);
+
+  // The current epoch year of the library is not affected.
+  ACU_ASSERT(atc_get_current_epoch_year() == 2050);
+  ACU_ASSERT(atc_epoch_get_year(NULL) == 2050);
+  ACU_ASSERT(atc_epoch_to_unix_seconds(NULL, 0) == 2524608000);
+}
+
+// Verify that the array kernels agree with the scalar functions for every day
+// from 0001-01-01 to 9999-12-31.
+ACU_TEST(test_atc_convert_internal_days_array_exhaustive)
+{
+  enum { kBlock = 1000 };
+  int32_t internal_days[kBlock];
+  int32_t round_trip[kBlock];
+  int16_t years[kBlock];
+  uint8_t months[kBlock];
+  uint8_t days[kBlock];
+
+  int32_t start = atc_convert_to_internal_days(1, 1, 1);
+  int32_t until = atc_convert_to_internal_days(9999, 12, 31) + 1;
+  for (int32_t base = start; base < until; base += kBlock) {
+    uint32_t n = (until - base < kBlock) ? (uint32_t) (until - base) : kBlock;
+    for (uint32_t i = 0; i < n; i++) internal_days[i] = base + (int32_t) i;
+
+    atc_convert_from_internal_days_array(
+        internal_days, n, years, months, days);
+    atc_convert_to_internal_days_array(years, months, days, n, round_trip);
+    for (uint32_t i = 0; i < n; i++) {
+      int16_t year;
+      uint8_t month;
+      uint8_t day;
+      atc_convert_from_internal_days(internal_days[i], &year, &month, &day);
+      ACU_ASSERT(years[i] == year);
+      ACU_ASSERT(months[i] == month);
+      ACU_ASSERT(days[i] == day);
+      ACU_ASSERT(round_trip[i] == internal_days[i]);
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -25,5 +76,7 @@ int main()
 {
   ACU_RUN_TEST(test_atc_unix_seconds_from_epoch_seconds);
   ACU_RUN_TEST(test_atc_epoch_seconds_from_unix_seconds);
+  ACU_RUN_TEST(test_atc_epoch);
+  ACU_RUN_TEST(test_atc_convert_internal_days_array_exhaustive);
   ACU_SUMMARY();
 }
@@ -140,6 +140,49 @@ ACU_TEST(test_plain_date_to_unix_days_invalid)
   ACU_ASSERT(atc_plain_date_to_unix_days(10000, 1, 1) == kAtcInvalidEpochDays);
 }
 
+ACU_TEST(test_plain_date_array_epoch_days)
+{
+  int16_t years[] = {2050, 2000, 2100, 2000, 10000};
+  uint8_t months[] = {1, 1, 12, 2, 1};
+  uint8_t days[] = {1, 1, 31, 30, 1};
+  int32_t epoch_days[5];
+  atc_plain_date_array_to_epoch_days(
+      NULL, years, months, days, 5, epoch_days);
+  for (uint8_t i = 0; i < 5; i++) {
+    ACU_ASSERT(epoch_days[i]
+        == atc_plain_date_to_epoch_days(years[i], months[i], days[i]));
+  }
+  ACU_ASSERT(epoch_days[0] == 0);
+  ACU_ASSERT(epoch_days[3] == kAtcInvalidEpochDays);
+  ACU_ASSERT(epoch_days[4] == kAtcInvalidEpochDays);
+
+  int16_t out_years[3];
+  uint8_t out_months[3];
+  uint8_t out_days[3];
+  atc_plain_date_array_from_epoch_days(
+      NULL, epoch_days, 3, out_years, out_months, out_days);
+  for (uint8_t i = 0; i < 3; i++) {
+    ACU_ASSERT(out_years[i] == years[i]);
+    ACU_ASSERT(out_months[i] == months[i]);
+    ACU_ASSERT(out_days[i] == days[i]);
+  }
+
+  // An explicit epoch instead of the current epoch year.
+  AtcEpoch epoch;
+  atc_epoch_init(&epoch, 2000);
+  atc_plain_date_array_to_epoch_days(
+      &epoch, years, months, days, 3, epoch_days);
+  ACU_ASSERT(epoch_days[0] == 18263); // 2050-01-01
+  ACU_ASSERT(epoch_days[1] == 0); // 2000-01-01
+  atc_plain_date_array_from_epoch_days(
+      &epoch, epoch_days, 3, out_years, out_months, out_days);
+  for (uint8_t i = 0; i < 3; i++) {
+    ACU_ASSERT(out_years[i] == years[i]);
+    ACU_ASSERT(out_months[i] == months[i]);
+    ACU_ASSERT(out_days[i] == days[i]);
+  }
+}
+
 ACU_TEST(test_day_of_week)
 {
   // Check every day from year 2000 to 2499, inclusive.
@@ -293,6 +336,7 @@ int main()
   ACU_RUN_TEST(test_plain_date_epoch_days_unix_days);
   ACU_RUN_TEST(test_plain_date_to_epoch_days_invalid);
   ACU_RUN_TEST(test_plain_date_to_unix_days_invalid);
+  ACU_RUN_TEST(test_plain_date_array_epoch_days);
   ACU_RUN_TEST(test_day_of_week);
   ACU_RUN_TEST(test_increment_one_day);
   ACU_RUN_TEST(test_decrement_one_day);
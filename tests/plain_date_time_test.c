@@ -267,6 +267,42 @@ ACU_TEST(test_plain_date_time_from_unix_seconds)
   ACU_ASSERT(pdt.second == 5);
 }
 
+// The number of seconds of the days overflows an int32_t outside of the years
+// 1901 to 2038.
+ACU_TEST(test_plain_date_time_from_unix_seconds_beyond_int32)
+{
+  AtcPlainDateTime pdt;
+
+  // unix_days = 25205
+  atc_plain_date_time_from_unix_seconds(&pdt, 2177712000L + 45296);
+  ACU_ASSERT(!atc_plain_date_time_is_error(&pdt));
+  ACU_ASSERT(pdt.year == 2039);
+  ACU_ASSERT(pdt.month == 1);
+  ACU_ASSERT(pdt.day == 4);
+  ACU_ASSERT(pdt.hour == 12);
+  ACU_ASSERT(pdt.minute == 34);
+  ACU_ASSERT(pdt.second == 56);
+
+  // unix_days = -57871
+  atc_plain_date_time_from_unix_seconds(&pdt, -5000054400L + 45296);
+  ACU_ASSERT(!atc_plain_date_time_is_error(&pdt));
+  ACU_ASSERT(pdt.year == 1811);
+  ACU_ASSERT(pdt.month == 7);
+  ACU_ASSERT(pdt.day == 23);
+  ACU_ASSERT(pdt.hour == 12);
+  ACU_ASSERT(pdt.minute == 34);
+  ACU_ASSERT(pdt.second == 56);
+
+  atc_plain_date_time_from_unix_seconds(&pdt, 253402300799L);
+  ACU_ASSERT(!atc_plain_date_time_is_error(&pdt));
+  ACU_ASSERT(pdt.year == 9999);
+  ACU_ASSERT(pdt.month == 12);
+  ACU_ASSERT(pdt.day == 31);
+  ACU_ASSERT(pdt.hour == 23);
+  ACU_ASSERT(pdt.minute == 59);
+  ACU_ASSERT(pdt.second == 59);
+}
+
 //---------------------------------------------------------------------------
 
 ACU_TEST(test_plain_date_time_to_unix_seconds_invalid)
@@ -296,6 +332,76 @@ ACU_TEST(test_plain_date_time_to_unix_seconds_invalid)
   ACU_ASSERT(seconds == kAtcInvalidUnixSeconds);
 }
 
+// Verify that the array functions agree with the scalar functions, over more
+// than one block, including negative epoch seconds and errors.
+ACU_TEST(test_plain_date_time_array_epoch_seconds)
+{
+  enum { kNum = 100 };
+  atc_time_t epoch_seconds[kNum];
+  atc_time_t round_trip[kNum];
+  AtcPlainDateTime pdts[kNum];
+
+  for (uint32_t i = 0; i < kNum; i++) {
+    epoch_seconds[i] = (atc_time_t) (((int64_t) i - 50) * 40000019);
+  }
+  epoch_seconds[7] = kAtcInvalidEpochSeconds;
+  epoch_seconds[8] = -1;
+  epoch_seconds[9] = -86400;
+
+  atc_plain_date_time_array_from_epoch_seconds(
+      NULL, pdts, epoch_seconds, kNum);
+  for (uint32_t i = 0; i < kNum; i++) {
+    AtcPlainDateTime pdt;
+    atc_plain_date_time_from_epoch_seconds(&pdt, epoch_seconds[i]);
+    ACU_ASSERT(atc_plain_date_time_is_error(&pdts[i])
+        == atc_plain_date_time_is_error(&pdt));
+    if (atc_plain_date_time_is_error(&pdt)) continue;
+    ACU_ASSERT(pdts[i].year == pdt.year);
+    ACU_ASSERT(pdts[i].month == pdt.month);
+    ACU_ASSERT(pdts[i].day == pdt.day);
+    ACU_ASSERT(pdts[i].hour == pdt.hour);
+    ACU_ASSERT(pdts[i].minute == pdt.minute);
+    ACU_ASSERT(pdts[i].second == pdt.second);
+  }
+
+  pdts[20].day = 32; // invalid
+  pdts[21].hour = 24; // invalid
+  atc_plain_date_time_array_to_epoch_seconds(NULL, pdts, kNum, round_trip);
+  for (uint32_t i = 0; i < kNum; i++) {
+    ACU_ASSERT(round_trip[i] == atc_plain_date_time_to_epoch_seconds(&pdts[i]));
+  }
+  ACU_ASSERT(round_trip[0] == epoch_seconds[0]);
+  ACU_ASSERT(round_trip[7] == kAtcInvalidEpochSeconds);
+  ACU_ASSERT(round_trip[8] == -1);
+  ACU_ASSERT(round_trip[9] == -86400);
+  ACU_ASSERT(round_trip[20] == kAtcInvalidEpochSeconds);
+  ACU_ASSERT(round_trip[21] == kAtcInvalidEpochSeconds);
+}
+
+// Verify that the array functions use the explicit epoch, not the current
+// epoch year.
+ACU_TEST(test_plain_date_time_array_epoch_seconds_explicit_epoch)
+{
+  AtcEpoch epoch;
+  atc_epoch_init(&epoch, 2100);
+  atc_time_t epoch_seconds[2] = {0, 86400 + 3600};
+  AtcPlainDateTime pdts[2];
+  atc_plain_date_time_array_from_epoch_seconds(
+      &epoch, pdts, epoch_seconds, 2);
+  ACU_ASSERT(pdts[0].year == 2100);
+  ACU_ASSERT(pdts[0].month == 1);
+  ACU_ASSERT(pdts[0].day == 1);
+  ACU_ASSERT(pdts[0].hour == 0);
+  ACU_ASSERT(pdts[1].year == 2100);
+  ACU_ASSERT(pdts[1].day == 2);
+  ACU_ASSERT(pdts[1].hour == 1);
+
+  atc_time_t round_trip[2];
+  atc_plain_date_time_array_to_epoch_seconds(&epoch, pdts, 2, round_trip);
+  ACU_ASSERT(round_trip[0] == 0);
+  ACU_ASSERT(round_trip[1] == 86400 + 3600);
+}
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -314,6 +420,9 @@ int main()
 
   ACU_RUN_TEST(test_plain_date_time_to_unix_seconds);
   ACU_RUN_TEST(test_plain_date_time_from_unix_seconds);
+  ACU_RUN_TEST(test_plain_date_time_from_unix_seconds_beyond_int32);
   ACU_RUN_TEST(test_plain_date_time_to_unix_seconds_invalid);
+  ACU_RUN_TEST(test_plain_date_time_array_epoch_seconds);
+  ACU_RUN_TEST(test_plain_date_time_array_epoch_seconds_explicit_epoch);
   ACU_SUMMARY();
 }
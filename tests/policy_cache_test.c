@@ -0,0 +1,108 @@
+/*
+ * Unit tests for policy_cache.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_policy_cache_get_transition_time)
+{
+  AtcPolicyCacheEntry entries[8];
+  AtcPolicyCache cache;
+  atc_policy_cache_init(&cache, entries, 8);
+
+  // US rules in 2022: "Mar Sun>=8 2:00" and "Nov Sun>=1 2:00".
+  const AtcZonePolicy *policy = &kAtcTestingZonePolicyUS;
+  for (uint8_t i = 0; i < policy->num_rules; i++) {
+    const AtcZoneRule *rule = &policy->rules[i];
+    if (rule->from_year > 2022 || rule->to_year < 2022) continue;
+
+    AtcDateTuple expected;
+    atc_processor_get_transition_time(2022, rule, &expected);
+    AtcDateTuple dt;
+    ACU_ASSERT(atc_policy_cache_get_transition_time(
+        &cache, policy, rule, 2022, &dt));
+    ACU_ASSERT(atc_date_tuple_compare(&dt, &expected) == 0);
+    ACU_ASSERT(dt.suffix == expected.suffix);
+  }
+  ACU_ASSERT(cache.num_misses == 1);
+  ACU_ASSERT(cache.num_hits == 1);
+
+  // The most recent transition before 2022 is 2021-11-07 02:00.
+  const AtcPolicyCacheEntry *entry = atc_policy_cache_get(
+      &cache, policy, 2022);
+  ACU_ASSERT(entry != NULL);
+  ACU_ASSERT(entry->num_rules == 2);
+  ACU_ASSERT(entry->prior_rule_index != kAtcPolicyCacheNoRule);
+  ACU_ASSERT(entry->prior_time.year == 2021);
+  ACU_ASSERT(entry->prior_time.month == 11);
+  ACU_ASSERT(entry->prior_time.day == 7);
+  ACU_ASSERT(entry->prior_time.seconds == 2*3600);
+  ACU_ASSERT(cache.num_hits == 2);
+
+  // Clearing resets the entries and counters.
+  atc_policy_cache_clear(&cache);
+  ACU_ASSERT(cache.num_misses == 0);
+  ACU_ASSERT(cache.num_hits == 0);
+
+  // An empty cache never caches.
+  AtcPolicyCache empty;
+  atc_policy_cache_init(&empty, NULL, 0);
+  AtcDateTuple dt;
+  ACU_ASSERT(! atc_policy_cache_get_transition_time(
+      &empty, policy, &policy->rules[0], 2022, &dt));
+}
+
+//---------------------------------------------------------------------------
+
+// Verify that processors which share an AtcPolicyCache generate the same
+// transitions as a processor without a cache, for all zones.
+ACU_TEST(test_atc_policy_cache_matches_processor)
+{
+  AtcPolicyCacheEntry entries[64];
+  AtcPolicyCache cache;
+  atc_policy_cache_init(&cache, entries, 64);
+  AtcZoneProcessor cached;
+  atc_processor_init(&cached);
+  atc_processor_set_policy_cache(&cached, &cache);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  for (uint16_t z = 0; z < kAtcZonedb2025ZoneRegistrySize; z++) {
+    const AtcZoneInfo *info = kAtcZonedb2025ZoneRegistry[z];
+    atc_processor_init_for_zone_info(&cached, info);
+    ACU_ASSERT(cached.policy_cache == &cache);
+    atc_processor_init_for_zone_info(&processor, info);
+
+    for (int16_t year = 1900; year < 2100; year++) {
+      atc_processor_init_for_year(&cached, year);
+      atc_processor_init_for_year(&processor, year);
+      const AtcTransitionStorage *expected = &processor.transition_storage;
+      const AtcTransitionStorage *actual = &cached.transition_storage;
+      ACU_ASSERT(expected->index_free == actual->index_free);
+      for (uint8_t i = 0; i < expected->index_free; i++) {
+        const AtcTransition *e = expected->transitions[i];
+        const AtcTransition *a = actual->transitions[i];
+        ACU_ASSERT(e->start_unix_seconds == a->start_unix_seconds);
+        ACU_ASSERT(e->offset_seconds == a->offset_seconds);
+        ACU_ASSERT(e->delta_seconds == a->delta_seconds);
+        ACU_ASSERT(strcmp(e->abbrev, a->abbrev) == 0);
+      }
+    }
+  }
+  ACU_ASSERT(cache.num_hits > 0);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_policy_cache_get_transition_time);
+  ACU_RUN_TEST(test_atc_policy_cache_matches_processor);
+  ACU_SUMMARY();
+}
@@ -0,0 +1,71 @@
+/*
+ * Unit tests for registry_sort.c.
+ */
+
+#include <acunit.h>
+#include <acetimec.h>
+#include <acetimec/registry_sort.h>
+
+//---------------------------------------------------------------------------
+
+static const AtcZoneInfo * const kRegistry[] = {
+  &kAtcTestingZoneAmerica_Los_Angeles,
+  &kAtcTestingZoneAmerica_Denver,
+  &kAtcTestingZoneAmerica_Chicago,
+  &kAtcTestingZoneAmerica_New_York,
+};
+
+#define REGISTRY_SIZE (sizeof(kRegistry) / sizeof(const AtcZoneInfo *))
+
+static int compare_name(const AtcZoneInfo *a, const AtcZoneInfo *b)
+{
+  return atc_zone_name_compare(a->name, b->name);
+}
+
+static int compare_zone_id(const AtcZoneInfo *a, const AtcZoneInfo *b)
+{
+  return (a->zone_id > b->zone_id) - (a->zone_id < b->zone_id);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_registry_sort_indexes)
+{
+  uint16_t indexes[REGISTRY_SIZE];
+  atc_registry_sort_indexes(kRegistry, REGISTRY_SIZE, indexes, compare_name);
+  ACU_ASSERT(indexes[0] == 2); // Chicago
+  ACU_ASSERT(indexes[1] == 1); // Denver
+  ACU_ASSERT(indexes[2] == 0); // Los_Angeles
+  ACU_ASSERT(indexes[3] == 3); // New_York
+
+  // An empty registry, and a registry of a single zone.
+  atc_registry_sort_indexes(kRegistry, 0, indexes, compare_name);
+  atc_registry_sort_indexes(kRegistry, 1, indexes, compare_name);
+  ACU_ASSERT(indexes[0] == 0);
+}
+
+ACU_TEST(test_atc_registry_sort_indexes_zonedb)
+{
+  static uint16_t indexes[kAtcZonedb2025ZoneAndLinkRegistrySize];
+  atc_registry_sort_indexes(
+      kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize,
+      indexes,
+      compare_zone_id);
+
+  // The registry is already sorted by zone_id.
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneAndLinkRegistrySize; i++) {
+    ACU_ASSERT(indexes[i] == i);
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_registry_sort_indexes);
+  ACU_RUN_TEST(test_atc_registry_sort_indexes_zonedb);
+  ACU_SUMMARY();
+}
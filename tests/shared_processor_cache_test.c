@@ -0,0 +1,216 @@
+/*
+ * Unit tests for shared_processor_cache.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_shared_cache_get_for_year)
+{
+  AtcSharedProcessorSlot slots[4];
+  AtcSharedProcessorCache cache;
+  atc_shared_cache_init(&cache, slots, 4);
+  uint32_t g1;
+  uint32_t g2;
+
+  // The first lookup fills a slot, the second reuses it.
+  const AtcSharedProcessorSlot *s1 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2022, &g1);
+  ACU_ASSERT(s1 != NULL);
+  ACU_ASSERT(s1->processor.zone_info == &kAtcTestingZoneAmerica_Los_Angeles);
+  ACU_ASSERT(s1->processor.year == 2022);
+  const AtcSharedProcessorSlot *s2 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2022, &g2);
+  ACU_ASSERT(s1 == s2);
+  ACU_ASSERT(g1 == g2);
+  ACU_ASSERT(atc_shared_cache_is_current(s1, g1));
+
+  // Different year and different zone use different slots.
+  uint32_t g;
+  const AtcSharedProcessorSlot *s3 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2023, &g);
+  ACU_ASSERT(s3 != NULL);
+  ACU_ASSERT(s3 != s1);
+  const AtcSharedProcessorSlot *s4 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_New_York, 2022, &g);
+  ACU_ASSERT(s4 != NULL);
+  ACU_ASSERT(s4 != s1);
+  ACU_ASSERT(s4 != s3);
+
+  // The same zone_id in a different zone database uses a different slot.
+  const AtcSharedProcessorSlot *s5 = atc_shared_cache_get_for_year(
+      &cache, &kAtcZonedb2025ZoneAmerica_Los_Angeles, 2022, &g);
+  ACU_ASSERT(s5 != NULL);
+  ACU_ASSERT(s5 != s1);
+  ACU_ASSERT(s5->processor.zone_info == &kAtcZonedb2025ZoneAmerica_Los_Angeles);
+
+  // Out of range.
+  ACU_ASSERT(NULL == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 0, &g));
+  ACU_ASSERT(NULL == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 10000, &g));
+}
+
+ACU_TEST(test_atc_shared_cache_full)
+{
+  AtcSharedProcessorSlot slots[2];
+  AtcSharedProcessorCache cache;
+  atc_shared_cache_init(&cache, slots, 2);
+  uint32_t g2020;
+  uint32_t g2021;
+  uint32_t g2022;
+  uint32_t g;
+
+  const AtcSharedProcessorSlot *s2020 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2020, &g2020);
+  const AtcSharedProcessorSlot *s2021 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2021, &g2021);
+  ACU_ASSERT(s2020 != NULL);
+  ACU_ASSERT(s2021 != NULL);
+  ACU_ASSERT(s2020 != s2021);
+
+  // The window is full, so the oldest slot is reclaimed, and a reader which
+  // still holds the previous generation rejects it.
+  const AtcSharedProcessorSlot *s2022 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2022, &g2022);
+  ACU_ASSERT(s2022 == s2020);
+  ACU_ASSERT(s2022->processor.year == 2022);
+  ACU_ASSERT(g2022 != g2020);
+  ACU_ASSERT(! atc_shared_cache_is_current(s2020, g2020));
+  ACU_ASSERT(atc_shared_cache_is_current(s2022, g2022));
+
+  // The newer slot is kept, and the next miss reclaims the now oldest one.
+  ACU_ASSERT(s2021 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2021, &g));
+  ACU_ASSERT(g == g2021);
+  ACU_ASSERT(s2021 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2020, &g));
+  ACU_ASSERT(s2021->processor.year == 2020);
+  ACU_ASSERT(! atc_shared_cache_is_current(s2021, g2021));
+
+  // Lookups through the reclaimed slots.
+  AtcZoneProcessor scratch;
+  atc_processor_init(&scratch);
+  AtcPlainDateTime pdt = {2022, 3, 13, 2, 30, 0};
+  AtcFindResult result;
+  char abbrev[kAtcAbbrevSize];
+  atc_shared_cache_find_by_plain_date_time(
+      &cache, &scratch, &kAtcTestingZoneAmerica_Los_Angeles, &pdt,
+      kAtcDisambiguateCompatible, &result, abbrev);
+  ACU_ASSERT(result.type == kAtcFindResultGap);
+  ACU_ASSERT(result.dst_offset_seconds == 3600);
+  ACU_ASSERT(result.abbrev == abbrev);
+  ACU_ASSERT(strcmp(abbrev, "PDT") == 0);
+  // The scratch processor was not needed.
+  ACU_ASSERT(scratch.zone_info == NULL);
+
+  // Clearing makes the slots empty again.
+  atc_shared_cache_clear(&cache);
+  ACU_ASSERT(NULL != atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2022, &g));
+}
+
+ACU_TEST(test_atc_shared_cache_epoch_change)
+{
+  int16_t saved_epoch_year = atc_get_current_epoch_year();
+  atc_set_current_epoch_year(2050);
+  AtcSharedProcessorSlot slots[2];
+  AtcSharedProcessorCache cache;
+  atc_shared_cache_init(&cache, slots, 2);
+  uint32_t g2020;
+  uint32_t g;
+
+  const AtcSharedProcessorSlot *s2020 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2020, &g2020);
+  const AtcSharedProcessorSlot *s2021 = atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2021, &g);
+
+  // After a change of the epoch, the slots are used again without
+  // atc_shared_cache_clear(). The same key is filled again for the new epoch
+  // year, in the oldest slot.
+  atc_set_current_epoch_year(2100);
+  ACU_ASSERT(s2020 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2020, &g));
+  ACU_ASSERT(g != g2020);
+  ACU_ASSERT(s2020->epoch_year == 2100);
+  ACU_ASSERT(s2020 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2020, &g));
+
+  // A slot of another epoch year is reclaimed before an older slot of the
+  // current epoch year.
+  atc_set_current_epoch_year(2050);
+  ACU_ASSERT(s2021 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2021, &g));
+  ACU_ASSERT(s2020 == atc_shared_cache_get_for_year(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles, 2022, &g));
+  ACU_ASSERT(s2020->epoch_year == 2050);
+  ACU_ASSERT(s2020->processor.year == 2022);
+  ACU_ASSERT(s2021->processor.year == 2021);
+
+  atc_set_current_epoch_year(saved_epoch_year);
+}
+
+// Verify that the cache returns the same results as an AtcZoneProcessor.
+ACU_TEST(test_atc_shared_cache_matches_processor)
+{
+  AtcSharedProcessorSlot slots[64];
+  AtcSharedProcessorCache cache;
+  atc_shared_cache_init(&cache, slots, 64);
+  AtcZoneProcessor scratch;
+  atc_processor_init(&scratch);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  char abbrev[kAtcAbbrevSize];
+
+  for (uint16_t i = 0; i < kAtcTestingZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcTestingZoneRegistry[i];
+    atc_processor_init_for_zone_info(&processor, info);
+
+    AtcPlainDateTime pdt = {2020, 1, 1, 0, 0, 0};
+    atc_time_t start = atc_plain_date_time_to_epoch_seconds(&pdt);
+    pdt.year = 2024;
+    atc_time_t until = atc_plain_date_time_to_epoch_seconds(&pdt);
+
+    for (atc_time_t t = start; t < until; t += 5 * 3600) {
+      AtcFindResult expected;
+      AtcFindResult actual;
+      atc_processor_find_by_epoch_seconds(&processor, t, &expected);
+      atc_shared_cache_find_by_epoch_seconds(
+          &cache, &scratch, info, t, &actual, abbrev);
+      ACU_ASSERT(expected.type == actual.type);
+      ACU_ASSERT(expected.fold == actual.fold);
+      ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+      ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+
+      atc_plain_date_time_from_epoch_seconds(&pdt, t);
+      atc_processor_find_by_plain_date_time(
+          &processor, &pdt, kAtcDisambiguateLater, &expected);
+      atc_shared_cache_find_by_plain_date_time(
+          &cache, &scratch, info, &pdt, kAtcDisambiguateLater, &actual,
+          abbrev);
+      ACU_ASSERT(expected.type == actual.type);
+      ACU_ASSERT(expected.fold == actual.fold);
+      ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+      ACU_ASSERT(
+          expected.req_dst_offset_seconds == actual.req_dst_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_shared_cache_get_for_year);
+  ACU_RUN_TEST(test_atc_shared_cache_full);
+  ACU_RUN_TEST(test_atc_shared_cache_epoch_change);
+  ACU_RUN_TEST(test_atc_shared_cache_matches_processor);
+  ACU_SUMMARY();
+}
@@ -0,0 +1,222 @@
+/*
+ * Unit tests for steady_state.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_steady_state_init_los_angeles)
+{
+  AtcSteadyState state;
+  int8_t err = atc_steady_state_init(
+      &state, &kAtcTestingZoneAmerica_Los_Angeles);
+  ACU_ASSERT(err == kAtcErrOk);
+  // The US rules last changed in 2007.
+  ACU_ASSERT(state.start_year == 2009);
+  ACU_ASSERT(state.std_offset_seconds == -8*3600);
+  ACU_ASSERT(state.rules[0]->in_month == 3);
+  ACU_ASSERT(state.rules[1]->in_month == 11);
+  ACU_ASSERT(strcmp(state.abbrevs[0], "PDT") == 0);
+  ACU_ASSERT(strcmp(state.abbrevs[1], "PST") == 0);
+  ACU_ASSERT(! atc_steady_state_is_valid_for_year(&state, 2008));
+  ACU_ASSERT(atc_steady_state_is_valid_for_year(&state, 2009));
+  ACU_ASSERT(atc_steady_state_is_valid_for_year(&state, 9998));
+  ACU_ASSERT(! atc_steady_state_is_valid_for_year(&state, 9999));
+
+  int64_t unix_seconds[2];
+  atc_steady_state_transitions_for_year(&state, 2022, unix_seconds);
+  ACU_ASSERT(unix_seconds[0] == 1647165600); // 2022-03-13 02:00 PST
+  ACU_ASSERT(unix_seconds[1] == 1667725200); // 2022-11-06 02:00 PDT
+}
+
+ACU_TEST(test_atc_steady_state_init_no_steady_state)
+{
+  AtcSteadyState state;
+
+  // Fixed offset.
+  int8_t err = atc_steady_state_init(&state, &kAtcTestingZoneEtc_UTC);
+  ACU_ASSERT(err == kAtcErrGeneric);
+  ACU_ASSERT(state.start_year == kAtcInvalidYear);
+  ACU_ASSERT(! atc_steady_state_is_valid_for_year(&state, 2022));
+
+  err = atc_steady_state_init(&state, NULL);
+  ACU_ASSERT(err == kAtcErrGeneric);
+
+  AtcFindResult result;
+  AtcPlainDateTime pdt = {2022, 6, 1, 0, 0, 0};
+  atc_steady_state_find_by_plain_date_time(
+      &state, &pdt, kAtcDisambiguateCompatible, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+  atc_steady_state_find_by_unix_seconds(&state, 1654041600, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+}
+
+ACU_TEST(test_atc_steady_state_find_los_angeles)
+{
+  AtcSteadyState state;
+  atc_steady_state_init(&state, &kAtcTestingZoneAmerica_Los_Angeles);
+  AtcFindResult result;
+
+  // Overlap during fall back.
+  atc_steady_state_find_by_unix_seconds(&state, 1667725200 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 0);
+  ACU_ASSERT(result.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+  atc_steady_state_find_by_unix_seconds(&state, 1667725200, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 1);
+  ACU_ASSERT(result.dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(result.abbrev, "PST") == 0);
+
+  // Gap during spring forward.
+  AtcPlainDateTime pdt = {2022, 3, 13, 2, 30, 0};
+  atc_steady_state_find_by_plain_date_time(
+      &state, &pdt, kAtcDisambiguateCompatible, &result);
+  ACU_ASSERT(result.type == kAtcFindResultGap);
+  ACU_ASSERT(result.fold == 0);
+  ACU_ASSERT(result.req_dst_offset_seconds == 0);
+  ACU_ASSERT(result.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+
+  // Before the steady state.
+  atc_steady_state_find_by_unix_seconds(&state, 1167609600, &result); // 2007
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+}
+
+ACU_TEST(test_atc_steady_state_find_at_year_boundaries)
+{
+  AtcSteadyState state;
+  atc_steady_state_init(&state, &kAtcTestingZoneAmerica_Los_Angeles);
+  AtcFindResult result;
+
+  // The steady state starts at 2009-01-01 00:00 UTC.
+  atc_steady_state_find_by_unix_seconds(&state, 1230768000 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+  atc_steady_state_find_by_unix_seconds(&state, 1230768000, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(strcmp(result.abbrev, "PST") == 0);
+
+  // The last second of the cached year 2022, then the first second of 2023,
+  // which replaces the cached window.
+  atc_steady_state_find_by_unix_seconds(&state, 1654041600, &result);
+  atc_steady_state_find_by_unix_seconds(&state, 1672531200 - 1, &result);
+  ACU_ASSERT(state.window_year == 2022);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1667725200);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1678615200);
+  atc_steady_state_find_by_unix_seconds(&state, 1672531200, &result);
+  ACU_ASSERT(state.window_year == 2023);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1667725200);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1678615200);
+
+  // The year 9999 is not in the steady state.
+  int64_t year9999 = (int64_t) 86400 * atc_plain_date_to_unix_days(9999, 1, 1);
+  atc_steady_state_find_by_unix_seconds(&state, year9999 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  atc_steady_state_find_by_unix_seconds(&state, year9999, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+}
+
+//---------------------------------------------------------------------------
+
+static void assert_find_results_equal(
+    AcuContext *acu_context,
+    const AtcFindResult *expected,
+    const AtcFindResult *actual)
+{
+  ACU_ASSERT(expected->type == actual->type);
+  if (expected->type == kAtcFindResultNotFound) return;
+  ACU_ASSERT(expected->fold == actual->fold);
+  ACU_ASSERT(expected->std_offset_seconds == actual->std_offset_seconds);
+  ACU_ASSERT(expected->dst_offset_seconds == actual->dst_offset_seconds);
+  ACU_ASSERT(
+      expected->req_std_offset_seconds == actual->req_std_offset_seconds);
+  ACU_ASSERT(
+      expected->req_dst_offset_seconds == actual->req_dst_offset_seconds);
+  ACU_ASSERT(strcmp(expected->abbrev, actual->abbrev) == 0);
+}
+
+// Verify that the steady state returns the same results as the transitions of
+// the AtcZoneProcessor, around each transition, for all zones with a steady
+// state.
+ACU_TEST(test_atc_steady_state_matches_processor)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  const uint8_t disambiguates[] = {
+    kAtcDisambiguateCompatible,
+    kAtcDisambiguateEarlier,
+    kAtcDisambiguateLater,
+    kAtcDisambiguateReversed,
+  };
+  uint16_t num_steady = 0;
+
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcZonedb2025ZoneRegistry[i];
+    AtcSteadyState state;
+    if (atc_steady_state_init(&state, info)) continue;
+    num_steady++;
+
+    // Disable the steady state of the processor.
+    atc_processor_init_for_zone_info(&processor, info);
+    atc_processor_disable_steady_state(&processor);
+
+    int16_t until_year = state.start_year + 30;
+    for (int16_t year = state.start_year; year < until_year; year++) {
+      int64_t transitions[2];
+      atc_steady_state_transitions_for_year(&state, year, transitions);
+      for (uint8_t t = 0; t < 2; t++) {
+        for (int32_t delta = -7200; delta <= 7200; delta += 900) {
+          for (int32_t nudge = -1; nudge <= 0; nudge++) {
+            int64_t unix_seconds = transitions[t] + delta + nudge;
+            atc_time_t epoch_seconds =
+                atc_epoch_seconds_from_unix_seconds(unix_seconds);
+            AtcFindResult expected;
+            AtcFindResult actual;
+            atc_processor_find_by_epoch_seconds(
+                &processor, epoch_seconds, &expected);
+            atc_steady_state_find_by_unix_seconds(
+                &state, unix_seconds, &actual);
+            ACU_ASSERT_NO_FATAL_FAILURE(assert_find_results_equal(
+                acu_context, &expected, &actual));
+
+            // Interpret the UTC date-time as a wall time to cover the gaps and
+            // overlaps near the transition.
+            AtcPlainDateTime pdt;
+            atc_plain_date_time_from_unix_seconds(
+                &pdt, unix_seconds + state.std_offset_seconds);
+            if (! atc_steady_state_is_valid_for_year(&state, pdt.year)) {
+              continue;
+            }
+            for (uint8_t d = 0; d < 4; d++) {
+              atc_processor_find_by_plain_date_time(
+                  &processor, &pdt, disambiguates[d], &expected);
+              atc_steady_state_find_by_plain_date_time(
+                  &state, &pdt, disambiguates[d], &actual);
+              ACU_ASSERT_NO_FATAL_FAILURE(assert_find_results_equal(
+                acu_context, &expected, &actual));
+            }
+          }
+        }
+      }
+    }
+  }
+  ACU_ASSERT(num_steady > 0);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_steady_state_init_los_angeles);
+  ACU_RUN_TEST(test_atc_steady_state_init_no_steady_state);
+  ACU_RUN_TEST(test_atc_steady_state_find_los_angeles);
+  ACU_RUN_TEST(test_atc_steady_state_find_at_year_boundaries);
+  ACU_RUN_TEST(test_atc_steady_state_matches_processor);
+  ACU_SUMMARY();
+}
@@ -90,7 +90,8 @@ ACU_TEST(test_atc_time_zone_print_los_angeles)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   char buf[80];
   AtcStringBuffer sb;
@@ -105,7 +106,8 @@ ACU_TEST(test_atc_time_zone_offset_date_time_from_epoch_seconds_los_angeles)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   atc_time_t epoch_seconds = 0;
   AtcOffsetDateTime odt;
@@ -126,7 +128,8 @@ ACU_TEST(test_atc_time_zone_offset_date_time_from_plain_date_time_los_angeles)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2023, 2, 14, 12, 32, 0};
   AtcOffsetDateTime odt;
@@ -148,7 +151,8 @@ ACU_TEST(test_atc_time_zone_zoned_extra_from_epoch_seconds_los_angeles)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   atc_time_t epoch_seconds = 0;
   AtcZonedExtra extra;
@@ -167,7 +171,8 @@ ACU_TEST(test_atc_time_zone_zoned_extra_from_plain_date_time_los_angeles)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2023, 2, 14, 12, 32, 0};
   AtcZonedExtra extra;
@@ -185,6 +190,126 @@ ACU_TEST(test_atc_time_zone_zoned_extra_from_plain_date_time_los_angeles)
 
 //---------------------------------------------------------------------------
 
+ACU_TEST(test_atc_time_zone_for_zone_info_classifies)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+  ACU_ASSERT(tz.type == kAtcTimeZoneTypeProcessor);
+
+  tz = atc_time_zone_for_zone_info(&kAtcTestingZoneEtc_UTC, &processor);
+  ACU_ASSERT(tz.type == kAtcTimeZoneTypeFixed);
+  ACU_ASSERT(tz.std_offset_seconds == 0);
+  ACU_ASSERT(tz.dst_offset_seconds == 0);
+
+  tz = atc_time_zone_for_zone_info(NULL, NULL);
+  ACU_ASSERT(tz.type == kAtcTimeZoneTypeFixed);
+}
+
+ACU_TEST(test_atc_time_zone_fixed)
+{
+  AtcTimeZone tz = atc_time_zone_fixed(5*3600 + 30*60);
+  ACU_ASSERT(tz.type == kAtcTimeZoneTypeFixed);
+  ACU_ASSERT(tz.zone_processor == NULL);
+
+  char buf[80];
+  AtcStringBuffer sb;
+  atc_buf_init(&sb, buf, 80);
+  atc_time_zone_print(&sb, &tz);
+  atc_buf_close(&sb);
+  ACU_ASSERT(strcmp(sb.p, "+0530") == 0);
+
+  AtcOffsetDateTime odt;
+  atc_time_zone_offset_date_time_from_epoch_seconds(&tz, 0, &odt);
+  ACU_ASSERT(! atc_offset_date_time_is_error(&odt));
+  ACU_ASSERT(odt.year == 2050);
+  ACU_ASSERT(odt.month == 1);
+  ACU_ASSERT(odt.day == 1);
+  ACU_ASSERT(odt.hour == 5);
+  ACU_ASSERT(odt.minute == 30);
+  ACU_ASSERT(odt.offset_seconds == 5*3600 + 30*60);
+  ACU_ASSERT(odt.resolved == kAtcResolvedUnique);
+
+  AtcPlainDateTime pdt = {2023, 2, 14, 12, 32, 0};
+  atc_time_zone_offset_date_time_from_plain_date_time(
+      &tz, &pdt, kAtcDisambiguateCompatible, &odt);
+  ACU_ASSERT(! atc_offset_date_time_is_error(&odt));
+  ACU_ASSERT(odt.hour == 12);
+  ACU_ASSERT(odt.offset_seconds == 5*3600 + 30*60);
+
+  AtcZonedExtra extra;
+  atc_time_zone_zoned_extra_from_plain_date_time(
+      &tz, &pdt, kAtcDisambiguateCompatible, &extra);
+  ACU_ASSERT(! atc_zoned_extra_is_error(&extra));
+  ACU_ASSERT(extra.resolved == kAtcResolvedUnique);
+  ACU_ASSERT(extra.std_offset_seconds == 5*3600 + 30*60);
+  ACU_ASSERT(extra.dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(extra.abbrev, "+0530") == 0);
+
+  // An offset of 0 is "UTC".
+  tz = atc_time_zone_fixed(0);
+  atc_time_zone_zoned_extra_from_epoch_seconds(&tz, 0, &extra);
+  ACU_ASSERT(strcmp(extra.abbrev, "UTC") == 0);
+}
+
+// Verify that the fixed-offset fast path returns the same results as the
+// AtcZoneProcessor for all fixed-offset zones and links.
+ACU_TEST(test_atc_time_zone_fixed_matches_processor)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  uint16_t num_fixed = 0;
+
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneAndLinkRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcZonedb2025ZoneAndLinkRegistry[i];
+    AtcTimeZone tz = atc_time_zone_for_zone_info(info, &processor);
+    if (tz.type != kAtcTimeZoneTypeFixed) continue;
+    num_fixed++;
+
+    // Force the use of the processor.
+    AtcTimeZone ptz = tz;
+    ptz.type = kAtcTimeZoneTypeProcessor;
+
+    AtcPlainDateTime pdt = {2000, 3, 1, 2, 30, 0};
+    for (int16_t year = 2000; year < 2100; year += 7) {
+      pdt.year = year;
+      AtcZonedExtra expected;
+      AtcZonedExtra actual;
+      atc_time_zone_zoned_extra_from_plain_date_time(
+          &ptz, &pdt, kAtcDisambiguateCompatible, &expected);
+      atc_time_zone_zoned_extra_from_plain_date_time(
+          &tz, &pdt, kAtcDisambiguateCompatible, &actual);
+      ACU_ASSERT(expected.resolved == actual.resolved);
+      ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+      ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+
+      atc_time_t epoch_seconds = atc_plain_date_time_to_epoch_seconds(&pdt);
+      atc_time_zone_zoned_extra_from_epoch_seconds(
+          &ptz, epoch_seconds, &expected);
+      atc_time_zone_zoned_extra_from_epoch_seconds(
+          &tz, epoch_seconds, &actual);
+      ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+      ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+
+      // The unclassified {zone_info, zone_processor} form is equivalent.
+      AtcTimeZone utz = {
+        info, &processor, kAtcTimeZoneTypeUnclassified, 0, 0, NULL
+      };
+      atc_time_zone_zoned_extra_from_epoch_seconds(
+          &utz, epoch_seconds, &actual);
+      ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+    }
+  }
+  ACU_ASSERT(num_fixed > 0);
+}
+
+//---------------------------------------------------------------------------
+
 ACU_CONTEXT();
 
 int main()
@@ -200,5 +325,9 @@ int main()
   ACU_RUN_TEST(test_atc_time_zone_offset_date_time_from_plain_date_time_los_angeles);
   ACU_RUN_TEST(test_atc_time_zone_zoned_extra_from_epoch_seconds_los_angeles);
   ACU_RUN_TEST(test_atc_time_zone_zoned_extra_from_plain_date_time_los_angeles);
+
+  ACU_RUN_TEST(test_atc_time_zone_for_zone_info_classifies);
+  ACU_RUN_TEST(test_atc_time_zone_fixed);
+  ACU_RUN_TEST(test_atc_time_zone_fixed_matches_processor);
   ACU_SUMMARY();
 }
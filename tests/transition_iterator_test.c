@@ -0,0 +1,234 @@
+/*
+ * Unit tests for transition_iterator.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_transition_iterator_los_angeles)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTransitionIterator it;
+  int8_t err = atc_transition_iterator_init(
+      &it, &processor, &kAtcTestingZoneAmerica_Los_Angeles,
+      1640995200 /*2022-01-01*/, 1704067200 /*2024-01-01*/);
+  ACU_ASSERT(err == kAtcErrOk);
+
+  AtcZoneTransition t;
+  // 2022-03-13 02:00 PST
+  ACU_ASSERT(atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1647165600);
+  ACU_ASSERT(t.std_offset_seconds == -8*3600);
+  ACU_ASSERT(t.dst_offset_seconds == 3600);
+  ACU_ASSERT(t.prev_std_offset_seconds == -8*3600);
+  ACU_ASSERT(t.prev_dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(t.abbrev, "PDT") == 0);
+  // 2022-11-06 02:00 PDT
+  ACU_ASSERT(atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1667725200);
+  ACU_ASSERT(t.dst_offset_seconds == 0);
+  ACU_ASSERT(t.prev_dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(t.abbrev, "PST") == 0);
+  // 2023-03-12, 2023-11-05
+  ACU_ASSERT(atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1678615200);
+  ACU_ASSERT(atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1699174800);
+  ACU_ASSERT(! atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(! atc_transition_iterator_next(&it, &t));
+
+  // The start is inclusive, the until is exclusive.
+  err = atc_transition_iterator_init(
+      &it, &processor, &kAtcTestingZoneAmerica_Los_Angeles,
+      1647165600, 1667725200);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(atc_transition_iterator_next(&it, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1647165600);
+  ACU_ASSERT(! atc_transition_iterator_next(&it, &t));
+}
+
+ACU_TEST(test_atc_transition_iterator_errors)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTransitionIterator it;
+  AtcZoneTransition t;
+
+  // Year 0 is out of range.
+  int8_t err = atc_transition_iterator_init(
+      &it, &processor, &kAtcTestingZoneAmerica_Los_Angeles,
+      -62167219200 /*0000-01-01*/, 0);
+  ACU_ASSERT(err == kAtcErrGeneric);
+  ACU_ASSERT(! atc_transition_iterator_next(&it, &t));
+
+  // Empty interval.
+  err = atc_transition_iterator_init(
+      &it, &processor, &kAtcTestingZoneAmerica_Los_Angeles,
+      1640995200, 1640995200);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(! atc_transition_iterator_next(&it, &t));
+}
+
+// The iterator must return the same transitions as the AtcTransitionTable,
+// and the offsets before and after each transition must match the processor.
+ACU_TEST(test_atc_transition_iterator_matches_table)
+{
+  AtcTransitionTableEntry entries[128];
+  char abbrevs[8][kAtcAbbrevSize];
+  AtcTransitionTable table;
+  atc_transition_table_init(&table, entries, 128, abbrevs, 8);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcZoneProcessor check;
+  atc_processor_init(&check);
+
+  int64_t start = 946684800; // 2000-01-01
+  int64_t until = 2208988800; // 2040-01-01
+  for (uint16_t i = 0; i < kAtcTestingZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcTestingZoneRegistry[i];
+    int8_t err = atc_transition_table_build(
+        &table, &processor, info, 2000, 2040);
+    ACU_ASSERT(err == kAtcErrOk);
+    atc_processor_init_for_zone_info(&check, info);
+
+    AtcTransitionIterator it;
+    err = atc_transition_iterator_init(&it, &processor, info, start, until);
+    ACU_ASSERT(err == kAtcErrOk);
+
+    // The first entry of the table is clamped to the start.
+    uint16_t j = 1;
+    AtcZoneTransition t;
+    while (atc_transition_iterator_next(&it, &t)) {
+      ACU_ASSERT(j < table.num_entries);
+      const AtcTransitionTableEntry *entry = &table.entries[j];
+      ACU_ASSERT(t.start_unix_seconds == entry->start_unix_seconds);
+      ACU_ASSERT(t.std_offset_seconds == entry->std_offset_seconds);
+      ACU_ASSERT(t.dst_offset_seconds == entry->dst_offset_seconds);
+      ACU_ASSERT(strcmp(t.abbrev, table.abbrevs[entry->abbrev_index]) == 0);
+
+      AtcFindResult result;
+      atc_processor_find_by_unix_seconds(
+          &check, t.start_unix_seconds - 1, &result);
+      ACU_ASSERT(result.std_offset_seconds == t.prev_std_offset_seconds);
+      ACU_ASSERT(result.dst_offset_seconds == t.prev_dst_offset_seconds);
+      j++;
+    }
+    ACU_ASSERT(j == table.num_entries);
+  }
+}
+
+ACU_TEST(test_atc_zone_transition_find_next_prev_los_angeles)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+  AtcZoneTransition t;
+
+  // 2022-01-01 -> 2022-03-13 02:00 PST
+  ACU_ASSERT(atc_time_zone_next_transition(&tz, 1640995200, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1647165600);
+  ACU_ASSERT(t.dst_offset_seconds == 3600);
+  ACU_ASSERT(t.prev_dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(t.abbrev, "PDT") == 0);
+  // Strictly after the instant.
+  ACU_ASSERT(atc_time_zone_next_transition(&tz, 1647165600, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1667725200);
+
+  // At or before the instant.
+  ACU_ASSERT(atc_time_zone_prev_transition(&tz, 1647165600, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1647165600);
+  // 2021-11-07 02:00 PDT
+  ACU_ASSERT(atc_time_zone_prev_transition(&tz, 1647165600 - 1, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1636275600);
+  ACU_ASSERT(t.dst_offset_seconds == 0);
+  ACU_ASSERT(t.prev_dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(t.abbrev, "PST") == 0);
+
+  // Fixed-offset zones have no transitions.
+  AtcTimeZone utc = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
+  ACU_ASSERT(! atc_time_zone_next_transition(&utc, 1640995200, &t));
+  ACU_ASSERT(! atc_time_zone_prev_transition(&utc, 1640995200, &t));
+  ACU_ASSERT(! atc_time_zone_next_transition(
+      &atc_time_zone_utc, 1640995200, &t));
+}
+
+static bool is_same_transition(
+    const AtcZoneTransition *a,
+    const AtcZoneTransition *b)
+{
+  return a->start_unix_seconds == b->start_unix_seconds
+      && a->std_offset_seconds == b->std_offset_seconds
+      && a->dst_offset_seconds == b->dst_offset_seconds
+      && a->prev_std_offset_seconds == b->prev_std_offset_seconds
+      && a->prev_dst_offset_seconds == b->prev_dst_offset_seconds
+      && strcmp(a->abbrev, b->abbrev) == 0;
+}
+
+// The next and previous transitions around each transition returned by the
+// iterator must be the neighbors returned by the iterator.
+ACU_TEST(test_atc_zone_transition_find_next_prev_matches_iterator)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcZoneProcessor search;
+  atc_processor_init(&search);
+
+  int64_t start = 946684800; // 2000-01-01
+  int64_t until = 2524608000; // 2050-01-01
+  for (uint16_t i = 0; i < kAtcZonedb2000ZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcZonedb2000ZoneRegistry[i];
+    AtcTransitionIterator it;
+    int8_t err = atc_transition_iterator_init(
+        &it, &processor, info, start, until);
+    ACU_ASSERT(err == kAtcErrOk);
+
+    AtcZoneTransition prev;
+    bool has_prev = false;
+    AtcZoneTransition t;
+    AtcZoneTransition found;
+    while (atc_transition_iterator_next(&it, &t)) {
+      int64_t s = t.start_unix_seconds;
+      ACU_ASSERT(atc_zone_transition_find_next(&search, info, s - 1, &found));
+      ACU_ASSERT(is_same_transition(&found, &t));
+      ACU_ASSERT(atc_zone_transition_find_prev(&search, info, s, &found));
+      ACU_ASSERT(is_same_transition(&found, &t));
+      if (has_prev) {
+        ACU_ASSERT(atc_zone_transition_find_next(
+            &search, info, prev.start_unix_seconds, &found));
+        ACU_ASSERT(is_same_transition(&found, &t));
+        ACU_ASSERT(atc_zone_transition_find_prev(
+            &search, info, s - 1, &found));
+        ACU_ASSERT(is_same_transition(&found, &prev));
+      }
+      prev = t;
+      has_prev = true;
+    }
+
+    // Nothing between the last transition and the end of the interval.
+    if (has_prev
+        && atc_zone_transition_find_next(
+            &search, info, prev.start_unix_seconds, &found)) {
+      ACU_ASSERT(found.start_unix_seconds >= until);
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_transition_iterator_los_angeles);
+  ACU_RUN_TEST(test_atc_transition_iterator_errors);
+  ACU_RUN_TEST(test_atc_transition_iterator_matches_table);
+  ACU_RUN_TEST(test_atc_zone_transition_find_next_prev_los_angeles);
+  ACU_RUN_TEST(test_atc_zone_transition_find_next_prev_matches_iterator);
+  ACU_SUMMARY();
+}
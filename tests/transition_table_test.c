@@ -0,0 +1,159 @@
+/*
+ * Unit tests for transition_table.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_transition_table_build_los_angeles)
+{
+  AtcTransitionTableEntry entries[16];
+  char abbrevs[4][kAtcAbbrevSize];
+  AtcTransitionTable table;
+  atc_transition_table_init(&table, entries, 16, abbrevs, 4);
+
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  int8_t err = atc_transition_table_build(
+      &table, &processor, &kAtcTestingZoneAmerica_Los_Angeles, 2022, 2024);
+  ACU_ASSERT(err == kAtcErrOk);
+
+  // Jan 1 (PST, clamped), and 2 transitions per year.
+  ACU_ASSERT(table.num_entries == 5);
+  ACU_ASSERT(table.num_abbrevs == 2);
+  ACU_ASSERT(table.entries[0].start_unix_seconds == 1640995200); // 2022-01-01
+  ACU_ASSERT(table.entries[0].std_offset_seconds == -8*3600);
+  ACU_ASSERT(table.entries[0].dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(table.abbrevs[table.entries[0].abbrev_index], "PST") == 0);
+  // 2022-03-13 02:00 PST
+  ACU_ASSERT(table.entries[1].start_unix_seconds == 1647165600);
+  ACU_ASSERT(table.entries[1].dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(table.abbrevs[table.entries[1].abbrev_index], "PDT") == 0);
+  // 2022-11-06 02:00 PDT
+  ACU_ASSERT(table.entries[2].start_unix_seconds == 1667725200);
+  ACU_ASSERT(table.until_unix_seconds == 1704067200); // 2024-01-01
+
+  // Overlap during fall back.
+  AtcFindResult result;
+  atc_transition_table_find_by_unix_seconds(&table, 1667725200 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 0);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+  atc_transition_table_find_by_unix_seconds(&table, 1667725200, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 1);
+  ACU_ASSERT(strcmp(result.abbrev, "PST") == 0);
+  atc_transition_table_find_by_unix_seconds(&table, 1667725200 + 3600, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(result.fold == 0);
+  // Valid until 2023-03-12 02:00 PST.
+  ACU_ASSERT(result.valid_from_unix_seconds == 1667725200);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1678615200);
+  // The last entry is valid until the end of the table.
+  atc_transition_table_find_by_unix_seconds(&table, 1704067200 - 1, &result);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1699174800);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1704067200);
+
+  // Outside of the table.
+  atc_transition_table_find_by_unix_seconds(&table, 1640995200 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+  atc_transition_table_find_by_unix_seconds(&table, 1704067200, &result);
+  ACU_ASSERT(result.type == kAtcFindResultNotFound);
+}
+
+ACU_TEST(test_atc_transition_table_build_errors)
+{
+  AtcTransitionTableEntry entries[4];
+  char abbrevs[4][kAtcAbbrevSize];
+  AtcTransitionTable table;
+  atc_transition_table_init(&table, entries, 4, abbrevs, 4);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  // Too many transitions for the buffer.
+  int8_t err = atc_transition_table_build(
+      &table, &processor, &kAtcTestingZoneAmerica_Los_Angeles, 2000, 2010);
+  ACU_ASSERT(err == kAtcErrGeneric);
+  ACU_ASSERT(table.num_entries == 0);
+
+  // Invalid year range.
+  err = atc_transition_table_build(
+      &table, &processor, &kAtcTestingZoneAmerica_Los_Angeles, 2010, 2010);
+  ACU_ASSERT(err == kAtcErrGeneric);
+  err = atc_transition_table_build(
+      &table, &processor, &kAtcTestingZoneAmerica_Los_Angeles, 0, 2010);
+  ACU_ASSERT(err == kAtcErrGeneric);
+}
+
+// Verify that lookups through the table return the same results as the
+// AtcZoneProcessor, sampling every 3 hours, and around each transition.
+ACU_TEST(test_atc_transition_table_find_matches_processor)
+{
+  AtcTransitionTableEntry entries[128];
+  char abbrevs[8][kAtcAbbrevSize];
+  AtcTransitionTable table;
+  atc_transition_table_init(&table, entries, 128, abbrevs, 8);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcZoneProcessor check;
+  atc_processor_init(&check);
+
+  for (uint16_t i = 0; i < kAtcTestingZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcTestingZoneRegistry[i];
+    int8_t err = atc_transition_table_build(
+        &table, &processor, info, 2000, 2040);
+    ACU_ASSERT(err == kAtcErrOk);
+    atc_processor_init_for_zone_info(&check, info);
+
+    AtcPlainDateTime pdt = {2000, 1, 1, 0, 0, 0};
+    atc_time_t start = atc_plain_date_time_to_epoch_seconds(&pdt);
+    pdt.year = 2040;
+    atc_time_t until = atc_plain_date_time_to_epoch_seconds(&pdt);
+
+    for (atc_time_t t = start; t < until; t += 3 * 3600) {
+      AtcFindResult expected;
+      AtcFindResult actual;
+      atc_processor_find_by_epoch_seconds(&check, t, &expected);
+      atc_transition_table_find_by_epoch_seconds(&table, t, &actual);
+      ACU_ASSERT(expected.type == actual.type);
+      ACU_ASSERT(expected.fold == actual.fold);
+      ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+      ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+      ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+    }
+
+    for (uint16_t j = 1; j < table.num_entries; j++) {
+      atc_time_t transition = atc_epoch_seconds_from_unix_seconds(
+          table.entries[j].start_unix_seconds);
+      for (int32_t delta = -7200; delta <= 7200; delta += 1800) {
+        for (int32_t nudge = -1; nudge <= 0; nudge++) {
+          atc_time_t t = transition + delta + nudge;
+          AtcFindResult expected;
+          AtcFindResult actual;
+          atc_processor_find_by_epoch_seconds(&check, t, &expected);
+          atc_transition_table_find_by_epoch_seconds(&table, t, &actual);
+          ACU_ASSERT(expected.type == actual.type);
+          ACU_ASSERT(expected.fold == actual.fold);
+          ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+          ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+          ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+        }
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_transition_table_build_los_angeles);
+  ACU_RUN_TEST(test_atc_transition_table_build_errors);
+  ACU_RUN_TEST(test_atc_transition_table_find_matches_processor);
+  ACU_SUMMARY();
+}
@@ -466,6 +466,70 @@ ACU_TEST(test_atc_transition_storage_reset_candidate_pool)
   ACU_ASSERT(2 == ts.index_free);
 }
 
+// Verify that the key-based finders, and the unix seconds finder of
+// AtcTransitionStorage, return the same results as the linear finders of
+// AtcTransitionStorage, probing around the start and until times of
+// every active transition.
+ACU_TEST(test_atc_transition_keys_find_matches_storage)
+{
+  static const int32_t deltas[] = {-7200, -3601, -3600, -1, 0, 1, 3599, 3600};
+  const uint8_t num_deltas = sizeof(deltas) / sizeof(deltas[0]);
+
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneRegistrySize; i++) {
+    atc_processor_init_for_zone_info(&processor, kAtcZonedb2025ZoneRegistry[i]);
+    for (int16_t year = 2000; year < 2050; year++) {
+      atc_processor_init_for_year(&processor, year);
+      const AtcTransitionStorage *ts = &processor.transition_storage;
+      AtcTransitionKeys tkeys;
+      atc_transition_keys_init(&tkeys, ts);
+      const AtcTransitionKeys *keys = &tkeys;
+      ACU_ASSERT(keys->num == ts->index_free);
+
+      for (uint8_t j = 0; j < ts->index_free; j++) {
+        const AtcTransition *t = ts->transitions[j];
+        for (uint8_t d = 0; d < num_deltas; d++) {
+          atc_time_t epoch_seconds = t->start_epoch_seconds + deltas[d];
+          AtcTransitionForSeconds expected =
+              atc_transition_storage_find_for_seconds(ts, epoch_seconds);
+          AtcTransitionForSeconds actual =
+              atc_transition_keys_find_for_unix_seconds(
+                  keys, ts, t->start_unix_seconds + deltas[d]);
+          ACU_ASSERT(expected.curr == actual.curr);
+          ACU_ASSERT(expected.fold == actual.fold);
+          ACU_ASSERT(expected.num == actual.num);
+
+          // The same search without the keys.
+          actual = atc_transition_storage_find_for_unix_seconds(
+              ts, t->start_unix_seconds + deltas[d]);
+          ACU_ASSERT(expected.curr == actual.curr);
+          ACU_ASSERT(expected.fold == actual.fold);
+          ACU_ASSERT(expected.num == actual.num);
+
+          // Probe the wall times around start_dt and until_dt.
+          const AtcDateTuple *dts[] = {&t->start_dt, &t->until_dt};
+          for (uint8_t k = 0; k < 2; k++) {
+            atc_time_t seconds = (atc_time_t) 86400
+                * atc_plain_date_to_epoch_days(
+                    dts[k]->year, dts[k]->month, dts[k]->day)
+                + dts[k]->seconds + deltas[d];
+            AtcPlainDateTime pdt;
+            atc_plain_date_time_from_epoch_seconds(&pdt, seconds);
+            AtcTransitionForDateTime expected_dt =
+                atc_transition_storage_find_for_date_time(ts, &pdt);
+            AtcTransitionForDateTime actual_dt =
+                atc_transition_keys_find_for_date_time(keys, ts, &pdt);
+            ACU_ASSERT(expected_dt.prev == actual_dt.prev);
+            ACU_ASSERT(expected_dt.curr == actual_dt.curr);
+            ACU_ASSERT(expected_dt.num == actual_dt.num);
+          }
+        }
+      }
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -482,5 +546,6 @@ int main()
   ACU_RUN_TEST(
       test_atc_transition_storage_add_active_candidates_to_active_pool);
   ACU_RUN_TEST(test_atc_transition_storage_reset_candidate_pool);
+  ACU_RUN_TEST(test_atc_transition_keys_find_matches_storage);
   ACU_SUMMARY();
 }
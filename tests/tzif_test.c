@@ -0,0 +1,363 @@
+/*
+ * Unit tests for tzif.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_tzif_parse_footer)
+{
+  AtcTzifFooter f;
+  const char *s = "PST8PDT,M3.2.0,M11.1.0";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrOk);
+  ACU_ASSERT(f.has_dst);
+  ACU_ASSERT(f.std_offset_seconds == -8 * 3600);
+  ACU_ASSERT(f.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(f.std_abbrev, "PST") == 0);
+  ACU_ASSERT(strcmp(f.dst_abbrev, "PDT") == 0);
+  ACU_ASSERT(f.start.kind == kAtcTzifRuleMonth);
+  ACU_ASSERT(f.start.month == 3);
+  ACU_ASSERT(f.start.week == 2);
+  ACU_ASSERT(f.start.weekday == 0);
+  ACU_ASSERT(f.start.time_seconds == 2 * 3600);
+  ACU_ASSERT(f.end.month == 11);
+
+  // Quoted abbreviation, and minutes in the offset.
+  s = "<+0530>-5:30";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrOk);
+  ACU_ASSERT(! f.has_dst);
+  ACU_ASSERT(f.std_offset_seconds == 5 * 3600 + 1800);
+  ACU_ASSERT(strcmp(f.std_abbrev, "+0530") == 0);
+
+  // Negative DST, and explicit transition times.
+  s = "IST-1GMT0,M10.5.0,M3.5.0/1";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrOk);
+  ACU_ASSERT(f.std_offset_seconds == 3600);
+  ACU_ASSERT(f.dst_offset_seconds == -3600);
+  ACU_ASSERT(f.end.time_seconds == 3600);
+
+  // RFC 8536 extension: negative and large transition times.
+  s = "<-02>2<-01>,M3.5.0/-1,M10.5.0/0";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrOk);
+  ACU_ASSERT(f.start.time_seconds == -3600);
+  s = "EST5EDT,0/0,J365/25";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrOk);
+  ACU_ASSERT(f.start.kind == kAtcTzifRuleDay);
+  ACU_ASSERT(f.end.kind == kAtcTzifRuleJulian);
+  ACU_ASSERT(f.end.day == 365);
+  ACU_ASSERT(f.end.time_seconds == 25 * 3600);
+
+  // Errors
+  s = "PST8PDT";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrGeneric);
+  s = "PS8";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrGeneric);
+  s = "PST8PDT,M3.2.0,M13.1.0";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrGeneric);
+  s = "PST8PDT,M3.2.0,M11.1.0x";
+  ACU_ASSERT(atc_tzif_parse_footer(&f, s, strlen(s)) == kAtcErrGeneric);
+}
+
+//---------------------------------------------------------------------------
+
+/** Types of the test file: LMT, PDT, PST. */
+static const int32_t kTestUtoffs[] = {-28378, -25200, -28800};
+static const uint8_t kTestIsDst[] = {0, 1, 0};
+static const uint8_t kTestAbbrevIndexes[] = {0, 4, 8};
+static const char kTestAbbrevs[] = "LMT\0PDT\0PST";
+
+/** 1883-11-18 20:00 UTC, 2022-03-13 10:00 UTC, 2022-11-06 09:00 UTC */
+static const int64_t kTestTimes[] = {-2717640000, 1647165600, 1667725200};
+static const uint8_t kTestTimeTypes[] = {2, 1, 2};
+
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t) (v >> 24);
+  p[1] = (uint8_t) (v >> 16);
+  p[2] = (uint8_t) (v >> 8);
+  p[3] = (uint8_t) v;
+  return p + 4;
+}
+
+static uint8_t *put_header(
+    uint8_t *p,
+    uint32_t timecnt,
+    uint32_t typecnt,
+    uint32_t charcnt)
+{
+  memset(p, 0, 44);
+  memcpy(p, "TZif2", 5);
+  put32(p + 32, timecnt);
+  put32(p + 36, typecnt);
+  put32(p + 40, charcnt);
+  return p + 44;
+}
+
+/**
+ * Write a TZif file with a minimal version 1 block, the test transitions, and
+ * the footer. Returns the size of the file.
+ */
+static size_t build_tzif(uint8_t *buffer, const char *footer)
+{
+  uint8_t *p = put_header(buffer, 0, 1, 1);
+  memset(p, 0, 7);
+  p += 7;
+
+  p = put_header(p, 3, 3, sizeof(kTestAbbrevs));
+  for (uint8_t i = 0; i < 3; i++) {
+    p = put32(p, (uint32_t) ((uint64_t) kTestTimes[i] >> 32));
+    p = put32(p, (uint32_t) kTestTimes[i]);
+  }
+  memcpy(p, kTestTimeTypes, 3);
+  p += 3;
+  for (uint8_t i = 0; i < 3; i++) {
+    p = put32(p, (uint32_t) kTestUtoffs[i]);
+    *p++ = kTestIsDst[i];
+    *p++ = kTestAbbrevIndexes[i];
+  }
+  memcpy(p, kTestAbbrevs, sizeof(kTestAbbrevs));
+  p += sizeof(kTestAbbrevs);
+
+  *p++ = '\n';
+  memcpy(p, footer, strlen(footer));
+  p += strlen(footer);
+  *p++ = '\n';
+  return (size_t) (p - buffer);
+}
+
+static uint8_t buffer[512];
+
+ACU_TEST(test_atc_tzif_find_by_unix_seconds)
+{
+  size_t size = build_tzif(buffer, "PST8PDT,M3.2.0,M11.1.0");
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+  ACU_ASSERT(tzif.version == 2);
+  ACU_ASSERT(tzif.num_transitions == 3);
+  ACU_ASSERT(tzif.num_types == 3);
+  ACU_ASSERT(tzif.has_footer);
+
+  // Before the first transition.
+  AtcFindResult result;
+  atc_tzif_find_by_unix_seconds(&tzif, -3000000000, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(result.std_offset_seconds == -28378);
+  ACU_ASSERT(result.dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(result.abbrev, "LMT") == 0);
+  ACU_ASSERT(result.valid_from_unix_seconds == INT64_MIN);
+  ACU_ASSERT(result.valid_until_unix_seconds == -2717640000);
+
+  // The DST offset is relative to the preceding standard time.
+  atc_tzif_find_by_unix_seconds(&tzif, 1647165600, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(result.std_offset_seconds == -8 * 3600);
+  ACU_ASSERT(result.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1647165600);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1667725200);
+
+  // Overlap around 2022-11-06 02:00 PDT.
+  atc_tzif_find_by_unix_seconds(&tzif, 1667725200 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 0);
+  atc_tzif_find_by_unix_seconds(&tzif, 1667725200, &result);
+  ACU_ASSERT(result.type == kAtcFindResultOverlap);
+  ACU_ASSERT(result.fold == 1);
+
+  // After the last transition, the footer starts at the last transition.
+  atc_tzif_find_by_unix_seconds(&tzif, 1678615200 - 1, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(strcmp(result.abbrev, "PST") == 0);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1667725200);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1678615200);
+  // 2023-03-12 02:00 PST
+  atc_tzif_find_by_unix_seconds(&tzif, 1678615200, &result);
+  ACU_ASSERT(result.std_offset_seconds == -8 * 3600);
+  ACU_ASSERT(result.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1678615200);
+  ACU_ASSERT(result.valid_until_unix_seconds == 1699174800);
+  // 2100-07-01
+  atc_tzif_find_by_unix_seconds(&tzif, 4118083200, &result);
+  ACU_ASSERT(result.type == kAtcFindResultExact);
+  ACU_ASSERT(strcmp(result.abbrev, "PDT") == 0);
+}
+
+ACU_TEST(test_atc_tzif_time_zone)
+{
+  size_t size = build_tzif(buffer, "PST8PDT,M3.2.0,M11.1.0");
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+  AtcTimeZone tz = atc_time_zone_for_tzif(&tzif);
+  ACU_ASSERT(tz.type == kAtcTimeZoneTypeTzif);
+
+  // Gap: 2023-03-12 02:30 does not exist.
+  AtcPlainDateTime pdt = {2023, 3, 12, 2, 30, 0};
+  AtcZonedDateTime zdt;
+  atc_zoned_date_time_from_plain_date_time(
+      &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
+  ACU_ASSERT(! atc_zoned_date_time_is_error(&zdt));
+  ACU_ASSERT(zdt.hour == 3);
+  ACU_ASSERT(zdt.minute == 30);
+  ACU_ASSERT(zdt.offset_seconds == -7 * 3600);
+  ACU_ASSERT(zdt.resolved == kAtcResolvedGapLater);
+  atc_zoned_date_time_from_plain_date_time(
+      &zdt, &pdt, &tz, kAtcDisambiguateEarlier);
+  ACU_ASSERT(zdt.hour == 1);
+  ACU_ASSERT(zdt.offset_seconds == -8 * 3600);
+  ACU_ASSERT(zdt.resolved == kAtcResolvedGapEarlier);
+
+  // Overlap: 2023-11-05 01:30 occurs twice.
+  AtcZonedExtra extra;
+  pdt.month = 11;
+  pdt.day = 5;
+  pdt.hour = 1;
+  atc_zoned_extra_from_plain_date_time(
+      &extra, &pdt, &tz, kAtcDisambiguateEarlier);
+  ACU_ASSERT(extra.resolved == kAtcResolvedOverlapEarlier);
+  ACU_ASSERT(extra.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(extra.abbrev, "PDT") == 0);
+  atc_zoned_extra_from_plain_date_time(
+      &extra, &pdt, &tz, kAtcDisambiguateLater);
+  ACU_ASSERT(extra.resolved == kAtcResolvedOverlapLater);
+  ACU_ASSERT(extra.dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(extra.abbrev, "PST") == 0);
+
+  // Round trip through unix seconds.
+  atc_zoned_date_time_from_unix_seconds(&zdt, 1688212800, &tz);
+  ACU_ASSERT(zdt.year == 2023);
+  ACU_ASSERT(zdt.month == 7);
+  ACU_ASSERT(zdt.hour == 5);
+  ACU_ASSERT(zdt.offset_seconds == -7 * 3600);
+
+  // Transitions, across the last transition of the file.
+  AtcZoneTransition t;
+  ACU_ASSERT(atc_time_zone_next_transition(&tz, 1667725200, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1678615200);
+  ACU_ASSERT(t.prev_dst_offset_seconds == 0);
+  ACU_ASSERT(t.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(t.abbrev, "PDT") == 0);
+  ACU_ASSERT(atc_time_zone_prev_transition(&tz, 1678615200 - 1, &t));
+  ACU_ASSERT(t.start_unix_seconds == 1667725200);
+  ACU_ASSERT(atc_time_zone_prev_transition(&tz, -2717640000, &t));
+  ACU_ASSERT(t.start_unix_seconds == -2717640000);
+  ACU_ASSERT(t.prev_std_offset_seconds == -28378);
+  ACU_ASSERT(! atc_time_zone_prev_transition(&tz, -2717640000 - 1, &t));
+}
+
+ACU_TEST(test_atc_tzif_fixed_footer)
+{
+  // Without DST rules, the last type lasts forever.
+  size_t size = build_tzif(buffer, "PST8");
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+  AtcFindResult result;
+  atc_tzif_find_by_unix_seconds(&tzif, 4118083200, &result);
+  ACU_ASSERT(result.dst_offset_seconds == 0);
+  ACU_ASSERT(result.valid_from_unix_seconds == 1667725200);
+  ACU_ASSERT(result.valid_until_unix_seconds == INT64_MAX);
+  AtcZoneTransition t;
+  ACU_ASSERT(! atc_tzif_next_transition(&tzif, 1667725200, &t));
+
+  // An empty footer.
+  size = build_tzif(buffer, "");
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+  ACU_ASSERT(! tzif.has_footer);
+  atc_tzif_find_by_unix_seconds(&tzif, 4118083200, &result);
+  ACU_ASSERT(strcmp(result.abbrev, "PST") == 0);
+}
+
+ACU_TEST(test_atc_tzif_errors)
+{
+  size_t size = build_tzif(buffer, "PST8PDT,M3.2.0,M11.1.0");
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+
+  // Truncated, or without the final newline of the footer.
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, 100) == kAtcErrGeneric);
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size - 1) == kAtcErrGeneric);
+
+  // Version 1 files have no 64-bit data.
+  buffer[4] = '\0';
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrGeneric);
+  buffer[4] = '2';
+
+  // Bad magic of the second header.
+  const size_t v2 = 44 + 7;
+  buffer[v2] = 'X';
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrGeneric);
+  buffer[v2] = 'T';
+
+  // Transitions out of order.
+  uint8_t *times = buffer + v2 + 44;
+  times[8] ^= 0x80;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrGeneric);
+  times[8] ^= 0x80;
+
+  // Type index out of range.
+  uint8_t *types = times + 3 * 8;
+  types[1] = 3;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrGeneric);
+  types[1] = 1;
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrOk);
+
+  // Invalid footer.
+  size = build_tzif(buffer, "PST8PDT");
+  ACU_ASSERT(atc_tzif_init(&tzif, buffer, size) == kAtcErrGeneric);
+}
+
+#if ACE_TIME_C_HAS_MMAP
+
+// Uses the TZif files of the host, if they exist.
+ACU_TEST(test_atc_tzif_open_zone)
+{
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_open_zone(&tzif, "../etc/passwd") == kAtcErrGeneric);
+  ACU_ASSERT(atc_tzif_open_zone(&tzif, "/etc/passwd") == kAtcErrGeneric);
+  ACU_ASSERT(atc_tzif_open_zone(&tzif, "No/Such_Zone") == kAtcErrGeneric);
+  if (atc_tzif_open_zone(&tzif, "America/Los_Angeles")) return;
+  ACU_ASSERT(tzif.is_mapped);
+  ACU_ASSERT(strcmp(tzif.name, "America/Los_Angeles") == 0);
+
+  // The US rules have not changed since 2007.
+  AtcTimeZone tz = atc_time_zone_for_tzif(&tzif);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone expected = atc_time_zone_for_zone_info(
+      &kAtcZonedb2025ZoneAmerica_Los_Angeles, &processor);
+  int64_t start = 1735689600; // 2025-01-01
+  int64_t until = 4102444800; // 2100-01-01
+  for (int64_t t = start; t < until; t += 5 * 86400 + 7 * 3600) {
+    AtcZonedExtra a;
+    AtcZonedExtra b;
+    atc_zoned_extra_from_unix_seconds(&a, t, &tz);
+    atc_zoned_extra_from_unix_seconds(&b, t, &expected);
+    ACU_ASSERT(a.std_offset_seconds == b.std_offset_seconds);
+    ACU_ASSERT(a.dst_offset_seconds == b.dst_offset_seconds);
+    ACU_ASSERT(strcmp(a.abbrev, b.abbrev) == 0);
+  }
+  atc_tzif_close_file(&tzif);
+  ACU_ASSERT(tzif.data == NULL);
+}
+
+#endif
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_tzif_parse_footer);
+  ACU_RUN_TEST(test_atc_tzif_find_by_unix_seconds);
+  ACU_RUN_TEST(test_atc_tzif_time_zone);
+  ACU_RUN_TEST(test_atc_tzif_fixed_footer);
+  ACU_RUN_TEST(test_atc_tzif_errors);
+#if ACE_TIME_C_HAS_MMAP
+  ACU_RUN_TEST(test_atc_tzif_open_zone);
+#endif
+  ACU_SUMMARY();
+}
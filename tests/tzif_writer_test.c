@@ -0,0 +1,212 @@
+/*
+ * Unit tests for tzif_writer.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+/** An in-memory file for atc_tzif_write(). */
+typedef struct TestFile {
+  uint8_t data[16384];
+  size_t size;
+  /** Number of callbacks before failing, or -1 to never fail. */
+  int fail_after;
+} TestFile;
+
+static int8_t test_file_write(void *context, const uint8_t *data, size_t size)
+{
+  TestFile *file = (TestFile *) context;
+  if (file->fail_after == 0) return kAtcErrGeneric;
+  if (file->fail_after > 0) file->fail_after--;
+  if (file->size + size > sizeof(file->data)) return kAtcErrGeneric;
+  memcpy(file->data + file->size, data, size);
+  file->size += size;
+  return kAtcErrOk;
+}
+
+static void test_file_init(TestFile *file)
+{
+  file->size = 0;
+  file->fail_after = -1;
+}
+
+/** Check the footer of the zone, and that it can be parsed back. */
+static bool check_footer(
+    const AtcZoneInfo *info,
+    const char *expected,
+    int16_t expected_year)
+{
+  char footer[kAtcTzifFooterSize];
+  int16_t year;
+  if (atc_tzif_create_footer(footer, sizeof(footer), info, &year)) {
+    return false;
+  }
+  AtcTzifFooter parsed;
+  return strcmp(footer, expected) == 0
+      && year == expected_year
+      && atc_tzif_parse_footer(&parsed, footer, strlen(footer)) == kAtcErrOk;
+}
+
+ACU_TEST(test_atc_tzif_create_footer)
+{
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAmerica_Los_Angeles,
+      "PST8PDT,M3.2.0,M11.1.0", 2008));
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAustralia_Sydney,
+      "AEST-10AEDT,M10.1.0,M4.1.0/3", 2009));
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAsia_Kolkata,
+      "IST-5:30", 1));
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAustralia_Lord_Howe,
+      "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", 2009));
+
+  // Negative DST of the main format of the TZDB.
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneEurope_Dublin,
+      "IST-1GMT0,M10.5.0,M3.5.0/1", 1997));
+
+  // Rules with 'u' times, before midnight in local time.
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAmerica_Scoresbysund,
+      "<-02>2<-01>,M3.5.0/-1,M10.5.0/0", 2025));
+
+  // "Fri>=23" is the day after the fourth Thursday.
+  ACU_ASSERT(check_footer(&kAtcZonedb2025ZoneAsia_Jerusalem,
+      "IST-2IDT,M3.4.4/26,M10.5.0", 2014));
+
+  // The buffer is too small.
+  char footer[8];
+  int16_t year;
+  ACU_ASSERT(atc_tzif_create_footer(footer, sizeof(footer),
+      &kAtcZonedb2025ZoneAmerica_Los_Angeles, &year) == kAtcErrGeneric);
+}
+
+/** Compare the written file with the compiled zone. */
+static bool check_round_trip(
+    const AtcTzif *tzif,
+    const AtcZoneInfo *info,
+    int64_t start,
+    int64_t until)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_tzif(tzif);
+  AtcTimeZone expected = atc_time_zone_for_zone_info(info, &processor);
+  for (int64_t t = start; t < until; t += 5 * 86400 + 7 * 3600) {
+    AtcZonedExtra a;
+    AtcZonedExtra b;
+    atc_zoned_extra_from_unix_seconds(&a, t, &tz);
+    atc_zoned_extra_from_unix_seconds(&b, t, &expected);
+    if (a.std_offset_seconds != b.std_offset_seconds
+        || a.dst_offset_seconds != b.dst_offset_seconds
+        || strcmp(a.abbrev, b.abbrev) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ACU_TEST(test_atc_tzif_write)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  static TestFile file;
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(&kAtcZonedb2025ZoneAmerica_Los_Angeles,
+      &processor, 2025, 2050, test_file_write, &file) == kAtcErrOk);
+
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, file.data, file.size) == kAtcErrOk);
+  ACU_ASSERT(tzif.version == 2);
+  ACU_ASSERT(tzif.num_transitions == 50);
+  ACU_ASSERT(tzif.num_types == 2);
+  ACU_ASSERT(tzif.abbrevs_size == 8);
+  ACU_ASSERT(tzif.has_footer);
+  ACU_ASSERT(tzif.footer.start.month == 3);
+
+  // The footer continues the transitions until 2100.
+  ACU_ASSERT(check_round_trip(&tzif, &kAtcZonedb2025ZoneAmerica_Los_Angeles,
+      1735689600 /*2025*/, 4102444800 /*2100*/));
+
+  // The DST offset changes at the same time as the STD offset.
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(&kAtcZonedb2025ZoneAmerica_Scoresbysund,
+      &processor, 2025, 2050, test_file_write, &file) == kAtcErrOk);
+  ACU_ASSERT(atc_tzif_init(&tzif, file.data, file.size) == kAtcErrOk);
+  ACU_ASSERT(tzif.version == 3);
+  ACU_ASSERT(check_round_trip(&tzif, &kAtcZonedb2025ZoneAmerica_Scoresbysund,
+      1735689600 /*2025*/, 4102444800 /*2100*/));
+
+  // A fixed zone has no transitions, only the footer.
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(&kAtcZonedb2025ZoneAsia_Kolkata,
+      &processor, 2025, 2050, test_file_write, &file) == kAtcErrOk);
+  ACU_ASSERT(atc_tzif_init(&tzif, file.data, file.size) == kAtcErrOk);
+  ACU_ASSERT(tzif.num_transitions == 0);
+  ACU_ASSERT(tzif.num_types == 1);
+  ACU_ASSERT(tzif.has_footer);
+  ACU_ASSERT(check_round_trip(&tzif, &kAtcZonedb2025ZoneAsia_Kolkata,
+      1735689600 /*2025*/, 4102444800 /*2100*/));
+}
+
+ACU_TEST(test_atc_tzif_write_truncated)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  static TestFile file;
+
+  // The rules of Casablanca are listed until 2087, so the footer of its final
+  // era is valid only after 2087.
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(&kAtcZonedb2025ZoneAfrica_Casablanca,
+      &processor, 2025, 2030, test_file_write, &file) == kAtcErrOk);
+  AtcTzif tzif;
+  ACU_ASSERT(atc_tzif_init(&tzif, file.data, file.size) == kAtcErrOk);
+  ACU_ASSERT(! tzif.has_footer);
+  ACU_ASSERT(check_round_trip(&tzif, &kAtcZonedb2025ZoneAfrica_Casablanca,
+      1735689600 /*2025*/, 1893456000 /*2030*/));
+
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(&kAtcZonedb2025ZoneAfrica_Casablanca,
+      &processor, 2025, 2100, test_file_write, &file) == kAtcErrOk);
+  ACU_ASSERT(atc_tzif_init(&tzif, file.data, file.size) == kAtcErrOk);
+  ACU_ASSERT(tzif.has_footer);
+  ACU_ASSERT(check_round_trip(&tzif, &kAtcZonedb2025ZoneAfrica_Casablanca,
+      1735689600 /*2025*/, 4102444800 /*2100*/));
+}
+
+ACU_TEST(test_atc_tzif_write_errors)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  static TestFile file;
+  const AtcZoneInfo *info = &kAtcZonedb2025ZoneAmerica_Los_Angeles;
+
+  test_file_init(&file);
+  ACU_ASSERT(atc_tzif_write(info, &processor, 2050, 2025,
+      test_file_write, &file) == kAtcErrGeneric);
+  ACU_ASSERT(atc_tzif_write(info, &processor, kAtcMinYear, 2025,
+      test_file_write, &file) == kAtcErrGeneric);
+  ACU_ASSERT(atc_tzif_write(info, &processor, 2025, kAtcMaxYear + 1,
+      test_file_write, &file) == kAtcErrGeneric);
+  ACU_ASSERT(file.size == 0);
+
+  // The error of the callback stops the writer.
+  file.fail_after = 1;
+  ACU_ASSERT(atc_tzif_write(info, &processor, 2025, 2100,
+      test_file_write, &file) == kAtcErrGeneric);
+  ACU_ASSERT(file.size > 0);
+  ACU_ASSERT(file.size < 200);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_tzif_create_footer);
+  ACU_RUN_TEST(test_atc_tzif_write);
+  ACU_RUN_TEST(test_atc_tzif_write_truncated);
+  ACU_RUN_TEST(test_atc_tzif_write_errors);
+  ACU_SUMMARY();
+}
@@ -0,0 +1,126 @@
+/*
+ * Unit tests for world_clock.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+static AtcZonedExtra extras[kAtcZonedb2025ZoneAndLinkRegistrySize];
+
+ACU_TEST(test_atc_world_clock_from_epoch_seconds)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  const AtcZoneInfo * const registry[] = {
+    &kAtcTestingZoneAmerica_Los_Angeles,
+    &kAtcTestingZoneAmerica_New_York,
+    &kAtcTestingZoneEtc_UTC,
+    &kAtcTestingZoneAmerica_Los_Angeles,
+  };
+
+  // 2022-07-01 00:00 UTC
+  AtcPlainDateTime pdt = {2022, 7, 1, 0, 0, 0};
+  atc_time_t epoch_seconds = atc_plain_date_time_to_epoch_seconds(&pdt);
+  int8_t err = atc_world_clock_from_epoch_seconds(
+      extras, registry, 4, epoch_seconds, &processor);
+  ACU_ASSERT(err == kAtcErrOk);
+
+  ACU_ASSERT(extras[0].resolved == kAtcResolvedUnique);
+  ACU_ASSERT(extras[0].std_offset_seconds == -8*3600);
+  ACU_ASSERT(extras[0].dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(extras[0].abbrev, "PDT") == 0);
+
+  ACU_ASSERT(extras[1].std_offset_seconds == -5*3600);
+  ACU_ASSERT(extras[1].dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(extras[1].abbrev, "EDT") == 0);
+
+  ACU_ASSERT(extras[2].std_offset_seconds == 0);
+  ACU_ASSERT(extras[2].dst_offset_seconds == 0);
+  ACU_ASSERT(strcmp(extras[2].abbrev, "UTC") == 0);
+
+  // Duplicates are copied.
+  ACU_ASSERT(extras[3].std_offset_seconds == -8*3600);
+  ACU_ASSERT(strcmp(extras[3].abbrev, "PDT") == 0);
+
+  // Invalid epoch seconds.
+  err = atc_world_clock_from_epoch_seconds(
+      extras, registry, 4, kAtcInvalidEpochSeconds, &processor);
+  ACU_ASSERT(err == kAtcErrGeneric);
+  ACU_ASSERT(atc_zoned_extra_is_error(&extras[0]));
+  ACU_ASSERT(atc_zoned_extra_is_error(&extras[3]));
+}
+
+//---------------------------------------------------------------------------
+
+// Verify that the snapshot of every zone and link of the registry at
+// `unix_seconds` is the same as atc_zoned_extra_from_unix_seconds().
+static void assert_world_clock_matches(
+    AcuContext *acu_context,
+    AtcZoneProcessor *processor,
+    AtcZoneProcessor *scalar_processor,
+    int64_t unix_seconds)
+{
+  atc_world_clock_from_unix_seconds(
+      extras, kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize, unix_seconds, processor);
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneAndLinkRegistrySize; i++) {
+    AtcTimeZone tz = atc_time_zone_for_zone_info(
+        kAtcZonedb2025ZoneAndLinkRegistry[i], scalar_processor);
+    AtcZonedExtra expected;
+    atc_zoned_extra_from_unix_seconds(&expected, unix_seconds, &tz);
+    ACU_ASSERT(extras[i].resolved == expected.resolved);
+    if (atc_zoned_extra_is_error(&expected)) continue;
+    ACU_ASSERT(extras[i].std_offset_seconds == expected.std_offset_seconds);
+    ACU_ASSERT(extras[i].dst_offset_seconds == expected.dst_offset_seconds);
+    ACU_ASSERT(
+        extras[i].req_std_offset_seconds == expected.req_std_offset_seconds);
+    ACU_ASSERT(
+        extras[i].req_dst_offset_seconds == expected.req_dst_offset_seconds);
+    ACU_ASSERT(strcmp(extras[i].abbrev, expected.abbrev) == 0);
+
+    // The validity interval may be narrower than the one of the processor,
+    // but the offsets must be the same at both ends.
+    int64_t from = extras[i].valid_from_unix_seconds;
+    int64_t until = extras[i].valid_until_unix_seconds;
+    ACU_ASSERT(from <= unix_seconds && unix_seconds < until);
+    if (from == INT64_MIN) continue;
+    atc_zoned_extra_from_unix_seconds(&expected, from, &tz);
+    ACU_ASSERT(extras[i].dst_offset_seconds == expected.dst_offset_seconds);
+    atc_zoned_extra_from_unix_seconds(&expected, until - 1, &tz);
+    ACU_ASSERT(extras[i].dst_offset_seconds == expected.dst_offset_seconds);
+  }
+}
+
+// Instants every 61 days and 7 hours from 1800 to 2200, so that they sweep
+// across the time of day, the seasons, and the changes of eras and rules.
+ACU_TEST(test_atc_world_clock_matches_zoned_extra)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcZoneProcessor scalar_processor;
+  atc_processor_init(&scalar_processor);
+
+  AtcPlainDateTime pdt = {1800, 1, 1, 0, 0, 0};
+  int64_t start = atc_plain_date_time_to_unix_seconds(&pdt);
+  pdt.year = 2200;
+  int64_t until = atc_plain_date_time_to_unix_seconds(&pdt);
+  for (int64_t t = start; t < until; t += 61 * 86400 + 7 * 3600) {
+    ACU_ASSERT_NO_FATAL_FAILURE(assert_world_clock_matches(
+        acu_context, &processor, &scalar_processor, t));
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_world_clock_from_epoch_seconds);
+  ACU_RUN_TEST(test_atc_world_clock_matches_zoned_extra);
+  ACU_SUMMARY();
+}
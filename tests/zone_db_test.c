@@ -0,0 +1,258 @@
+/*
+ * Unit tests for zone_db.c.
+ */
+
+#include <stddef.h> // offsetof()
+#include <stdio.h> // fopen(), fwrite(), remove()
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+enum {
+  kBufferSize = 256 * 1024,
+};
+
+// Aligned to kAtcZoneDbAlign.
+static uint64_t buffer[kBufferSize / sizeof(uint64_t)];
+static void *arena[kBufferSize / sizeof(void *)];
+
+/** Return true if the 2 zones give the same offsets every 5 days and 7 h. */
+static bool is_same_zone(const AtcZoneInfo *a, const AtcZoneInfo *b)
+{
+  AtcZoneProcessor pa;
+  atc_processor_init(&pa);
+  AtcZoneProcessor pb;
+  atc_processor_init(&pb);
+  AtcTimeZone tza = atc_time_zone_for_zone_info(a, &pa);
+  AtcTimeZone tzb = atc_time_zone_for_zone_info(b, &pb);
+
+  int64_t start = 946684800; // 2000-01-01
+  int64_t until = 2208988800; // 2040-01-01
+  for (int64_t t = start; t < until; t += 5 * 86400 + 7 * 3600) {
+    AtcZonedExtra ea;
+    AtcZonedExtra eb;
+    atc_zoned_extra_from_unix_seconds(&ea, t, &tza);
+    atc_zoned_extra_from_unix_seconds(&eb, t, &tzb);
+    if (ea.resolved != eb.resolved
+        || ea.std_offset_seconds != eb.std_offset_seconds
+        || ea.dst_offset_seconds != eb.dst_offset_seconds
+        || strcmp(ea.abbrev, eb.abbrev) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ACU_TEST(test_atc_zone_db_round_trip)
+{
+  size_t size = atc_zone_db_write_size(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize);
+  ACU_ASSERT(size > 0 && size <= kBufferSize);
+  ACU_ASSERT(size == atc_zone_db_write(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+      buffer, kBufferSize));
+
+  AtcZoneDb db;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrOk);
+  size_t arena_size = atc_zone_db_arena_size(&db);
+  ACU_ASSERT(arena_size <= sizeof(arena));
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrOk);
+  ACU_ASSERT(db.registry_size == kAtcTestingZoneAndLinkRegistrySize);
+
+  for (uint16_t i = 0; i < db.registry_size; i++) {
+    const AtcZoneInfo *info = db.registry[i];
+    const AtcZoneInfo *original = kAtcTestingZoneAndLinkRegistry[i];
+    ACU_ASSERT(info->zone_id == original->zone_id);
+    ACU_ASSERT(info->num_eras == original->num_eras);
+    ACU_ASSERT(atc_zone_info_is_link(info) == atc_zone_info_is_link(original));
+    ACU_ASSERT(strcmp(atc_zone_info_zone_name(info),
+        atc_zone_info_zone_name(original)) == 0);
+    ACU_ASSERT(is_same_zone(info, original));
+  }
+
+  // The registry is sorted like the original, so it works with the registrar.
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(&registrar, db.registry, db.registry_size);
+  ACU_ASSERT(registrar.is_sorted);
+  const AtcZoneInfo *info =
+      atc_registrar_find_by_name(&registrar, "America/Los_Angeles");
+  ACU_ASSERT(info != NULL);
+  ACU_ASSERT(info->zone_id == kAtcTestingZoneIdAmerica_Los_Angeles);
+  ACU_ASSERT(info >= (const AtcZoneInfo *) (const void *) arena);
+}
+
+// The eras of a link and its target, and the shared policies, are written
+// once.
+ACU_TEST(test_atc_zone_db_shares_records)
+{
+  size_t size = atc_zone_db_write(
+      kAtcZonedb2025ZoneAndLinkRegistry, kAtcZonedb2025ZoneAndLinkRegistrySize,
+      buffer, kBufferSize);
+  ACU_ASSERT(size > 0);
+  AtcZoneDb db;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrOk);
+  const AtcZoneDbHeader *header = (const AtcZoneDbHeader *) db.data;
+  ACU_ASSERT(header->contexts.count == 1);
+  ACU_ASSERT(header->infos.count == kAtcZonedb2025ZoneAndLinkRegistrySize);
+
+  size_t num_eras = 0;
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneRegistrySize; i++) {
+    num_eras += kAtcZonedb2025ZoneRegistry[i]->num_eras;
+  }
+  ACU_ASSERT(header->eras.count == num_eras);
+  ACU_ASSERT(header->policies.count < header->eras.count);
+
+  ACU_ASSERT(atc_zone_db_arena_size(&db) <= sizeof(arena));
+  ACU_ASSERT(atc_zone_db_link(&db, arena, sizeof(arena)) == kAtcErrOk);
+  for (uint16_t i = 0; i < db.registry_size; i++) {
+    const AtcZoneInfo *info = db.registry[i];
+    if (! atc_zone_info_is_link(info)) continue;
+    ACU_ASSERT(info->eras == info->target_info->eras);
+  }
+}
+
+ACU_TEST(test_atc_zone_db_errors)
+{
+  // A link whose target is not in the registry.
+  const AtcZoneInfo *links[] = {&kAtcTestingZoneUS_Pacific};
+  ACU_ASSERT(atc_zone_db_write_size(links, 1) == 0);
+
+  size_t size = atc_zone_db_write(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+      buffer, kBufferSize);
+  ACU_ASSERT(size > 0);
+
+  // Buffer too small.
+  ACU_ASSERT(atc_zone_db_write(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+      buffer, size - 1) == 0);
+
+  AtcZoneDb db;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size - 1) == kAtcErrGeneric);
+  ACU_ASSERT(atc_zone_db_init(&db, (const uint8_t *) buffer + 1, size - 1)
+      == kAtcErrGeneric);
+  ACU_ASSERT(atc_zone_db_arena_size(&db) == 0);
+
+  AtcZoneDbHeader *header = (AtcZoneDbHeader *) buffer;
+  header->magic[0] = 'X';
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrGeneric);
+  header->magic[0] = 'A';
+  header->version++;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrGeneric);
+  header->version--;
+  header->eras.count += 1000;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrGeneric);
+  header->eras.count -= 1000;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrOk);
+
+  // Arena too small.
+  size_t arena_size = atc_zone_db_arena_size(&db);
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size - 1) == kAtcErrGeneric);
+
+  // Invalid references are detected by the linker.
+  AtcZoneDbInfo *infos = (AtcZoneDbInfo *) (
+      (uint8_t *) buffer + header->infos.offset);
+  uint32_t eras = infos[0].eras;
+  infos[0].eras = header->eras.count;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  infos[0].eras = eras;
+  uint32_t name = infos[0].name;
+  infos[0].name = header->strings.offset + header->strings.count;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  infos[0].name = name;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrOk);
+}
+
+// The fields of the rules and eras are validated by the linker, otherwise the
+// first lookup reads outside of the letters or the days of the month.
+ACU_TEST(test_atc_zone_db_invalid_fields)
+{
+  size_t size = atc_zone_db_write(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+      buffer, kBufferSize);
+  ACU_ASSERT(size > 0);
+  AtcZoneDb db;
+  ACU_ASSERT(atc_zone_db_init(&db, buffer, size) == kAtcErrOk);
+  size_t arena_size = atc_zone_db_arena_size(&db);
+  const AtcZoneDbHeader *header = (const AtcZoneDbHeader *) db.data;
+  ACU_ASSERT(header->rules.count > 0);
+
+  // The fields of AtcZoneRule are const, so modify the bytes of the file.
+  uint8_t *rule = (uint8_t *) buffer + header->rules.offset;
+  uint8_t *letter_index = rule + offsetof(AtcZoneRule, letter_index);
+  uint8_t saved = *letter_index;
+  *letter_index = 250;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  *letter_index = saved;
+
+  uint8_t *in_month = rule + offsetof(AtcZoneRule, in_month);
+  saved = *in_month;
+  *in_month = 13;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  *in_month = 0;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  *in_month = saved;
+
+  uint8_t *on_day_of_week = rule + offsetof(AtcZoneRule, on_day_of_week);
+  saved = *on_day_of_week;
+  *on_day_of_week = 8;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  *on_day_of_week = saved;
+
+  AtcZoneDbEra *eras = (AtcZoneDbEra *) (
+      (uint8_t *) buffer + header->eras.offset);
+  saved = eras[0].until_day;
+  eras[0].until_day = 0;
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrGeneric);
+  eras[0].until_day = saved;
+
+  ACU_ASSERT(atc_zone_db_link(&db, arena, arena_size) == kAtcErrOk);
+}
+
+#if ACE_TIME_C_HAS_MMAP
+
+ACU_TEST(test_atc_zone_db_open_file)
+{
+  const char *path = "zone_db_test.tmp";
+  size_t size = atc_zone_db_write(
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize,
+      buffer, kBufferSize);
+  FILE *file = fopen(path, "wb");
+  ACU_ASSERT(file != NULL);
+  ACU_ASSERT(fwrite(buffer, 1, size, file) == size);
+  fclose(file);
+
+  AtcZoneDb db;
+  int8_t err = atc_zone_db_open_file(&db, path);
+  remove(path);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(db.is_mapped);
+  ACU_ASSERT(db.registry_size == kAtcTestingZoneAndLinkRegistrySize);
+  for (uint16_t i = 0; i < db.registry_size; i++) {
+    ACU_ASSERT(is_same_zone(db.registry[i], kAtcTestingZoneAndLinkRegistry[i]));
+  }
+  atc_zone_db_close_file(&db);
+  ACU_ASSERT(db.registry == NULL);
+
+  ACU_ASSERT(atc_zone_db_open_file(&db, path) == kAtcErrGeneric);
+}
+
+#endif
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_zone_db_round_trip);
+  ACU_RUN_TEST(test_atc_zone_db_shares_records);
+  ACU_RUN_TEST(test_atc_zone_db_errors);
+  ACU_RUN_TEST(test_atc_zone_db_invalid_fields);
+#if ACE_TIME_C_HAS_MMAP
+  ACU_RUN_TEST(test_atc_zone_db_open_file);
+#endif
+  ACU_SUMMARY();
+}
@@ -0,0 +1,165 @@
+/*
+ * Unit tests for zone_hash.c.
+ */
+
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+static const AtcZoneInfo * const kUnsortedRegistry[] = {
+  &kAtcTestingZoneAmerica_Los_Angeles,
+  &kAtcTestingZoneAmerica_Denver,
+  &kAtcTestingZoneAmerica_Chicago,
+  &kAtcTestingZoneAmerica_New_York,
+};
+
+#define UNSORTED_SIZE \
+    (sizeof(kUnsortedRegistry) / sizeof(const AtcZoneInfo *))
+
+static const AtcZoneInfo * const kDuplicateRegistry[] = {
+  &kAtcTestingZoneAmerica_Los_Angeles,
+  &kAtcTestingZoneAmerica_Denver,
+  &kAtcTestingZoneAmerica_Los_Angeles,
+};
+
+#define DUPLICATE_SIZE \
+    (sizeof(kDuplicateRegistry) / sizeof(const AtcZoneInfo *))
+
+/** Verify that every zone of the registry is found at its index. */
+static bool check_all_found(const AtcZoneHash *hash)
+{
+  for (uint16_t i = 0; i < hash->size; i++) {
+    const AtcZoneInfo *info = hash->registry[i];
+    if (atc_zone_hash_find_index(hash, info->zone_id) != i) return false;
+    if (atc_zone_hash_find_by_id(hash, info->zone_id) != info) return false;
+    if (atc_zone_hash_find_by_name(hash, info->name) != info) return false;
+  }
+  return true;
+}
+
+/**
+ * Verify that a precomputed hash was generated from the given registry, i.e.
+ * that its zone_hash.c was regenerated together with its zone_registry.c.
+ */
+static bool check_registry(const AtcZoneHash *hash,
+    const AtcZoneInfo * const *registry, uint16_t size)
+{
+  if (hash->registry != registry) return false;
+  if (hash->size != size) return false;
+  return check_all_found(hash);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_zone_hash_init)
+{
+  AtcZoneHash hash;
+  uint16_t seeds[ATC_ZONE_HASH_NUM_BUCKETS(kAtcTestingZoneAndLinkRegistrySize)];
+  uint16_t indexes[kAtcTestingZoneAndLinkRegistrySize];
+  ACU_ASSERT(atc_zone_hash_init(
+      &hash,
+      kAtcTestingZoneAndLinkRegistry,
+      kAtcTestingZoneAndLinkRegistrySize,
+      seeds,
+      ATC_ZONE_HASH_NUM_BUCKETS(kAtcTestingZoneAndLinkRegistrySize),
+      indexes) == kAtcErrOk);
+  ACU_ASSERT(check_all_found(&hash));
+
+  ACU_ASSERT(atc_zone_hash_find_by_id(&hash, 0x0) == NULL);
+  ACU_ASSERT(atc_zone_hash_find_index(&hash, 0x0) == UINT16_MAX);
+  ACU_ASSERT(atc_zone_hash_find_by_name(&hash, "should not exist") == NULL);
+}
+
+ACU_TEST(test_atc_zone_hash_init_unsorted)
+{
+  AtcZoneHash hash;
+  uint16_t seeds[ATC_ZONE_HASH_NUM_BUCKETS(UNSORTED_SIZE)];
+  uint16_t indexes[UNSORTED_SIZE];
+  ACU_ASSERT(atc_zone_hash_init(
+      &hash,
+      kUnsortedRegistry,
+      UNSORTED_SIZE,
+      seeds,
+      ATC_ZONE_HASH_NUM_BUCKETS(UNSORTED_SIZE),
+      indexes) == kAtcErrOk);
+  ACU_ASSERT(check_all_found(&hash));
+
+  // A zone which is not in this registry.
+  ACU_ASSERT(atc_zone_hash_find_by_name(&hash, "America/Toronto") == NULL);
+}
+
+ACU_TEST(test_atc_zone_hash_init_errors)
+{
+  AtcZoneHash hash;
+  uint16_t seeds[ATC_ZONE_HASH_NUM_BUCKETS(DUPLICATE_SIZE)];
+  uint16_t indexes[DUPLICATE_SIZE];
+  ACU_ASSERT(atc_zone_hash_init(
+      &hash,
+      kDuplicateRegistry,
+      DUPLICATE_SIZE,
+      seeds,
+      ATC_ZONE_HASH_NUM_BUCKETS(DUPLICATE_SIZE),
+      indexes) == kAtcErrGeneric);
+
+  // No buckets.
+  ACU_ASSERT(atc_zone_hash_init(
+      &hash,
+      kUnsortedRegistry,
+      UNSORTED_SIZE,
+      seeds,
+      0,
+      indexes) == kAtcErrGeneric);
+
+  // An empty registry finds nothing.
+  ACU_ASSERT(atc_zone_hash_init(
+      &hash, kUnsortedRegistry, 0, seeds, 0, indexes) == kAtcErrOk);
+  ACU_ASSERT(atc_zone_hash_find_by_name(&hash, "America/Denver") == NULL);
+}
+
+ACU_TEST(test_atc_zone_hash_precomputed)
+{
+  ACU_ASSERT(check_registry(&kAtcTestingZoneHash,
+      kAtcTestingZoneRegistry, kAtcTestingZoneRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcTestingZoneAndLinkHash,
+      kAtcTestingZoneAndLinkRegistry, kAtcTestingZoneAndLinkRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcZonedb2000ZoneHash,
+      kAtcZonedb2000ZoneRegistry, kAtcZonedb2000ZoneRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcZonedb2000ZoneAndLinkHash,
+      kAtcZonedb2000ZoneAndLinkRegistry,
+      kAtcZonedb2000ZoneAndLinkRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcZonedb2025ZoneHash,
+      kAtcZonedb2025ZoneRegistry, kAtcZonedb2025ZoneRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcZonedb2025ZoneAndLinkHash,
+      kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize));
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+  ACU_ASSERT(check_registry(&kAtcZonedballZoneHash,
+      kAtcZonedballZoneRegistry, kAtcZonedballZoneRegistrySize));
+  ACU_ASSERT(check_registry(&kAtcZonedballZoneAndLinkHash,
+      kAtcZonedballZoneAndLinkRegistry,
+      kAtcZonedballZoneAndLinkRegistrySize));
+#endif
+
+  // A zone is not found in the registry of another zonedb.
+  ACU_ASSERT(atc_zone_hash_find_by_id(&kAtcZonedb2025ZoneHash,
+      kAtcTestingZoneAmerica_Los_Angeles.zone_id)
+      == &kAtcZonedb2025ZoneAmerica_Los_Angeles);
+  ACU_ASSERT(atc_zone_hash_find_by_name(&kAtcZonedb2025ZoneHash,
+      "US/Pacific") == NULL);
+  ACU_ASSERT(atc_zone_hash_find_by_name(&kAtcZonedb2025ZoneAndLinkHash,
+      "US/Pacific") != NULL);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_zone_hash_init);
+  ACU_RUN_TEST(test_atc_zone_hash_init_unsorted);
+  ACU_RUN_TEST(test_atc_zone_hash_init_errors);
+  ACU_RUN_TEST(test_atc_zone_hash_precomputed);
+  ACU_SUMMARY();
+}
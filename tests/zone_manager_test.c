@@ -0,0 +1,208 @@
+/*
+ * Unit tests for zone_manager.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_zone_manager_hits_misses_evictions)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcTestingZoneAndLinkRegistry,
+      kAtcTestingZoneAndLinkRegistrySize);
+  AtcZoneManagerSlot slots[2];
+  AtcZoneManager manager;
+  atc_zone_manager_init(&manager, &registrar, slots, 2);
+
+  const uint32_t la = kAtcTestingZoneAmerica_Los_Angeles.zone_id;
+  const uint32_t ny = kAtcTestingZoneAmerica_New_York.zone_id;
+  const uint32_t denver = kAtcTestingZoneAmerica_Denver.zone_id;
+
+  AtcZoneProcessor *p = atc_zone_manager_get_processor(&manager, la);
+  ACU_ASSERT(p != NULL);
+  ACU_ASSERT(p->zone_info == &kAtcTestingZoneAmerica_Los_Angeles);
+  ACU_ASSERT(manager.num_misses == 1);
+  ACU_ASSERT(manager.num_hits == 0);
+
+  // Same zone returns the same processor.
+  ACU_ASSERT(atc_zone_manager_get_processor(&manager, la) == p);
+  ACU_ASSERT(manager.num_hits == 1);
+
+  // Fill the second slot, then use Los_Angeles so that New_York becomes the
+  // least recently used.
+  AtcZoneProcessor *q = atc_zone_manager_get_processor(&manager, ny);
+  ACU_ASSERT(q != NULL && q != p);
+  ACU_ASSERT(atc_zone_manager_get_processor(&manager, la) == p);
+  ACU_ASSERT(manager.num_evictions == 0);
+
+  // Denver evicts New_York, not Los_Angeles.
+  AtcZoneProcessor *r = atc_zone_manager_get_processor(&manager, denver);
+  ACU_ASSERT(r == q);
+  ACU_ASSERT(r->zone_info == &kAtcTestingZoneAmerica_Denver);
+  ACU_ASSERT(manager.num_evictions == 1);
+  ACU_ASSERT(atc_zone_manager_get_processor(&manager, la) == p);
+  ACU_ASSERT(manager.num_misses == 3);
+  ACU_ASSERT(manager.num_hits == 3);
+
+  // Unknown zone_id is not counted.
+  ACU_ASSERT(atc_zone_manager_get_processor(&manager, 0) == NULL);
+  ACU_ASSERT(manager.num_misses == 3);
+
+  atc_zone_manager_clear(&manager);
+  ACU_ASSERT(manager.num_used == 0);
+  ACU_ASSERT(manager.num_hits == 0);
+  ACU_ASSERT(manager.num_misses == 0);
+  ACU_ASSERT(manager.num_evictions == 0);
+  ACU_ASSERT(atc_zone_manager_get_processor(&manager, ny) != NULL);
+  ACU_ASSERT(manager.num_misses == 1);
+
+  // A manager without slots never returns a processor.
+  AtcZoneManager empty;
+  atc_zone_manager_init(&empty, &registrar, NULL, 0);
+  ACU_ASSERT(atc_zone_manager_get_processor(&empty, la) == NULL);
+}
+
+ACU_TEST(test_atc_zone_manager_time_zone_for_name)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcTestingZoneAndLinkRegistry,
+      kAtcTestingZoneAndLinkRegistrySize);
+  AtcZoneManagerSlot slots[1];
+  AtcZoneManager manager;
+  atc_zone_manager_init(&manager, &registrar, slots, 1);
+
+  AtcTimeZone tz;
+  int8_t err = atc_zone_manager_time_zone_for_name(
+      &manager, "America/Los_Angeles", &tz);
+  ACU_ASSERT(err == kAtcErrOk);
+  ACU_ASSERT(tz.zone_info == &kAtcTestingZoneAmerica_Los_Angeles);
+
+  // 2022-07-01 00:00 UTC is in PDT.
+  AtcZonedExtra extra;
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &tz);
+  ACU_ASSERT(extra.std_offset_seconds == -8 * 3600);
+  ACU_ASSERT(extra.dst_offset_seconds == 1 * 3600);
+  ACU_ASSERT(strcmp(extra.abbrev, "PDT") == 0);
+
+  err = atc_zone_manager_time_zone_for_name(
+      &manager, "should not exist", &tz);
+  ACU_ASSERT(err == kAtcErrGeneric);
+}
+
+// Verify that an AtcTimeZone kept after the eviction of its zone still returns
+// the results of its zone, because every lookup binds the processor to the
+// zone of the AtcTimeZone, and that the zone which took over the slot is not
+// affected.
+ACU_TEST(test_atc_zone_manager_stale_time_zone)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcTestingZoneAndLinkRegistry,
+      kAtcTestingZoneAndLinkRegistrySize);
+  AtcZoneManagerSlot slots[2];
+  AtcZoneManager manager;
+  atc_zone_manager_init(&manager, &registrar, slots, 2);
+
+  // Fill the cache, using New_York last, so that Los_Angeles is evicted by
+  // Denver.
+  AtcTimeZone la;
+  AtcTimeZone ny;
+  AtcTimeZone denver;
+  ACU_ASSERT(atc_zone_manager_time_zone_for_id(&manager,
+      kAtcTestingZoneAmerica_Los_Angeles.zone_id, &la) == kAtcErrOk);
+  ACU_ASSERT(atc_zone_manager_time_zone_for_id(&manager,
+      kAtcTestingZoneAmerica_New_York.zone_id, &ny) == kAtcErrOk);
+  ACU_ASSERT(atc_zone_manager_time_zone_for_id(&manager,
+      kAtcTestingZoneAmerica_Denver.zone_id, &denver) == kAtcErrOk);
+  ACU_ASSERT(manager.num_evictions == 1);
+  ACU_ASSERT(denver.zone_processor == la.zone_processor);
+  ACU_ASSERT(denver.zone_processor != ny.zone_processor);
+
+  // 2022-07-01 00:00 UTC, through the stale AtcTimeZone of Los_Angeles.
+  AtcZonedExtra extra;
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &la);
+  ACU_ASSERT(extra.std_offset_seconds == -8 * 3600);
+  ACU_ASSERT(extra.dst_offset_seconds == 1 * 3600);
+  ACU_ASSERT(strcmp(extra.abbrev, "PDT") == 0);
+
+  // Denver owns the slot, through its AtcTimeZone, and through the manager.
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &denver);
+  ACU_ASSERT(extra.std_offset_seconds == -7 * 3600);
+  ACU_ASSERT(extra.dst_offset_seconds == 1 * 3600);
+  ACU_ASSERT(strcmp(extra.abbrev, "MDT") == 0);
+
+  // The stale AtcTimeZone binds the processor back to Los_Angeles, and the
+  // next lookup through the manager binds it again to Denver.
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &la);
+  ACU_ASSERT(la.zone_processor->zone_info
+      == &kAtcTestingZoneAmerica_Los_Angeles);
+  AtcZoneProcessor *p = atc_zone_manager_get_processor(
+      &manager, kAtcTestingZoneAmerica_Denver.zone_id);
+  ACU_ASSERT(p == denver.zone_processor);
+  ACU_ASSERT(p->zone_info == &kAtcTestingZoneAmerica_Denver);
+  ACU_ASSERT(manager.num_evictions == 1);
+}
+
+//---------------------------------------------------------------------------
+
+// Cycle through all zones with fewer slots than zones, and verify that the
+// results are the same as a dedicated processor.
+ACU_TEST(test_atc_zone_manager_matches_processor)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcZonedb2025ZoneRegistry,
+      kAtcZonedb2025ZoneRegistrySize);
+  AtcZoneManagerSlot slots[5];
+  AtcZoneManager manager;
+  atc_zone_manager_init(&manager, &registrar, slots, 5);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  for (uint16_t z = 0; z < kAtcZonedb2025ZoneRegistrySize; z++) {
+    // Revisit a zone from a few steps earlier, so that some lookups are hits.
+    for (uint16_t back = 0; back <= 3 && back <= z; back += 3) {
+      const AtcZoneInfo *info = kAtcZonedb2025ZoneRegistry[z - back];
+
+      AtcTimeZone tz;
+      ACU_ASSERT(atc_zone_manager_time_zone_for_id(
+          &manager, info->zone_id, &tz) == kAtcErrOk);
+      AtcTimeZone expected_tz = atc_time_zone_for_zone_info(info, &processor);
+
+      for (int64_t unix_seconds = 0; unix_seconds < 2000000000;
+          unix_seconds += 400000000) {
+        AtcZonedExtra expected;
+        atc_zoned_extra_from_unix_seconds(&expected, unix_seconds, &expected_tz);
+        AtcZonedExtra actual;
+        atc_zoned_extra_from_unix_seconds(&actual, unix_seconds, &tz);
+        ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+        ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+        ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+      }
+    }
+  }
+  ACU_ASSERT(manager.num_hits > 0);
+  ACU_ASSERT(manager.num_evictions > 0);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_zone_manager_hits_misses_evictions);
+  ACU_RUN_TEST(test_atc_zone_manager_time_zone_for_name);
+  ACU_RUN_TEST(test_atc_zone_manager_stale_time_zone);
+  ACU_RUN_TEST(test_atc_zone_manager_matches_processor);
+  ACU_SUMMARY();
+}
@@ -0,0 +1,152 @@
+/*
+ * Unit tests for zone_name_index.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+static uint16_t order[kAtcZonedb2025ZoneAndLinkRegistrySize];
+
+static void init_index(AtcZoneNameIndex *index)
+{
+  atc_zone_name_index_init(
+      index,
+      kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize,
+      order);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_zone_name_compare)
+{
+  ACU_ASSERT(atc_zone_name_compare("America/New_York", "America/New_York")
+      == 0);
+  ACU_ASSERT(atc_zone_name_compare("america/new york", "America/New_York")
+      == 0);
+  ACU_ASSERT(atc_zone_name_compare("AMERICA/NEW_YORK", "america/new york")
+      == 0);
+  ACU_ASSERT(atc_zone_name_compare("America/New", "America/New_York") < 0);
+  ACU_ASSERT(atc_zone_name_compare("america/denver", "America/Chicago") > 0);
+  ACU_ASSERT(atc_zone_name_compare("", "") == 0);
+}
+
+ACU_TEST(test_atc_zone_name_index_init)
+{
+  AtcZoneNameIndex index;
+  ACU_ASSERT(atc_zone_name_index_init(
+      &index,
+      kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize,
+      order) == kAtcErrOk);
+  ACU_ASSERT(index.size == kAtcZonedb2025ZoneAndLinkRegistrySize);
+
+  // Sorted by name, without regard to case.
+  for (uint16_t i = 1; i < index.size; i++) {
+    ACU_ASSERT(atc_zone_name_compare(
+        atc_zone_name_index_at(&index, i - 1)->name,
+        atc_zone_name_index_at(&index, i)->name) < 0);
+  }
+  ACU_ASSERT(strcmp(atc_zone_name_index_at(&index, 0)->name,
+      "Africa/Abidjan") == 0);
+}
+
+ACU_TEST(test_atc_zone_name_index_find)
+{
+  AtcZoneNameIndex index;
+  init_index(&index);
+
+  // Every zone and link is found by its own name.
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneAndLinkRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcZonedb2025ZoneAndLinkRegistry[i];
+    ACU_ASSERT(atc_zone_name_index_find(&index, info->name) == info);
+  }
+
+  ACU_ASSERT(atc_zone_name_index_find(&index, "america/los angeles")
+      == &kAtcZonedb2025ZoneAmerica_Los_Angeles);
+  ACU_ASSERT(atc_zone_name_index_find(&index, "US/PACIFIC")
+      == &kAtcZonedb2025ZoneUS_Pacific);
+
+  // Only the full name matches.
+  ACU_ASSERT(atc_zone_name_index_find(&index, "America/Los") == NULL);
+  ACU_ASSERT(atc_zone_name_index_find(&index, "America/Los_Angeles/")
+      == NULL);
+  ACU_ASSERT(atc_zone_name_index_find(&index, "should not exist") == NULL);
+  ACU_ASSERT(atc_zone_name_index_find(&index, "") == NULL);
+}
+
+ACU_TEST(test_atc_zone_name_index_find_prefix)
+{
+  AtcZoneNameIndex index;
+  init_index(&index);
+
+  uint16_t start;
+  uint16_t count = atc_zone_name_index_find_prefix(
+      &index, "america/north dakota/", &start);
+  ACU_ASSERT(count == 3);
+  ACU_ASSERT(strcmp(atc_zone_name_index_at(&index, start)->name,
+      "America/North_Dakota/Beulah") == 0);
+  ACU_ASSERT(strcmp(atc_zone_name_index_at(&index, start + 1)->name,
+      "America/North_Dakota/Center") == 0);
+  ACU_ASSERT(strcmp(atc_zone_name_index_at(&index, start + 2)->name,
+      "America/North_Dakota/New_Salem") == 0);
+
+  count = atc_zone_name_index_find_prefix(&index, "America/New", &start);
+  ACU_ASSERT(count == 1);
+  ACU_ASSERT(atc_zone_name_index_at(&index, start)
+      == &kAtcZonedb2025ZoneAmerica_New_York);
+
+  // A full name is its own prefix.
+  count = atc_zone_name_index_find_prefix(&index, "Europe/London", &start);
+  ACU_ASSERT(count == 1);
+
+  // Count every name which starts with "US/".
+  uint16_t expected = 0;
+  for (uint16_t i = 0; i < kAtcZonedb2025ZoneAndLinkRegistrySize; i++) {
+    if (strncmp(kAtcZonedb2025ZoneAndLinkRegistry[i]->name, "US/", 3) == 0) {
+      expected++;
+    }
+  }
+  count = atc_zone_name_index_find_prefix(&index, "us/", &start);
+  ACU_ASSERT(count == expected);
+  ACU_ASSERT(count > 0);
+
+  // The empty prefix matches everything.
+  count = atc_zone_name_index_find_prefix(&index, "", &start);
+  ACU_ASSERT(start == 0);
+  ACU_ASSERT(count == kAtcZonedb2025ZoneAndLinkRegistrySize);
+
+  count = atc_zone_name_index_find_prefix(&index, "Mars/", &start);
+  ACU_ASSERT(count == 0);
+  count = atc_zone_name_index_find_prefix(&index, "zzz", &start);
+  ACU_ASSERT(count == 0);
+  ACU_ASSERT(start == kAtcZonedb2025ZoneAndLinkRegistrySize);
+}
+
+ACU_TEST(test_atc_zone_name_index_empty)
+{
+  AtcZoneNameIndex index;
+  uint16_t empty_order[1];
+  ACU_ASSERT(atc_zone_name_index_init(
+      &index, kAtcTestingZoneRegistry, 0, empty_order) == kAtcErrOk);
+  ACU_ASSERT(atc_zone_name_index_find(&index, "America/Denver") == NULL);
+  uint16_t start;
+  ACU_ASSERT(atc_zone_name_index_find_prefix(&index, "", &start) == 0);
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_zone_name_compare);
+  ACU_RUN_TEST(test_atc_zone_name_index_init);
+  ACU_RUN_TEST(test_atc_zone_name_index_find);
+  ACU_RUN_TEST(test_atc_zone_name_index_find_prefix);
+  ACU_RUN_TEST(test_atc_zone_name_index_empty);
+  ACU_SUMMARY();
+}
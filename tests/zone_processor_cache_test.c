@@ -0,0 +1,129 @@
+/*
+ * Unit tests for zone_processor_cache.c.
+ */
+
+#include <string.h>
+#include <acunit.h>
+#include <acetimec.h>
+
+//---------------------------------------------------------------------------
+
+ACU_TEST(test_atc_processor_cache_get_for_year_lru)
+{
+  AtcZoneProcessorCache cache;
+  atc_processor_cache_init(&cache);
+  atc_processor_cache_init_for_zone_info(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles);
+
+  // Fill all the slots.
+  AtcZoneProcessor *first = atc_processor_cache_get_for_year(&cache, 2000);
+  ACU_ASSERT(first != NULL);
+  for (int16_t i = 1; i < kAtcProcessorCacheSize; i++) {
+    AtcZoneProcessor *p = atc_processor_cache_get_for_year(&cache, 2000 + i);
+    ACU_ASSERT(p != NULL);
+    ACU_ASSERT(p != first);
+  }
+
+  // All years are cached, so the same processor is returned for 2000.
+  ACU_ASSERT(first == atc_processor_cache_get_for_year(&cache, 2000));
+
+  // A new year evicts the least recently used year, which is 2001 because
+  // 2000 was just used.
+  AtcZoneProcessor *p = atc_processor_cache_get_for_year(&cache, 2100);
+  ACU_ASSERT(p != first);
+  ACU_ASSERT(atc_processor_is_valid_for_year(first, 2000));
+  for (uint8_t i = 0; i < kAtcProcessorCacheSize; i++) {
+    ACU_ASSERT(! atc_processor_is_valid_for_year(&cache.processors[i], 2001));
+  }
+
+  // Out of range year.
+  ACU_ASSERT(NULL == atc_processor_cache_get_for_year(&cache, 10000));
+}
+
+ACU_TEST(test_atc_processor_cache_init_for_zone_info)
+{
+  AtcZoneProcessorCache cache;
+  atc_processor_cache_init(&cache);
+  atc_processor_cache_init_for_zone_info(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles);
+  AtcZoneProcessor *p = atc_processor_cache_get_for_year(&cache, 2022);
+  ACU_ASSERT(atc_processor_is_valid_for_year(p, 2022));
+
+  // Same zone does not invalidate the cache.
+  atc_processor_cache_init_for_zone_info(
+      &cache, &kAtcTestingZoneAmerica_Los_Angeles);
+  ACU_ASSERT(atc_processor_is_valid_for_year(p, 2022));
+
+  // Different zone invalidates the cache.
+  atc_processor_cache_init_for_zone_info(
+      &cache, &kAtcTestingZoneAmerica_New_York);
+  ACU_ASSERT(! atc_processor_is_valid_for_year(p, 2022));
+}
+
+// Verify that mixed-year lookups through the cache return the same results as
+// a single AtcZoneProcessor.
+ACU_TEST(test_atc_processor_cache_find_matches_processor)
+{
+  AtcZoneProcessorCache cache;
+  atc_processor_cache_init(&cache);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+
+  for (uint16_t i = 0; i < kAtcTestingZoneRegistrySize; i++) {
+    const AtcZoneInfo *info = kAtcTestingZoneRegistry[i];
+    atc_processor_cache_init_for_zone_info(&cache, info);
+    atc_processor_init_for_zone_info(&processor, info);
+
+    // Alternate between the Dec 31 and Jan 1 of adjacent years, in both local
+    // time and epoch seconds.
+    for (int16_t year = 2000; year < 2040; year++) {
+      AtcPlainDateTime pdts[] = {
+        {year - 1, 12, 31, 23, 30, 0},
+        {year, 1, 1, 0, 30, 0},
+        {year, 3, 13, 2, 30, 0},
+        {year, 11, 6, 1, 30, 0},
+      };
+      for (uint8_t j = 0; j < sizeof(pdts) / sizeof(pdts[0]); j++) {
+        AtcFindResult expected;
+        AtcFindResult actual;
+        atc_processor_find_by_plain_date_time(
+            &processor, &pdts[j], kAtcDisambiguateCompatible, &expected);
+        atc_processor_cache_find_by_plain_date_time(
+            &cache, &pdts[j], kAtcDisambiguateCompatible, &actual);
+        ACU_ASSERT(expected.type == actual.type);
+        ACU_ASSERT(expected.fold == actual.fold);
+        ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+        ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+        ACU_ASSERT(
+            expected.req_std_offset_seconds == actual.req_std_offset_seconds);
+        ACU_ASSERT(
+            expected.req_dst_offset_seconds == actual.req_dst_offset_seconds);
+        ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+
+        atc_time_t epoch_seconds = atc_plain_date_time_to_epoch_seconds(
+            &pdts[j]);
+        atc_processor_find_by_epoch_seconds(
+            &processor, epoch_seconds, &expected);
+        atc_processor_cache_find_by_epoch_seconds(
+            &cache, epoch_seconds, &actual);
+        ACU_ASSERT(expected.type == actual.type);
+        ACU_ASSERT(expected.fold == actual.fold);
+        ACU_ASSERT(expected.std_offset_seconds == actual.std_offset_seconds);
+        ACU_ASSERT(expected.dst_offset_seconds == actual.dst_offset_seconds);
+        ACU_ASSERT(strcmp(expected.abbrev, actual.abbrev) == 0);
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ACU_CONTEXT();
+
+int main()
+{
+  ACU_RUN_TEST(test_atc_processor_cache_get_for_year_lru);
+  ACU_RUN_TEST(test_atc_processor_cache_init_for_zone_info);
+  ACU_RUN_TEST(test_atc_processor_cache_find_matches_processor);
+  ACU_SUMMARY();
+}
@@ -1014,7 +1014,7 @@ ACU_TEST(test_fix_transition_times_generate_start_until_times)
   ACU_ASSERT(ttu->suffix == kAtcSuffixU);
 
   // Step 4: Generate the startDateTime and untilDateTime of the transitions.
-  atc_processor_generate_start_until_times(begin, end);
+  atc_processor_generate_start_until_times(begin, end, NULL);
 
   // Step 4: Verification: The first transition startTime should be the same as
   // its transitionTime.
@@ -1170,6 +1170,69 @@ ACU_TEST(test_atc_processor_create_abbreviation_percent_z)
   ACU_ASSERT(strcmp("-010203", dst) == 0);
 }
 
+//---------------------------------------------------------------------------
+// Stats
+//---------------------------------------------------------------------------
+
+typedef struct StepCounts {
+  uint8_t begins[6];
+  uint8_t ends[6];
+} StepCounts;
+
+static void count_step(void *context, uint8_t step, bool is_end) {
+  StepCounts *counts = (StepCounts *) context;
+  if (is_end) {
+    counts->ends[step]++;
+  } else {
+    counts->begins[step]++;
+  }
+}
+
+ACU_TEST(test_atc_processor_stats) {
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  StepCounts counts;
+  memset(&counts, 0, sizeof(counts));
+  atc_processor_set_step_callback(&processor, count_step, &counts);
+
+  // The stats and the callback survive a change of zone.
+  atc_processor_init_for_zone_info(
+      &processor, &kAtcTestingZoneAmerica_Los_Angeles);
+  atc_processor_init_for_year(&processor, 2022);
+  atc_processor_init_for_year(&processor, 2022);
+  atc_processor_init_for_zone_info(&processor, &kAtcTestingZoneEtc_UTC);
+  atc_processor_init_for_year(&processor, 2022);
+
+  AtcProcessorStats stats;
+  atc_processor_get_stats(&processor, &stats);
+#if ACE_TIME_C_PROCESSOR_STATS
+  ACU_ASSERT(stats.num_year_hits == 1);
+  ACU_ASSERT(stats.num_year_misses == 2);
+  ACU_ASSERT(stats.num_matches == 2);
+  ACU_ASSERT(stats.num_transitions >= stats.num_active_transitions);
+  ACU_ASSERT(stats.num_active_transitions > 1);
+  ACU_ASSERT(stats.num_storage_overflows == 0);
+  ACU_ASSERT(stats.max_transitions > 0);
+  ACU_ASSERT(stats.max_transitions <= kAtcTransitionStorageSize);
+  ACU_ASSERT(stats.max_matches == 1);
+  for (uint8_t step = kAtcProcessorStepFindMatches;
+      step <= kAtcProcessorStepCalcAbbreviations; step++) {
+    ACU_ASSERT(counts.begins[step] == 2);
+    ACU_ASSERT(counts.ends[step] == 2);
+  }
+#else
+  ACU_ASSERT(stats.num_year_hits == 0);
+  ACU_ASSERT(stats.num_year_misses == 0);
+  ACU_ASSERT(stats.num_transitions == 0);
+  ACU_ASSERT(counts.begins[kAtcProcessorStepFindMatches] == 0);
+#endif
+
+  atc_processor_reset_stats(&processor);
+  atc_processor_get_stats(&processor, &stats);
+  ACU_ASSERT(stats.num_year_misses == 0);
+  ACU_ASSERT(stats.max_transitions == 0);
+}
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -1194,5 +1257,6 @@ int main()
   ACU_RUN_TEST(test_atc_processor_create_abbreviation_percent_s);
   ACU_RUN_TEST(test_atc_processor_create_abbreviation_slash);
   ACU_RUN_TEST(test_atc_processor_create_abbreviation_percent_z);
+  ACU_RUN_TEST(test_atc_processor_stats);
   ACU_SUMMARY();
 }
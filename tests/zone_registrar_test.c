@@ -84,6 +84,113 @@ ACU_TEST(test_atc_registrar_find_by_name_unsorted)
   ACU_ASSERT(info == NULL);
 }
 
+ACU_TEST(test_atc_registrar_set_hash)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcTestingZoneAndLinkRegistry,
+      kAtcTestingZoneAndLinkRegistrySize);
+
+  // The hash of a different registry is rejected.
+  ACU_ASSERT(atc_registrar_set_hash(&registrar, &kAtcTestingZoneHash)
+      == kAtcErrGeneric);
+  ACU_ASSERT(registrar.hash == NULL);
+
+  ACU_ASSERT(atc_registrar_set_hash(&registrar, &kAtcTestingZoneAndLinkHash)
+      == kAtcErrOk);
+  const AtcZoneInfo *info = atc_registrar_find_by_id(&registrar, 0xb7f7e8f2);
+  ACU_ASSERT(info == &kAtcTestingZoneAmerica_Los_Angeles);
+  info = atc_registrar_find_by_name(&registrar, "America/Los_Angeles");
+  ACU_ASSERT(info == &kAtcTestingZoneAmerica_Los_Angeles);
+
+  info = atc_registrar_find_by_id(&registrar, 0x0);
+  ACU_ASSERT(info == NULL);
+  info = atc_registrar_find_by_name(&registrar, "should not exist");
+  ACU_ASSERT(info == NULL);
+}
+
+/** Verify that every zone of the registry is found by id and by name. */
+static bool check_all_found(const AtcZoneRegistrar *registrar)
+{
+  for (uint16_t i = 0; i < registrar->size; i++) {
+    const AtcZoneInfo *info = registrar->registry[i];
+    if (atc_registrar_find_by_id(registrar, info->zone_id) != info) {
+      return false;
+    }
+    if (atc_registrar_find_by_name(registrar, info->name) != info) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ACU_TEST(test_atc_registrar_build_index)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(
+      &registrar,
+      kAtcZonedb2025ZoneAndLinkRegistry,
+      kAtcZonedb2025ZoneAndLinkRegistrySize);
+
+  static uint32_t keys[kAtcZonedb2025ZoneAndLinkRegistrySize];
+  static uint16_t positions[kAtcZonedb2025ZoneAndLinkRegistrySize];
+  ACU_ASSERT(atc_registrar_build_index(&registrar, keys, positions)
+      == kAtcErrOk);
+  ACU_ASSERT(check_all_found(&registrar));
+
+  ACU_ASSERT(atc_registrar_find_by_id(&registrar, 0x0) == NULL);
+  ACU_ASSERT(atc_registrar_find_by_id(&registrar, 0xffffffff) == NULL);
+  ACU_ASSERT(atc_registrar_find_by_name(&registrar, "should not exist")
+      == NULL);
+}
+
+ACU_TEST(test_atc_registrar_build_index_unsorted)
+{
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(&registrar, kUnsortedRegistry, UNSORTED_SIZE);
+
+  uint32_t keys[UNSORTED_SIZE];
+  uint16_t positions[UNSORTED_SIZE];
+  ACU_ASSERT(atc_registrar_build_index(&registrar, keys, positions)
+      == kAtcErrOk);
+  ACU_ASSERT(check_all_found(&registrar));
+
+  // The zone_ids in Eytzinger order: the root, its 2 children, then the left
+  // child of the left child.
+  ACU_ASSERT(keys[0] == kAtcTestingZoneAmerica_Denver.zone_id);
+  ACU_ASSERT(keys[1] == kAtcTestingZoneAmerica_Chicago.zone_id);
+  ACU_ASSERT(keys[2] == kAtcTestingZoneAmerica_Los_Angeles.zone_id);
+  ACU_ASSERT(keys[3] == kAtcTestingZoneAmerica_New_York.zone_id);
+  ACU_ASSERT(positions[0] == 1);
+  ACU_ASSERT(positions[3] == 3);
+
+  ACU_ASSERT(atc_registrar_find_by_id(&registrar, 0x0) == NULL);
+  ACU_ASSERT(atc_registrar_find_by_name(&registrar, "America/Toronto")
+      == NULL);
+}
+
+ACU_TEST(test_atc_registrar_build_index_duplicates)
+{
+  static const AtcZoneInfo * const kDuplicateRegistry[] = {
+    &kAtcTestingZoneAmerica_Los_Angeles,
+    &kAtcTestingZoneAmerica_Denver,
+    &kAtcTestingZoneAmerica_Los_Angeles,
+  };
+
+  AtcZoneRegistrar registrar;
+  atc_registrar_init(&registrar, kDuplicateRegistry, 3);
+  uint32_t keys[3];
+  uint16_t positions[3];
+  ACU_ASSERT(atc_registrar_build_index(&registrar, keys, positions)
+      == kAtcErrGeneric);
+  ACU_ASSERT(registrar.index_keys == NULL);
+
+  // The linear search is still used.
+  ACU_ASSERT(atc_registrar_find_by_name(&registrar, "America/Denver")
+      == &kAtcTestingZoneAmerica_Denver);
+}
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -95,5 +202,9 @@ int main()
   ACU_RUN_TEST(test_atc_registrar_find_by_name_sorted);
   ACU_RUN_TEST(test_atc_registrar_find_by_id_unsorted);
   ACU_RUN_TEST(test_atc_registrar_find_by_name_unsorted);
+  ACU_RUN_TEST(test_atc_registrar_set_hash);
+  ACU_RUN_TEST(test_atc_registrar_build_index);
+  ACU_RUN_TEST(test_atc_registrar_build_index_unsorted);
+  ACU_RUN_TEST(test_atc_registrar_build_index_duplicates);
   ACU_SUMMARY();
 }
@@ -15,7 +15,8 @@ ACU_TEST(test_zoned_date_time_to_and_from_epoch_seconds_epoch2000)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcZonedDateTime zdt;
   atc_time_t epoch_seconds = 0;
@@ -44,7 +45,8 @@ ACU_TEST(test_zoned_date_time_to_and_from_epoch_seconds_epoch2050)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcZonedDateTime zdt;
   atc_time_t epoch_seconds = 0;
@@ -68,6 +70,53 @@ ACU_TEST(test_zoned_date_time_to_and_from_epoch_seconds_epoch2050)
 
 //---------------------------------------------------------------------------
 
+// A processor bound to an explicit epoch does not use the current epoch year of
+// the library, and is not invalidated when it changes.
+ACU_TEST(test_zoned_date_time_to_and_from_epoch_seconds_explicit_epoch)
+{
+  AtcEpoch epoch2000;
+  atc_epoch_init(&epoch2000, 2000);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  atc_processor_set_epoch(&processor, &epoch2000);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+  ACU_ASSERT(atc_time_zone_get_epoch(&tz) == &epoch2000);
+
+  AtcZonedDateTime zdt;
+  atc_zoned_date_time_from_epoch_seconds(&zdt, 0, &tz);
+  ACU_ASSERT(!atc_zoned_date_time_is_error(&zdt));
+  ACU_ASSERT(zdt.year == 1999);
+  ACU_ASSERT(zdt.month == 12);
+  ACU_ASSERT(zdt.day == 31);
+  ACU_ASSERT(zdt.hour == 16);
+  ACU_ASSERT(atc_zoned_date_time_to_epoch_seconds(&zdt) == 0);
+  ACU_ASSERT(atc_zoned_date_time_to_unix_seconds(&zdt) == 946684800);
+  int16_t year = processor.year;
+
+  // Changing the global epoch does not invalidate the processor.
+  int16_t saved_epoch_year = atc_get_current_epoch_year();
+  atc_set_current_epoch_year(2100);
+  ACU_ASSERT(atc_processor_is_valid_for_year(&processor, year));
+  AtcPlainDateTime pdt = {1999, 12, 31, 16, 0, 0};
+  atc_zoned_date_time_from_plain_date_time(
+      &zdt, &pdt, &tz, kAtcDisambiguateCompatible);
+  ACU_ASSERT(atc_zoned_date_time_to_epoch_seconds(&zdt) == 0);
+  atc_set_current_epoch_year(saved_epoch_year);
+
+  // Convert to a time zone which uses the current epoch of the library.
+  AtcZoneProcessor processor_ny;
+  atc_processor_init(&processor_ny);
+  AtcTimeZone tzny = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_New_York, &processor_ny);
+  AtcZonedDateTime zdtny;
+  atc_zoned_date_time_convert(&zdt, &tzny, &zdtny);
+  ACU_ASSERT(!atc_zoned_date_time_is_error(&zdtny));
+  ACU_ASSERT(zdtny.year == 1999);
+  ACU_ASSERT(zdtny.hour == 19);
+  ACU_ASSERT(atc_zoned_date_time_to_unix_seconds(&zdtny) == 946684800);
+}
+
 ACU_TEST(test_zoned_date_time_from_epoch_seconds_unix_max)
 {
   int16_t saved_epoch_year = atc_get_current_epoch_year();
@@ -75,7 +124,8 @@ ACU_TEST(test_zoned_date_time_from_epoch_seconds_unix_max)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneEtc_UTC, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
 
   AtcZonedDateTime zdt;
   atc_time_t epoch_seconds = 1200798847;
@@ -103,7 +153,8 @@ ACU_TEST(test_zoned_date_time_from_epoch_seconds_invalid)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneEtc_UTC, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
 
   AtcZonedDateTime zdt;
   atc_time_t epoch_seconds = kAtcInvalidEpochSeconds;
@@ -115,7 +166,8 @@ ACU_TEST(test_zoned_date_time_to_epoch_seconds_invalid)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneEtc_UTC, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
   AtcZonedDateTime zdt;
 
   AtcPlainDateTime pdt = {0, 1, 1, 0, 0, 0};
@@ -170,7 +222,8 @@ ACU_TEST(test_zoned_date_time_from_epoch_seconds_fall_back)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // Start our sampling at 01:29:00-07:00, which is 31 seconds before overlap.
   AtcOffsetDateTime odt = {2022, 11, 6, 1, 29, 0, 0 /*resolved*/, -7*3600};
@@ -227,7 +280,8 @@ ACU_TEST(test_zoned_date_time_from_epoch_seconds_spring_forward)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // Start our sampling at 01:29:00-08:00, which is 31 seconds before the gap.
   AtcOffsetDateTime odt = {2022, 3, 13, 1, 29, 0, 0 /*resolved*/, -8*3600};
@@ -274,7 +328,8 @@ ACU_TEST(test_zoned_date_time_to_and_from_unix_seconds)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
   AtcZonedDateTime zdt;
 
   // date +%s -d '2000-01-01T00:00:00Z'
@@ -327,7 +382,8 @@ ACU_TEST(test_zoned_date_time_to_and_from_unix_seconds_invalid)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
   AtcZonedDateTime zdt;
 
   int64_t unix_seconds = kAtcInvalidUnixSeconds;
@@ -340,6 +396,54 @@ ACU_TEST(test_zoned_date_time_to_and_from_unix_seconds_invalid)
 
 //---------------------------------------------------------------------------
 
+// Unix seconds do not depend on the epoch, so dates several centuries away from
+// the current epoch year are converted without changing the epoch.
+ACU_TEST(test_zoned_date_time_from_unix_seconds_far_from_epoch)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+
+  // 1900-01-01T00:00:00-08:00
+  AtcZonedDateTime zdt;
+  atc_zoned_date_time_from_unix_seconds(&zdt, -2208960000, &tz);
+  ACU_ASSERT(!atc_zoned_date_time_is_error(&zdt));
+  ACU_ASSERT(zdt.year == 1900);
+  ACU_ASSERT(zdt.month == 1);
+  ACU_ASSERT(zdt.day == 1);
+  ACU_ASSERT(zdt.hour == 0);
+  ACU_ASSERT(zdt.offset_seconds == -8*3600);
+  ACU_ASSERT(atc_zoned_date_time_to_unix_seconds(&zdt) == -2208960000);
+
+  // 2200-07-01T00:00:00-07:00
+  atc_zoned_date_time_from_unix_seconds(&zdt, 7273782000, &tz);
+  ACU_ASSERT(!atc_zoned_date_time_is_error(&zdt));
+  ACU_ASSERT(zdt.year == 2200);
+  ACU_ASSERT(zdt.month == 7);
+  ACU_ASSERT(zdt.day == 1);
+  ACU_ASSERT(zdt.hour == 0);
+  ACU_ASSERT(zdt.offset_seconds == -7*3600);
+  ACU_ASSERT(atc_zoned_date_time_to_unix_seconds(&zdt) == 7273782000);
+
+  // 9999-07-01T00:00:00-07:00
+  AtcZonedExtra extra;
+  atc_zoned_extra_from_unix_seconds(&extra, 253386428400, &tz);
+  ACU_ASSERT(!atc_zoned_extra_is_error(&extra));
+  ACU_ASSERT(extra.dst_offset_seconds == 3600);
+  ACU_ASSERT(strcmp(extra.abbrev, "PDT") == 0);
+
+  // 0001-01-01T00:00:00Z
+  AtcTimeZone utc = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
+  atc_zoned_date_time_from_unix_seconds(&zdt, -62135596800, &utc);
+  ACU_ASSERT(!atc_zoned_date_time_is_error(&zdt));
+  ACU_ASSERT(zdt.year == 1);
+  ACU_ASSERT(zdt.month == 1);
+  ACU_ASSERT(zdt.day == 1);
+  ACU_ASSERT(atc_zoned_date_time_to_unix_seconds(&zdt) == -62135596800);
+}
+
 ACU_TEST(test_zoned_date_time_from_plain_date_time_epoch2000)
 {
   int16_t saved_epoch_year = atc_get_current_epoch_year();
@@ -347,7 +451,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_epoch2000)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2000, 1, 1, 0, 0, 0};
   AtcZonedDateTime zdt;
@@ -392,7 +497,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_epoch2050)
 
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2050, 1, 1, 0, 0, 0};
   AtcZonedDateTime zdt;
@@ -435,7 +541,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_before_gap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 01:59 should resolve to 01:59-08:00
   AtcPlainDateTime pdt = {2018, 3, 11, 1, 59, 0};
@@ -473,7 +580,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_in_gap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 02:01 doesn't exist.
   AtcPlainDateTime pdt = {2018, 3, 11, 2, 1, 0};
@@ -540,7 +648,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_after_gap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 03:01 should resolve to 03:01-07:00.
   AtcPlainDateTime pdt = {2018, 3, 11, 3, 1, 0};
@@ -578,7 +687,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_before_overlap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 00:59 is an hour before overlap, so should return 00:59-07:00.
   AtcZonedDateTime zdt;
@@ -616,7 +726,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_in_overlap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // There were two instances of 01:01
   AtcPlainDateTime pdt = {2018, 11, 4, 1, 1, 0};
@@ -683,7 +794,8 @@ ACU_TEST(test_zoned_date_time_from_plain_date_time_after_overlap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 02:01 should resolve to 02:01-08:00
   AtcZonedDateTime zdt;
@@ -725,8 +837,10 @@ ACU_TEST(test_zoned_date_time_convert)
   AtcZoneProcessor new_york;
   atc_processor_init(&los_angeles);
   atc_processor_init(&new_york);
-  AtcTimeZone tzla = {&kAtcTestingZoneAmerica_Los_Angeles, &los_angeles};
-  AtcTimeZone tzny = {&kAtcTestingZoneAmerica_New_York, &new_york};
+  AtcTimeZone tzla = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &los_angeles);
+  AtcTimeZone tzny = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_New_York, &new_york);
 
   // 2022-08-30 20:00-07:00 in LA
   AtcPlainDateTime pdt = {2022, 8, 30, 20, 0, 0};
@@ -755,7 +869,8 @@ ACU_TEST(test_zoned_date_time_normalize)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // 2018-03-11 02:30:00-08:00 is in the gap. After normalization, it should be
   // the later time 03:30-07:00.
@@ -777,7 +892,8 @@ ACU_TEST(test_zoned_date_time_print)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcZonedDateTime zdt;
   AtcPlainDateTime pdt = {2018, 3, 11, 2, 30, 0};
@@ -803,6 +919,7 @@ int main()
 {
   ACU_RUN_TEST(test_zoned_date_time_to_and_from_epoch_seconds_epoch2000);
   ACU_RUN_TEST(test_zoned_date_time_to_and_from_epoch_seconds_epoch2050);
+  ACU_RUN_TEST(test_zoned_date_time_to_and_from_epoch_seconds_explicit_epoch);
 
   ACU_RUN_TEST(test_zoned_date_time_from_epoch_seconds_unix_max);
   ACU_RUN_TEST(test_zoned_date_time_from_epoch_seconds_invalid);
@@ -813,6 +930,7 @@ int main()
 
   ACU_RUN_TEST(test_zoned_date_time_to_and_from_unix_seconds);
   ACU_RUN_TEST(test_zoned_date_time_to_and_from_unix_seconds_invalid);
+  ACU_RUN_TEST(test_zoned_date_time_from_unix_seconds_far_from_epoch);
 
   ACU_RUN_TEST(test_zoned_date_time_from_plain_date_time_epoch2000);
   ACU_RUN_TEST(test_zoned_date_time_from_plain_date_time_epoch2050);
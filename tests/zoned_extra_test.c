@@ -3,14 +3,15 @@
 #include <acunit.h>
 
 ACU_TEST(test_zoned_extra_sizeof) {
-  ACU_ASSERT((int)sizeof(AtcZonedExtra) == 28); // assuming 64-bit machine
+  ACU_ASSERT((int)sizeof(AtcZonedExtra) == 48); // assuming 64-bit machine
 }
 
 ACU_TEST(test_zoned_extra_from_epoch_seconds_invalid)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneEtc_UTC, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
 
   AtcZonedExtra extra;
   atc_time_t epoch_seconds = kAtcInvalidEpochSeconds;
@@ -23,7 +24,8 @@ ACU_TEST(test_zoned_extra_from_unix_seconds_invalid)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneEtc_UTC, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
 
   AtcZonedExtra extra;
   int64_t unix_seconds = kAtcInvalidUnixSeconds;
@@ -36,7 +38,8 @@ ACU_TEST(test_zoned_extra_from_epoch_seconds_in_overlap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // Start our sampling at 01:29:00-07:00 within the overlap.
   AtcOffsetDateTime odt = {2022, 11, 6, 1, 29, 0, 0 /*resolved*/, -7*3600};
@@ -66,7 +69,8 @@ ACU_TEST(test_zoned_extra_from_epoch_seconds_in_gap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // Start our sampling at 01:29:00-08:00, which is 31 seconds before the DST
   // spring forward.
@@ -97,7 +101,8 @@ ACU_TEST(test_zoned_extra_from_plain_date_time_in_overlap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   // Start our sampling at 01:29:00 which is within the overlap.
   AtcPlainDateTime pdt = {2022, 11, 6, 1, 29, 0};
@@ -130,7 +135,8 @@ ACU_TEST(test_zoned_extra_from_plain_date_time_in_gap)
 {
   AtcZoneProcessor processor;
   atc_processor_init(&processor);
-  AtcTimeZone tz = {&kAtcTestingZoneAmerica_Los_Angeles, &processor};
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
 
   AtcPlainDateTime pdt = {2022, 3, 13, 2, 29, 0};
 
@@ -157,6 +163,124 @@ ACU_TEST(test_zoned_extra_from_plain_date_time_in_gap)
   ACU_ASSERT(strcmp(extra.abbrev, "PST") == 0);
 }
 
+ACU_TEST(test_zoned_extra_valid_interval)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  AtcTimeZone tz = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneAmerica_Los_Angeles, &processor);
+
+  // 2022-07-01 00:00 UTC is within [2022-03-13 02:00 PST, 2022-11-06 02:00 PDT)
+  AtcZonedExtra extra;
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &tz);
+  ACU_ASSERT(extra.valid_from_unix_seconds == 1647165600);
+  ACU_ASSERT(extra.valid_until_unix_seconds == 1667725200);
+
+  // 02:29:00 in the gap normalizes to 03:29:00-07:00, in the same PDT interval.
+  AtcPlainDateTime pdt = {2022, 3, 13, 2, 29, 0};
+  atc_zoned_extra_from_plain_date_time(
+      &extra, &pdt, &tz, kAtcDisambiguateCompatible);
+  ACU_ASSERT(extra.valid_from_unix_seconds == 1647165600);
+  ACU_ASSERT(extra.valid_until_unix_seconds == 1667725200);
+
+  // The earlier time normalizes to 01:29:00-08:00, in the preceding PST.
+  atc_zoned_extra_from_plain_date_time(
+      &extra, &pdt, &tz, kAtcDisambiguateReversed);
+  ACU_ASSERT(extra.valid_from_unix_seconds == 1636275600);
+  ACU_ASSERT(extra.valid_until_unix_seconds == 1647165600);
+
+  // A fixed offset is valid forever.
+  AtcTimeZone utc = atc_time_zone_for_zone_info(
+      &kAtcTestingZoneEtc_UTC, &processor);
+  atc_zoned_extra_from_unix_seconds(&extra, 1656633600, &utc);
+  ACU_ASSERT(extra.valid_from_unix_seconds == INT64_MIN);
+  ACU_ASSERT(extra.valid_until_unix_seconds == INT64_MAX);
+}
+
+static bool is_same_offsets(const AtcZonedExtra *a, const AtcZonedExtra *b)
+{
+  return a->std_offset_seconds == b->std_offset_seconds
+      && a->dst_offset_seconds == b->dst_offset_seconds
+      && strcmp(a->abbrev, b->abbrev) == 0;
+}
+
+// The offsets and abbreviation must be the same at both ends of the interval
+// returned for instants every 5 days and 7 hours, through the transitions of
+// the processor and the steady state.
+ACU_TEST(test_zoned_extra_valid_interval_is_consistent)
+{
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  int64_t start = 946684800; // 2000-01-01
+  int64_t until = 2208988800; // 2040-01-01
+  for (uint16_t i = 0; i < kAtcTestingZoneRegistrySize; i++) {
+    AtcTimeZone tz = atc_time_zone_for_zone_info(
+        kAtcTestingZoneRegistry[i], &processor);
+    for (int64_t t = start; t < until; t += 5 * 86400 + 7 * 3600) {
+      AtcZonedExtra extra;
+      atc_zoned_extra_from_unix_seconds(&extra, t, &tz);
+      ACU_ASSERT(! atc_zoned_extra_is_error(&extra));
+      int64_t from = extra.valid_from_unix_seconds;
+      int64_t to = extra.valid_until_unix_seconds;
+      ACU_ASSERT(from <= t && t < to);
+      if (from == INT64_MIN) continue;
+
+      AtcZonedExtra other;
+      atc_zoned_extra_from_unix_seconds(&other, from, &tz);
+      ACU_ASSERT(is_same_offsets(&extra, &other));
+      atc_zoned_extra_from_unix_seconds(&other, to - 1, &tz);
+      ACU_ASSERT(is_same_offsets(&extra, &other));
+    }
+  }
+}
+
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+
+/** Check the offsets at both ends of the interval returned at `t`. */
+static bool is_valid_interval_consistent(const AtcTimeZone *tz, int64_t t)
+{
+  AtcZonedExtra extra;
+  atc_zoned_extra_from_unix_seconds(&extra, t, tz);
+  int64_t from = extra.valid_from_unix_seconds;
+  int64_t to = extra.valid_until_unix_seconds;
+  if (atc_zoned_extra_is_error(&extra) || t < from || to <= t) return false;
+
+  AtcZonedExtra other;
+  atc_zoned_extra_from_unix_seconds(&other, from, tz);
+  if (! is_same_offsets(&extra, &other)) return false;
+  atc_zoned_extra_from_unix_seconds(&other, to - 1, tz);
+  return is_same_offsets(&extra, &other);
+}
+
+// Same as above, at and just before every transition of zones which have
+// transitions on Dec 1, the start of the window of the AtcZoneProcessor.
+ACU_TEST(test_zoned_extra_valid_interval_at_transitions)
+{
+  static const AtcZoneInfo * const zone_infos[] = {
+    &kAtcZonedballZoneAmerica_Sao_Paulo,
+    &kAtcZonedballZoneAmerica_Boa_Vista,
+  };
+  AtcZoneProcessor generator;
+  atc_processor_init(&generator);
+  AtcZoneProcessor processor;
+  atc_processor_init(&processor);
+  for (uint8_t z = 0; z < 2; z++) {
+    atc_processor_init_for_zone_info(&generator, zone_infos[z]);
+    AtcTimeZone tz = atc_time_zone_for_zone_info(zone_infos[z], &processor);
+    for (int16_t year = 1914; year < 2040; year++) {
+      atc_processor_init_for_year(&generator, year);
+      const AtcTransitionStorage *ts = &generator.transition_storage;
+      for (uint8_t i = 1; i < ts->index_free; i++) {
+        int64_t start = ts->transitions[i]->start_unix_seconds;
+        ACU_ASSERT(is_valid_interval_consistent(&tz, start - 1));
+        ACU_ASSERT(is_valid_interval_consistent(&tz, start));
+      }
+    }
+  }
+}
+
+#endif
+
 //---------------------------------------------------------------------------
 
 ACU_CONTEXT();
@@ -170,5 +294,10 @@ int main()
   ACU_RUN_TEST(test_zoned_extra_from_epoch_seconds_in_gap);
   ACU_RUN_TEST(test_zoned_extra_from_plain_date_time_in_overlap);
   ACU_RUN_TEST(test_zoned_extra_from_plain_date_time_in_gap);
+  ACU_RUN_TEST(test_zoned_extra_valid_interval);
+  ACU_RUN_TEST(test_zoned_extra_valid_interval_is_consistent);
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+  ACU_RUN_TEST(test_zoned_extra_valid_interval_at_transitions);
+#endif
   ACU_SUMMARY();
 }
@@ -0,0 +1,191 @@
+/*
+Generates the `zone_hash.h` and `zone_hash.c` files of a zonedb directory,
+which contain the minimal perfect hashes (see acetimec/zone_hash.h) of its
+zone registry and its zone and link registry, so that they can be stored in
+flash instead of being built at runtime by atc_zone_hash_init(). The files must
+be regenerated whenever the registries of the zonedb are regenerated, which
+the `all` target of the Makefile of each zonedb does after tzcompiler.
+
+The highres version generates zonedball, zonedb2000, zonedb2025 and
+zonedbtesting, the midres version generates zonedb2000m, zonedb2025m and
+zonedbtestingm.
+
+Usage:
+$ make
+$ ./zone_hash_generator.out zonedb2025 ../../src/zonedb2025
+Wrote ../../src/zonedb2025/zone_hash.h
+Wrote ../../src/zonedb2025/zone_hash.c
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <acetimec.h>
+
+/** A zonedb with its 2 registries. */
+typedef struct Database {
+  /** Name of the zonedb, without the 'm' suffix of midres. */
+  const char *name;
+  /** Prefix of the symbols, e.g. "kAtcZonedb2025". */
+  const char *prefix;
+  /** Infix of the include guard, e.g. "ZONEDB2025". */
+  const char *guard;
+  const AtcZoneInfo * const *zones;
+  uint16_t num_zones;
+  const AtcZoneInfo * const *zones_and_links;
+  uint16_t num_zones_and_links;
+} Database;
+
+static const Database kDatabases[] = {
+#if ACE_TIME_C_ZONEDB_RES == ACE_TIME_C_ZONEDB_RES_HIGH
+  {
+    "zonedball", "kAtcZonedball", "ZONEDBALL",
+    kAtcZonedballZoneRegistry,
+    kAtcZonedballZoneRegistrySize,
+    kAtcZonedballZoneAndLinkRegistry,
+    kAtcZonedballZoneAndLinkRegistrySize,
+  },
+#endif
+  {
+    "zonedb2000", "kAtcZonedb2000", "ZONEDB2000",
+    kAtcZonedb2000ZoneRegistry,
+    kAtcZonedb2000ZoneRegistrySize,
+    kAtcZonedb2000ZoneAndLinkRegistry,
+    kAtcZonedb2000ZoneAndLinkRegistrySize,
+  },
+  {
+    "zonedb2025", "kAtcZonedb2025", "ZONEDB2025",
+    kAtcZonedb2025ZoneRegistry,
+    kAtcZonedb2025ZoneRegistrySize,
+    kAtcZonedb2025ZoneAndLinkRegistry,
+    kAtcZonedb2025ZoneAndLinkRegistrySize,
+  },
+  {
+    "zonedbtesting", "kAtcTesting", "TESTING",
+    kAtcTestingZoneRegistry,
+    kAtcTestingZoneRegistrySize,
+    kAtcTestingZoneAndLinkRegistry,
+    kAtcTestingZoneAndLinkRegistrySize,
+  },
+};
+
+#define NUM_DATABASES (sizeof(kDatabases) / sizeof(kDatabases[0]))
+
+static const char kHeaderComment[] =
+    "// This file was generated by tools/zone_hash_generator from the\n"
+    "// registries of zone_registry.h.\n"
+    "//\n"
+    "// DO NOT EDIT\n";
+
+static void print_array(
+    FILE *file,
+    const char *name,
+    const uint16_t *values,
+    uint16_t size)
+{
+  fprintf(file, "static const uint16_t %s[%u] = {\n", name, size);
+  for (uint16_t i = 0; i < size; i++) {
+    if (i % 10 == 0) fprintf(file, " ");
+    fprintf(file, " %u,", values[i]);
+    if (i % 10 == 9 || i == size - 1) fprintf(file, "\n");
+  }
+  fprintf(file, "};\n\n");
+}
+
+/** Build and print the hash of the registry 'kind' ("Zone" or "ZoneAndLink"). */
+static int print_hash(
+    FILE *file,
+    const Database *db,
+    const char *kind,
+    const AtcZoneInfo * const *registry,
+    uint16_t size)
+{
+  uint16_t num_buckets = ATC_ZONE_HASH_NUM_BUCKETS(size);
+  uint16_t seeds[ATC_ZONE_HASH_NUM_BUCKETS(UINT16_MAX)];
+  static uint16_t indexes[UINT16_MAX];
+  AtcZoneHash hash;
+  if (atc_zone_hash_init(
+      &hash, registry, size, seeds, num_buckets, indexes)) {
+    fprintf(stderr, "ERROR: cannot hash %s %s\n", db->name, kind);
+    return 1;
+  }
+
+  char name[64];
+  fprintf(file, "//%s\n", "---------------------------------------------------"
+      "------------------------");
+  fprintf(file, "// %s\n", strcmp(kind, "Zone") == 0
+      ? "Zones" : "Zones and Links");
+  fprintf(file, "//%s\n\n", "---------------------------------------------------"
+      "------------------------");
+  snprintf(name, sizeof(name), "k%sHashSeeds", kind);
+  print_array(file, name, seeds, num_buckets);
+  snprintf(name, sizeof(name), "k%sHashIndexes", kind);
+  print_array(file, name, indexes, size);
+  fprintf(file, "const AtcZoneHash %s%sHash = {\n", db->prefix, kind);
+  fprintf(file, "  %s%sRegistry /*registry*/,\n", db->prefix, kind);
+  fprintf(file, "  %u /*size*/,\n", size);
+  fprintf(file, "  %u /*num_buckets*/,\n", num_buckets);
+  fprintf(file, "  k%sHashSeeds /*seeds*/,\n", kind);
+  fprintf(file, "  k%sHashIndexes /*indexes*/,\n", kind);
+  fprintf(file, "};\n");
+  return 0;
+}
+
+static int write_header(const Database *db, const char *dir)
+{
+  char path[256];
+  snprintf(path, sizeof(path), "%s/zone_hash.h", dir);
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    fprintf(stderr, "ERROR: cannot write '%s'\n", path);
+    return 1;
+  }
+  fprintf(file, "%s\n", kHeaderComment);
+  fprintf(file, "#ifndef ACE_TIME_C_ZONEDB_%s_ZONE_HASH_H\n", db->guard);
+  fprintf(file, "#define ACE_TIME_C_ZONEDB_%s_ZONE_HASH_H\n\n", db->guard);
+  fprintf(file, "#include \"../acetimec/zone_hash.h\"\n\n");
+  fprintf(file, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+  fprintf(file, "// Zones\n");
+  fprintf(file, "extern const AtcZoneHash %sZoneHash;\n\n", db->prefix);
+  fprintf(file, "// Zones and Links\n");
+  fprintf(file, "extern const AtcZoneHash %sZoneAndLinkHash;\n\n", db->prefix);
+  fprintf(file, "#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+  fclose(file);
+  printf("Wrote %s\n", path);
+  return 0;
+}
+
+static int write_source(const Database *db, const char *dir)
+{
+  char path[256];
+  snprintf(path, sizeof(path), "%s/zone_hash.c", dir);
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    fprintf(stderr, "ERROR: cannot write '%s'\n", path);
+    return 1;
+  }
+  fprintf(file, "%s\n", kHeaderComment);
+  fprintf(file, "#include \"zone_registry.h\"\n");
+  fprintf(file, "#include \"zone_hash.h\"\n\n");
+  int err = print_hash(file, db, "Zone", db->zones, db->num_zones);
+  fprintf(file, "\n");
+  err |= print_hash(file, db, "ZoneAndLink",
+      db->zones_and_links, db->num_zones_and_links);
+  fclose(file);
+  if (! err) printf("Wrote %s\n", path);
+  return err;
+}
+
+int main(int argc, const char * const *argv)
+{
+  if (argc != 3) {
+    fprintf(stderr, "Usage: zone_hash_generator.out zonedb output_dir\n");
+    return 1;
+  }
+  for (size_t i = 0; i < NUM_DATABASES; i++) {
+    const Database *db = &kDatabases[i];
+    if (strcmp(db->name, argv[1]) != 0) continue;
+    return write_header(db, argv[2]) || write_source(db, argv[2]);
+  }
+  fprintf(stderr, "ERROR: unknown zonedb '%s'\n", argv[1]);
+  return 1;
+}